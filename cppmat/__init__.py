@@ -94,14 +94,14 @@ Define class to build the extension.
 
   def build_extensions(self):
     ct = self.compiler.compiler_type
-    opts = self.c_opts.get(ct, [])
+    opts = list(self.c_opts.get(ct, []))
     if ct == 'unix':
       opts.append('-DVERSION_INFO="%s"' % self.distribution.get_version())
       opts.append(cpp_flag(self.compiler))
     elif ct == 'msvc':
       opts.append('/DVERSION_INFO=\\"%s\\"' % self.distribution.get_version())
     for ext in self.extensions:
-      ext.extra_compile_args = opts
+      ext.extra_compile_args = list(opts)
     build_ext.build_extensions(self)
 
 # ==================================================================================================
@@ -0,0 +1,19 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#include <cppmat/cppmat.h>
+#include <cppmat/pybind11_batch.hpp>
+
+// =================================================================================================
+
+PYBIND11_MODULE(batch, m)
+{
+
+m.doc() = "Batched tensor operations on NumPy-arrays of shape [..., nd, nd] (see cppmat::batch)";
+
+cppmat::batch::bind(m);
+
+} // PYBIND11_MODULE
@@ -0,0 +1,175 @@
+
+#include "support.h"
+
+typedef cppmat::array<double> Arr;
+typedef cppmat::array<size_t> Conn;
+
+// =================================================================================================
+
+// regular mesh of "nx" by "ny" four-noded quadrilaterals
+inline Conn makeMesh(size_t nx, size_t ny)
+{
+  Conn conn({nx*ny, 4});
+
+  for ( size_t i = 0 ; i < ny ; ++i ) {
+    for ( size_t j = 0 ; j < nx ; ++j ) {
+      size_t e = i*nx+j;
+      conn(e,0) = (i  )*(nx+1) + j;
+      conn(e,1) = (i  )*(nx+1) + j+1;
+      conn(e,2) = (i+1)*(nx+1) + j+1;
+      conn(e,3) = (i+1)*(nx+1) + j;
+    }
+  }
+
+  return conn;
+}
+
+// =================================================================================================
+
+TEST_CASE("cppmat::assembly", "assembly.h")
+{
+
+size_t nx    = 5;
+size_t ny    = 4;
+size_t nnode = (nx+1)*(ny+1);
+size_t ndim  = 2;
+Conn   conn  = makeMesh(nx,ny);
+size_t nelem = conn.shape(0);
+size_t nne   = conn.shape(1);
+
+// =================================================================================================
+
+SECTION( "colouring" )
+{
+  auto colours = cppmat::assembly::colouring(conn);
+
+  // a structured quad mesh needs four colours
+  REQUIRE( colours.size() == 4 );
+
+  size_t n = 0;
+
+  for ( auto &elem : colours )
+  {
+    n += elem.size();
+
+    std::vector<int> used(nnode, 0);
+
+    for ( auto &e : elem )
+      for ( size_t m = 0 ; m < nne ; ++m )
+        REQUIRE( used[conn(e,m)]++ == 0 );
+  }
+
+  REQUIRE( n == nelem );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "gather" )
+{
+  Arr u = Arr::Random({nnode, ndim});
+
+  Arr v = cppmat::assembly::gather(u, conn);
+
+  for ( size_t e = 0 ; e < nelem ; ++e )
+    for ( size_t m = 0 ; m < nne ; ++m )
+      for ( size_t i = 0 ; i < ndim ; ++i )
+        EQ( v(e,m,i), u(conn(e,m),i) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "scatter_add : nodal vector" )
+{
+  Arr v = Arr::Random({nelem, nne, ndim});
+  Arr f = Arr::Zero  ({nnode, ndim});
+  Arr g = Arr::Zero  ({nnode, ndim});
+  Arr h = Arr::Zero  ({nnode, ndim});
+
+  for ( size_t e = 0 ; e < nelem ; ++e )
+    for ( size_t m = 0 ; m < nne ; ++m )
+      for ( size_t i = 0 ; i < ndim ; ++i )
+        f(conn(e,m),i) += v(e,m,i);
+
+  cppmat::assembly::scatter_add(g, v, conn);
+  cppmat::assembly::scatter_add(h, v, conn, cppmat::assembly::colouring(conn));
+
+  for ( size_t i = 0 ; i < f.size() ; ++i ) {
+    EQ( g[i], f[i] );
+    EQ( h[i], f[i] );
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "scatter_add : matrix" )
+{
+  size_t n    = nne*ndim;
+  size_t ndof = nnode*ndim;
+
+  Arr ke = Arr::Random({nelem, n, n});
+
+  MatD k = MatD::Zero(ndof, ndof);
+
+  for ( size_t e = 0 ; e < nelem ; ++e )
+    for ( size_t p = 0 ; p < n ; ++p )
+      for ( size_t q = 0 ; q < n ; ++q )
+        k(conn(e,p/ndim)*ndim+p%ndim, conn(e,q/ndim)*ndim+q%ndim) += ke(e,p,q);
+
+  auto colours = cppmat::assembly::colouring(conn);
+
+  // dense
+  cppmat::matrix<double> K = cppmat::matrix<double>::Zero(ndof, ndof);
+  cppmat::matrix<double> L = cppmat::matrix<double>::Zero(ndof, ndof);
+
+  cppmat::assembly::scatter_add(K, ke, conn);
+  cppmat::assembly::scatter_add(L, ke, conn, colours);
+
+  Equal(K, k);
+  Equal(L, k);
+
+  // sparse: the first assembly creates the sparsity pattern, the second re-uses it
+  cppmat::sparse::matrix<double> S(ndof, ndof);
+
+  for ( size_t repeat = 0 ; repeat < 2 ; ++repeat )
+  {
+    S.setZero();
+
+    cppmat::assembly::scatter_add(S, ke, conn, colours);
+
+    for ( size_t i = 0 ; i < ndof ; ++i )
+      for ( size_t j = 0 ; j < ndof ; ++j )
+        EQ( S(i,j), k(i,j) );
+  }
+
+  // sparse: incomplete sparsity pattern (from half of the elements), the missing entries are added
+  // afterwards; the result does not depend on the scheduling
+  Arr  half  = Arr::Zero({nelem/2, n, n});
+  Conn chalf = Conn::Zero({nelem/2, nne});
+
+  for ( size_t e = 0 ; e < nelem/2 ; ++e )
+    for ( size_t m = 0 ; m < nne ; ++m )
+      chalf(e,m) = conn(e,m);
+
+  std::vector<cppmat::sparse::matrix<double>> T(2, cppmat::sparse::matrix<double>(ndof, ndof));
+
+  for ( auto &t : T )
+  {
+    cppmat::assembly::scatter_add(t, half, chalf);
+
+    t.setZero();
+
+    cppmat::assembly::scatter_add(t, ke, conn, colours);
+
+    for ( size_t i = 0 ; i < ndof ; ++i )
+      for ( size_t j = 0 ; j < ndof ; ++j )
+        EQ( t(i,j), k(i,j) );
+  }
+
+  for ( size_t i = 0 ; i < ndof ; ++i )
+    for ( size_t j = 0 ; j < ndof ; ++j )
+      REQUIRE( T[0](i,j) == T[1](i,j) );
+}
+
+// =================================================================================================
+
+}
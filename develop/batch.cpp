@@ -0,0 +1,171 @@
+
+#include "support.h"
+
+typedef cppmat::array<double> Arr;
+
+typedef cppmat::cartesian::tensor4<double> T4;
+typedef cppmat::cartesian::tensor2<double> T2;
+typedef cppmat::cartesian::vector <double> V;
+
+// =================================================================================================
+
+TEST_CASE("cppmat::batch", "batch.h")
+{
+
+// batch shape
+std::vector<size_t> items = {5,2};
+size_t              n     = 10;
+
+// =================================================================================================
+
+SECTION( "products, ND = 2, 3, 4" )
+{
+  for ( size_t nd = 2 ; nd <= 4 ; ++nd )
+  {
+    Arr A = Arr::Random(cppmat::batch::Private::shape(items, 4, nd));
+    Arr B = Arr::Random(cppmat::batch::Private::shape(items, 4, nd));
+    Arr a = Arr::Random(cppmat::batch::Private::shape(items, 2, nd));
+    Arr b = Arr::Random(cppmat::batch::Private::shape(items, 2, nd));
+    Arr u = Arr::Random(cppmat::batch::Private::shape(items, 1, nd));
+    Arr v = Arr::Random(cppmat::batch::Private::shape(items, 1, nd));
+
+    Arr C44 = cppmat::batch::ddot44  (A, B);
+    Arr C42 = cppmat::batch::ddot42  (A, a);
+    Arr C24 = cppmat::batch::ddot24  (a, A);
+    Arr C22 = cppmat::batch::ddot22  (a, b);
+    Arr D22 = cppmat::batch::dot22   (a, b);
+    Arr D21 = cppmat::batch::dot21   (a, u);
+    Arr D12 = cppmat::batch::dot12   (u, a);
+    Arr D11 = cppmat::batch::dot11   (u, v);
+    Arr E22 = cppmat::batch::dyadic22(a, b);
+    Arr E11 = cppmat::batch::dyadic11(u, v);
+
+    REQUIRE( C44.shape() == cppmat::batch::Private::shape(items, 4, nd) );
+    REQUIRE( C22.shape() == items );
+
+    size_t n4 = nd*nd*nd*nd;
+    size_t n2 = nd*nd;
+
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      T4 Ai = T4::Copy(nd, A.data()+i*n4);
+      T4 Bi = T4::Copy(nd, B.data()+i*n4);
+      T2 ai = T2::Copy(nd, a.data()+i*n2);
+      T2 bi = T2::Copy(nd, b.data()+i*n2);
+      V  ui = V ::Copy(nd, u.data()+i*nd);
+      V  vi = V ::Copy(nd, v.data()+i*nd);
+
+      Equal(T4::Copy(nd, C44.data()+i*n4), Ai.ddot(Bi));
+      Equal(T2::Copy(nd, C42.data()+i*n2), Ai.ddot(ai));
+      Equal(T2::Copy(nd, C24.data()+i*n2), ai.ddot(Ai));
+      Equal(T2::Copy(nd, D22.data()+i*n2), ai.dot(bi));
+      Equal(V ::Copy(nd, D21.data()+i*nd), ai.dot(ui));
+      Equal(V ::Copy(nd, D12.data()+i*nd), ui.dot(ai));
+      Equal(T4::Copy(nd, E22.data()+i*n4), ai.dyadic(bi));
+      Equal(T2::Copy(nd, E11.data()+i*n2), ui.dyadic(vi));
+
+      EQ( C22[i], ai.ddot(bi) );
+      EQ( D11[i], ui.dot(vi) );
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "inverse, determinant, trace, deviator, ND = 2, 3, 4" )
+{
+  for ( size_t nd = 2 ; nd <= 4 ; ++nd )
+  {
+    // diagonally dominant: well conditioned
+    Arr A = Arr::Random(cppmat::batch::Private::shape(items, 2, nd));
+
+    for ( size_t i = 0 ; i < n ; ++i )
+      for ( size_t j = 0 ; j < nd ; ++j )
+        A[i*nd*nd+j*nd+j] += static_cast<double>(nd);
+
+    Arr Ainv = cppmat::batch::inv     (A);
+    Arr Adet = cppmat::batch::det     (A);
+    Arr Atr  = cppmat::batch::trace   (A);
+    Arr Adev = cppmat::batch::deviator(A);
+
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      T2 Ai = T2::Copy(nd, A   .data()+i*nd*nd);
+      T2 Bi = T2::Copy(nd, Ainv.data()+i*nd*nd);
+      T2 Di = T2::Copy(nd, Adev.data()+i*nd*nd);
+
+      Equal(Ai.dot(Bi), T2::I(nd));
+
+      EQ( Atr[i], Ai.trace() );
+      EQ( Di.trace(), 0.0 );
+
+      for ( size_t j = 0 ; j < nd ; ++j )
+        for ( size_t k = 0 ; k < nd ; ++k )
+          if ( j != k )
+            EQ( Di(j,k), Ai(j,k) );
+
+      if ( nd <= 3 )
+        EQ( Adet[i], Ai.det() );
+    }
+
+    // a known determinant: "det(c * I) = c^nd"
+    Arr I = Arr::Zero(cppmat::batch::Private::shape({1}, 2, nd));
+
+    for ( size_t j = 0 ; j < nd ; ++j )
+      I[j*nd+j] = 2.;
+
+    EQ( cppmat::batch::det(I)[0], std::pow(2., static_cast<double>(nd)) );
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "eigen-decomposition, ND = 2, 3, 4" )
+{
+  for ( size_t nd = 2 ; nd <= 4 ; ++nd )
+  {
+    Arr A = Arr::Random(cppmat::batch::Private::shape(items, 2, nd));
+    Arr vec, val;
+
+    cppmat::batch::eigs(A, vec, val);
+
+    REQUIRE( val.shape() == cppmat::batch::Private::shape(items, 1, nd) );
+
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      T2 Ai = T2::Copy(nd, A.data()+i*nd*nd);
+      T2 Si = ( Ai + Ai.T() ) / 2.;
+
+      for ( size_t k = 0 ; k < nd ; ++k )
+      {
+        V x(nd);
+
+        for ( size_t j = 0 ; j < nd ; ++j )
+          x(j) = vec[i*nd*nd+j*nd+k];
+
+        Equal(Si.dot(x), x * val[i*nd+k]);
+
+        EQ( x.dot(x), 1.0 );
+
+        if ( k > 0 )
+          REQUIRE( val[i*nd+k-1] <= val[i*nd+k] );
+      }
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "shape mismatch" )
+{
+  Arr A = Arr::Random({5,3,3});
+  Arr B = Arr::Random({4,3,3});
+  Arr C = Arr::Random({5,3,2});
+
+  REQUIRE_THROWS( cppmat::batch::ddot22(A, B) );
+  REQUIRE_THROWS( cppmat::batch::inv(C) );
+}
+
+// =================================================================================================
+
+}
@@ -0,0 +1,129 @@
+
+// Benchmark of element-based assembly: element-by-element via the index operators compared to the
+// batched gather/scatter functions of "cppmat::assembly" (serial and coloured).
+//
+// Usage: ./benchmark_assembly [nx] [repeat]
+// (compile with OpenMP to run the coloured versions in parallel)
+
+#include <chrono>
+#include "../src/cppmat/cppmat.h"
+
+typedef cppmat::array<double> Arr;
+typedef cppmat::array<size_t> Conn;
+
+// =================================================================================================
+
+template<typename F>
+double timeit(F func, size_t repeat)
+{
+  auto start = std::chrono::high_resolution_clock::now();
+
+  for ( size_t i = 0 ; i < repeat ; ++i ) func();
+
+  auto stop = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration<double>(stop-start).count() / static_cast<double>(repeat);
+}
+
+// =================================================================================================
+
+int main(int argc, char *argv[])
+{
+  size_t nx     = argc > 1 ? std::stoul(argv[1]) : 500;
+  size_t repeat = argc > 2 ? std::stoul(argv[2]) : 10;
+
+  // regular mesh of four-noded quadrilaterals
+  size_t nnode = (nx+1)*(nx+1);
+  size_t nelem = nx*nx;
+  size_t nne   = 4;
+  size_t ndim  = 2;
+
+  Conn conn({nelem, nne});
+
+  for ( size_t i = 0 ; i < nx ; ++i ) {
+    for ( size_t j = 0 ; j < nx ; ++j ) {
+      size_t e = i*nx+j;
+      conn(e,0) = (i  )*(nx+1) + j;
+      conn(e,1) = (i  )*(nx+1) + j+1;
+      conn(e,2) = (i+1)*(nx+1) + j+1;
+      conn(e,3) = (i+1)*(nx+1) + j;
+    }
+  }
+
+  Arr u = Arr::Random({nnode, ndim});
+  Arr v = Arr::Random({nelem, nne, ndim});
+  Arr f = Arr::Zero  ({nnode, ndim});
+
+  auto colours = cppmat::assembly::colouring(conn);
+
+  // reference: element-by-element, using the index operators (sizes as they would be known in
+  // a library function, not as compile-time constants)
+
+  size_t ne = conn.shape(0);
+  size_t nn = conn.shape(1);
+  size_t nd = u.shape(1);
+
+  // gather
+
+  double t_gather_loop = timeit([&]() {
+    Arr w({ne, nn, nd});
+    for ( size_t e = 0 ; e < ne ; ++e )
+      for ( size_t m = 0 ; m < nn ; ++m )
+        for ( size_t i = 0 ; i < nd ; ++i )
+          w(e,m,i) = u(conn(e,m),i);
+  }, repeat);
+
+  double t_gather = timeit([&]() {
+    Arr w = cppmat::assembly::gather(u, conn);
+  }, repeat);
+
+  // scatter-add
+
+  double t_scatter_loop = timeit([&]() {
+    for ( size_t e = 0 ; e < ne ; ++e )
+      for ( size_t m = 0 ; m < nn ; ++m )
+        for ( size_t i = 0 ; i < nd ; ++i )
+          f(conn(e,m),i) += v(e,m,i);
+  }, repeat);
+
+  double t_scatter = timeit([&]() {
+    cppmat::assembly::scatter_add(f, v, conn);
+  }, repeat);
+
+  double t_scatter_col = timeit([&]() {
+    cppmat::assembly::scatter_add(f, v, conn, colours);
+  }, repeat);
+
+  // sparse matrix
+
+  size_t n = nne*ndim;
+
+  Arr ke = Arr::Random({nelem, n, n});
+
+  cppmat::sparse::matrix<double> K(nnode*ndim, nnode*ndim);
+
+  double t_sparse_first = timeit([&]() {
+    K.resize(nnode*ndim, nnode*ndim);
+    cppmat::assembly::scatter_add(K, ke, conn);
+  }, 1);
+
+  double t_sparse = timeit([&]() {
+    K.setZero();
+    cppmat::assembly::scatter_add(K, ke, conn);
+  }, repeat);
+
+  double t_sparse_col = timeit([&]() {
+    K.setZero();
+    cppmat::assembly::scatter_add(K, ke, conn, colours);
+  }, repeat);
+
+  std::cout << "nelem = " << nelem << ", colours = " << colours.size() << std::endl;
+  std::cout << "gather                       : loop " << t_gather_loop  << " s, batched "
+            << t_gather << " s" << std::endl;
+  std::cout << "scatter_add (nodal vector)   : loop " << t_scatter_loop << " s, batched "
+            << t_scatter << " s, coloured " << t_scatter_col << " s" << std::endl;
+  std::cout << "scatter_add (sparse matrix)  : new pattern " << t_sparse_first
+            << " s, batched " << t_sparse << " s, coloured " << t_sparse_col << " s" << std::endl;
+
+  return 0;
+}
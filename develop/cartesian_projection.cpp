@@ -0,0 +1,125 @@
+
+#include "support.h"
+
+typedef cppmat::cartesian::tensor4 <double> T4;
+typedef cppmat::cartesian::tensor2 <double> T2;
+typedef cppmat::cartesian::tensor2s<double> T2s;
+
+namespace P = cppmat::cartesian::projection;
+
+// =================================================================================================
+
+// reference: dense projection tensors, from their definition
+static T4 reference(const std::string &name, size_t nd)
+{
+  T4 out = T4::Zero(nd);
+
+  double n = static_cast<double>(nd);
+
+  for ( size_t i = 0 ; i < nd ; ++i ) {
+    for ( size_t j = 0 ; j < nd ; ++j ) {
+      for ( size_t k = 0 ; k < nd ; ++k ) {
+        for ( size_t l = 0 ; l < nd ; ++l ) {
+          double I   = ( i == l and j == k ) ? 1. : 0.;
+          double Irt = ( i == k and j == l ) ? 1. : 0.;
+          double II  = ( i == j and k == l ) ? 1. : 0.;
+          if      ( name == "I"   ) out(i,j,k,l) = I;
+          else if ( name == "Irt" ) out(i,j,k,l) = Irt;
+          else if ( name == "Is"  ) out(i,j,k,l) = ( I + Irt ) / 2.;
+          else if ( name == "II"  ) out(i,j,k,l) = II;
+          else if ( name == "Id"  ) out(i,j,k,l) = I - II / n;
+          else if ( name == "Isd" ) out(i,j,k,l) = ( I + Irt ) / 2. - II / n;
+        }
+      }
+    }
+  }
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class Tag>
+static void check(const Tag &p, const std::string &name, size_t nd)
+{
+  T4  R  = reference(name, nd);
+  T4  A4 = T4 ::Random(nd);
+  T2  A2 = T2 ::Random(nd);
+  T2s As = T2s::Random(nd);
+
+  Equal(P::dense<double>(p, nd), R);
+
+  Equal(cppmat::cartesian::ddot(p, A4), R.ddot(A4));
+  Equal(cppmat::cartesian::ddot(A4, p), A4.ddot(R));
+  Equal(cppmat::cartesian::ddot(p, A2), R.ddot(A2));
+  Equal(cppmat::cartesian::ddot(A2, p), A2.ddot(R));
+  Equal(cppmat::cartesian::ddot(p, As), R.ddot(As));
+  Equal(cppmat::cartesian::ddot(As, p), As.ddot(R));
+
+  // fixed size
+  if ( nd != 3 ) return;
+
+  cppmat::tiny::cartesian::tensor4 <double,3> a4 = A4;
+  cppmat::tiny::cartesian::tensor2 <double,3> a2 = A2;
+  cppmat::tiny::cartesian::tensor2s<double,3> as = As;
+
+  Equal(T4 (cppmat::cartesian::ddot(p, a4)), R.ddot(A4));
+  Equal(T4 (cppmat::cartesian::ddot(a4, p)), A4.ddot(R));
+  Equal(T2 (cppmat::cartesian::ddot(p, a2)), R.ddot(A2));
+  Equal(T2 (cppmat::cartesian::ddot(a2, p)), A2.ddot(R));
+  Equal(T2s(cppmat::cartesian::ddot(p, as)), R.ddot(As));
+  Equal(T2s(cppmat::cartesian::ddot(as, p)), As.ddot(R));
+}
+
+// =================================================================================================
+
+TEST_CASE("cppmat::cartesian::projection", "cartesian_projection.h")
+{
+
+// =================================================================================================
+
+SECTION( "ddot, dense: compared to the dense reference" )
+{
+  for ( size_t nd : {2, 3} )
+  {
+    check(P::I  (), "I"  , nd);
+    check(P::Irt(), "Irt", nd);
+    check(P::Is (), "Is" , nd);
+    check(P::II (), "II" , nd);
+    check(P::Id (), "Id" , nd);
+    check(P::Isd(), "Isd", nd);
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "dense: references stay valid when other dimensions are cached" )
+{
+  const T4 &A = P::dense<double>(P::Isd(), 2);
+  const T4 &B = P::dense<double>(P::Isd(), 3);
+  const T4 &C = P::dense<double>(P::Isd(), 5);
+  const T4 &D = P::dense<double>(P::Isd(), 2);
+
+  REQUIRE( &A == &D );
+
+  Equal(A, reference("Isd", 2));
+  Equal(B, reference("Isd", 3));
+  Equal(C, reference("Isd", 5));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "tensor4: named constructors" )
+{
+  Equal(T4::Is (3), reference("Is" , 3));
+  Equal(T4::Id (3), reference("Id" , 3));
+  Equal(T4::Isd(3), reference("Isd", 3));
+
+  cppmat::tiny::cartesian::tensor4<double,2> a = cppmat::tiny::cartesian::tensor4<double,2>::Isd();
+
+  Equal(T4(a), reference("Isd", 2));
+}
+
+// =================================================================================================
+
+}
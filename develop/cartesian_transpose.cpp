@@ -0,0 +1,131 @@
+
+#include "support.h"
+
+typedef cppmat::cartesian::tensor4<double> T4;
+typedef cppmat::cartesian::tensor2<double> T2;
+typedef cppmat::cartesian::vector <double> V;
+
+namespace L = cppmat::cartesian::lazy;
+
+// =================================================================================================
+
+TEST_CASE("cppmat::cartesian::lazy", "cartesian_transpose.h")
+{
+
+// =================================================================================================
+
+SECTION( "index operator: compared to the transposed tensor" )
+{
+  T4 A = T4::Random(3);
+  T2 a = T2::Random(3);
+
+  T4 At = A.T(), Ar = A.RT(), Al = A.LT();
+  T2 at = a.T();
+
+  for ( size_t i = 0 ; i < 3 ; ++i ) {
+    for ( size_t j = 0 ; j < 3 ; ++j ) {
+      EQ( L::T(a)(i,j), at(i,j) );
+      for ( size_t k = 0 ; k < 3 ; ++k ) {
+        for ( size_t l = 0 ; l < 3 ; ++l ) {
+          EQ( L::T (A)(i,j,k,l), At(i,j,k,l) );
+          EQ( L::RT(A)(i,j,k,l), Ar(i,j,k,l) );
+          EQ( L::LT(A)(i,j,k,l), Al(i,j,k,l) );
+        }
+      }
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "tensor products: compared to the transposed tensor, ND = 1, 2, 3, 4" )
+{
+  for ( size_t nd = 1 ; nd <= 4 ; ++nd )
+  {
+    T4 A = T4::Random(nd);
+    T4 B = T4::Random(nd);
+    T2 a = T2::Random(nd);
+    T2 b = T2::Random(nd);
+    V  v = V ::Random(nd);
+
+    std::vector<L::tensor4<double>> LA = {L::T(A), L::RT(A), L::LT(A)};
+    std::vector<L::tensor4<double>> LB = {L::T(B), L::RT(B), L::LT(B)};
+    std::vector<T4>                 EA = {A.T(), A.RT(), A.LT()};
+    std::vector<T4>                 EB = {B.T(), B.RT(), B.LT()};
+
+    for ( size_t p = 0 ; p < 3 ; ++p )
+    {
+      Equal(cppmat::cartesian::ddot(LA[p], B), EA[p].ddot(B));
+      Equal(cppmat::cartesian::ddot(A, LB[p]), A.ddot(EB[p]));
+      Equal(cppmat::cartesian::ddot(LA[p], b), EA[p].ddot(b));
+      Equal(cppmat::cartesian::ddot(a, LB[p]), a.ddot(EB[p]));
+
+      for ( size_t q = 0 ; q < 3 ; ++q )
+        Equal(cppmat::cartesian::ddot(LA[p], LB[q]), EA[p].ddot(EB[q]));
+    }
+
+    Equal(cppmat::cartesian::ddot(A, L::T(b)), A.ddot(b.T()));
+    Equal(cppmat::cartesian::ddot(L::T(a), B), a.T().ddot(B));
+    Equal(cppmat::cartesian::dot (L::T(a), b), a.T().dot(b));
+    Equal(cppmat::cartesian::dot (a, L::T(b)), a.dot(b.T()));
+    Equal(cppmat::cartesian::dot (L::T(a), v), a.T().dot(v));
+    Equal(cppmat::cartesian::dot (v, L::T(a)), v.dot(a.T()));
+
+    EQ( cppmat::cartesian::ddot(L::T(a), b), a.T().ddot(b) );
+    EQ( cppmat::cartesian::ddot(a, L::T(b)), a.ddot(b.T()) );
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "tensor products: fixed size and view" )
+{
+  typedef cppmat::tiny::cartesian::tensor4<double,3> t4;
+  typedef cppmat::tiny::cartesian::tensor2<double,3> t2;
+  typedef cppmat::tiny::cartesian::vector <double,3> v;
+
+  T4 A = T4::Random(3);
+  T4 B = T4::Random(3);
+  T2 a = T2::Random(3);
+  T2 b = T2::Random(3);
+  V  u = V ::Random(3);
+
+  t4 A3 = A, B3 = B;
+  t2 a3 = a, b3 = b;
+  v  u3 = u;
+
+  cppmat::view::cartesian::tensor4<double,3> Av = cppmat::view::cartesian::tensor4<double,3>::Map(A.data());
+  cppmat::view::cartesian::tensor2<double,3> av = cppmat::view::cartesian::tensor2<double,3>::Map(a.data());
+
+  Equal(T4(cppmat::cartesian::ddot(L::T (A3), B3)), A.T ().ddot(B));
+  Equal(T4(cppmat::cartesian::ddot(A3, L::RT(B3))), A.ddot(B.RT()));
+  Equal(T4(cppmat::cartesian::ddot(L::LT(Av), L::T(B3))), A.LT().ddot(B.T()));
+  Equal(T2(cppmat::cartesian::ddot(L::RT(A3), b3)), A.RT().ddot(b));
+  Equal(T2(cppmat::cartesian::ddot(a3, L::LT(B3))), a.ddot(B.LT()));
+  Equal(T2(cppmat::cartesian::ddot(A3, L::T(b3))), A.ddot(b.T()));
+  Equal(T2(cppmat::cartesian::ddot(L::T(av), B3)), a.T().ddot(B));
+  Equal(T2(cppmat::cartesian::dot (L::T(av), b3)), a.T().dot(b));
+  Equal(T2(cppmat::cartesian::dot (a3, L::T(b3))), a.dot(b.T()));
+  Equal(V (cppmat::cartesian::dot (L::T(a3), u3)), a.T().dot(u));
+  Equal(V (cppmat::cartesian::dot (u3, L::T(a3))), u.dot(a.T()));
+
+  EQ( cppmat::cartesian::ddot(L::T(a3), b3), a.T().ddot(b) );
+  EQ( cppmat::cartesian::ddot(a3, L::T(b3)), a.ddot(b.T()) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "output argument" )
+{
+  T4 A = T4::Random(3);
+  T4 B = T4::Random(3);
+  T4 C;
+
+  cppmat::cartesian::ddot(L::T(A), B, C);
+
+  Equal(C, A.T().ddot(B));
+}
+
+// =================================================================================================
+
+}
@@ -0,0 +1,182 @@
+
+#include "support.h"
+
+typedef cppmat::array<double> Arr;
+
+typedef cppmat::cartesian::tensor4<double> T4;
+typedef cppmat::cartesian::tensor2<double> T2;
+
+// =================================================================================================
+
+TEST_CASE("cppmat::einsum", "einsum.h")
+{
+
+// =================================================================================================
+// cppmat::array
+// =================================================================================================
+
+SECTION( "matrix product, transpose, trace, diagonal, sum" )
+{
+  Arr A = Arr::Random({4,5});
+  Arr B = Arr::Random({5,3});
+  Arr S = Arr::Random({4,4});
+
+  Arr C = cppmat::einsum("ij,jk->ik", A, B);
+  Arr D = cppmat::einsum("ij,jk", A, B);
+  Arr E = cppmat::einsum("ji->ij", A);
+  Arr t = cppmat::einsum("ii->", S);
+  Arr d = cppmat::einsum("ii->i", S);
+  Arr s = cppmat::einsum("ij->j", A);
+
+  REQUIRE( C.shape() == std::vector<size_t>({4,3}) );
+  REQUIRE( E.shape() == std::vector<size_t>({5,4}) );
+  REQUIRE( t.shape() == std::vector<size_t>({1}) );
+
+  double tr = 0.;
+
+  for ( size_t i = 0 ; i < 4 ; ++i )
+  {
+    tr += S(i,i);
+
+    EQ( d(i), S(i,i) );
+
+    for ( size_t k = 0 ; k < 3 ; ++k )
+    {
+      double c = 0.;
+      for ( size_t j = 0 ; j < 5 ; ++j )
+        c += A(i,j) * B(j,k);
+
+      EQ( C(i,k), c );
+      EQ( D(i,k), c );
+    }
+
+    for ( size_t j = 0 ; j < 5 ; ++j )
+      EQ( E(j,i), A(i,j) );
+  }
+
+  EQ( t(0), tr );
+
+  for ( size_t j = 0 ; j < 5 ; ++j )
+  {
+    double c = 0.;
+    for ( size_t i = 0 ; i < 4 ; ++i )
+      c += A(i,j);
+
+    EQ( s(j), c );
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "batched product, outer product, labels summed in one operand" )
+{
+  Arr A = Arr::Random({3,4,2,5});
+  Arr B = Arr::Random({5,3,6});
+
+  // "b" is a batch label, "j" is only in "A"
+  Arr C = cppmat::einsum("bjik,kbl->bli", A, B);
+
+  REQUIRE( C.shape() == std::vector<size_t>({3,6,2}) );
+
+  for ( size_t b = 0 ; b < 3 ; ++b ) {
+    for ( size_t l = 0 ; l < 6 ; ++l ) {
+      for ( size_t i = 0 ; i < 2 ; ++i ) {
+        double c = 0.;
+        for ( size_t j = 0 ; j < 4 ; ++j )
+          for ( size_t k = 0 ; k < 5 ; ++k )
+            c += A(b,j,i,k) * B(k,b,l);
+        EQ( C(b,l,i), c );
+      }
+    }
+  }
+
+  Arr u = Arr::Random({3});
+  Arr v = Arr::Random({4});
+  Arr w = cppmat::einsum("i,j->ij", u, v);
+
+  for ( size_t i = 0 ; i < 3 ; ++i )
+    for ( size_t j = 0 ; j < 4 ; ++j )
+      EQ( w(i,j), u(i) * v(j) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "tensors, multiple operands" )
+{
+  T4 A = T4::Random(3);
+  T4 B = T4::Random(3);
+  T2 E = T2::Random(3);
+
+  Equal(T4(cppmat::einsum("ijkl,lkmn->ijmn", A, B)), A.ddot(B));
+  Equal(T2(cppmat::einsum("ijkl,lk->ij"    , A, E)), A.ddot(E));
+
+  // chain rule: "A : B : E", in any order of the operands
+  Equal(T2(cppmat::einsum("ijkl,lkmn,nm->ij", A, B, E)), A.ddot(B).ddot(E));
+  Equal(T2(cppmat::einsum("nm,ijkl,lkmn->ij", E, A, B)), A.ddot(B).ddot(E));
+
+  // full contraction
+  Arr c = cppmat::einsum("ij,jk,ki", E, E, E);
+
+  EQ( c(0), E.dot(E).ddot(E) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "invalid subscripts" )
+{
+  Arr A = Arr::Random({3,4});
+
+  REQUIRE_THROWS( cppmat::einsum("ijk->ij", A) );
+  REQUIRE_THROWS( cppmat::einsum("ij,jk->ik", A, A) );
+  REQUIRE_THROWS( cppmat::einsum("ij->ik", A) );
+  REQUIRE_THROWS( cppmat::einsum("i1->i", A) );
+}
+
+// =================================================================================================
+// cppmat::tiny
+// =================================================================================================
+
+SECTION( "tiny: compile-time subscripts" )
+{
+  cppmat::tiny::matrix<double,4,5> A = cppmat::tiny::matrix<double,4,5>::Random();
+  cppmat::tiny::matrix<double,5,3> B = cppmat::tiny::matrix<double,5,3>::Random();
+
+  auto C = cppmat::einsum(CPPMAT_SUBSCRIPTS("ij,jk->ik"), A, B);
+  auto D = cppmat::einsum(CPPMAT_SUBSCRIPTS("ij->ji"), A);
+  auto t = cppmat::einsum(CPPMAT_SUBSCRIPTS("ij,ij"), A, A);
+
+  static_assert( std::is_same<decltype(C), cppmat::tiny::array<double,2,4,3>>::value, "type" );
+  static_assert( std::is_same<decltype(D), cppmat::tiny::array<double,2,5,4>>::value, "type" );
+  static_assert( std::is_same<decltype(t), cppmat::tiny::array<double,1,1  >>::value, "type" );
+
+  Arr c = cppmat::einsum("ij,jk->ik", Arr(A), Arr(B));
+
+  for ( size_t i = 0 ; i < c.size() ; ++i )
+    EQ( C[i], c[i] );
+
+  double n = 0.;
+
+  for ( size_t i = 0 ; i < 4 ; ++i ) {
+    for ( size_t j = 0 ; j < 5 ; ++j ) {
+      EQ( D(j,i), A(i,j) );
+      n += A(i,j) * A(i,j);
+    }
+  }
+
+  EQ( t[0], n );
+
+  // tensors
+  typedef cppmat::tiny::cartesian::tensor4<double,3> t4;
+  typedef cppmat::tiny::cartesian::tensor2<double,3> t2;
+
+  t4 a = t4::Random();
+  t2 e = t2::Random();
+
+  t2 f = cppmat::einsum(CPPMAT_SUBSCRIPTS("ijkl,lk->ij"), a, e);
+
+  Equal(f, a.ddot(e));
+}
+
+// =================================================================================================
+
+}
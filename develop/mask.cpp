@@ -0,0 +1,146 @@
+
+#include "support.h"
+
+typedef cppmat::array<double> Arr;
+typedef cppmat::array<int>    Int;
+
+// =================================================================================================
+
+inline void Same(const cppmat::mask &m, const Int &A)
+{
+  REQUIRE( m.shape() == A.shape() );
+
+  Int B = m.as<int>();
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    REQUIRE( B[i] == A[i] );
+}
+
+// =================================================================================================
+
+TEST_CASE("cppmat::mask", "mask.h")
+{
+
+// =================================================================================================
+
+SECTION( "comparison, against \"cppmat::array\"" )
+{
+  // shapes that do not fill the last word
+  std::vector<std::vector<size_t>> shapes = {{1}, {63}, {64}, {65}, {11,13}, {4,5,7}};
+
+  for ( auto &shape : shapes )
+  {
+    Arr A = Arr::Random(shape);
+    Arr B = Arr::Random(shape);
+
+    Same(cppmat::mask::Greater     (A, .5), A.greater      (.5));
+    Same(cppmat::mask::GreaterEqual(A, .5), A.greater_equal(.5));
+    Same(cppmat::mask::Less        (A, .5), A.less         (.5));
+    Same(cppmat::mask::LessEqual   (A, .5), A.less_equal   (.5));
+    Same(cppmat::mask::Equal       (A, A ), A.equal        (A ));
+    Same(cppmat::mask::NotEqual    (A, B ), A.not_equal    (B ));
+    Same(cppmat::mask::Greater     (A, B ), A.greater      (B ));
+    Same(cppmat::mask::Less        (A, B ), A.less         (B ));
+
+    cppmat::mask m = cppmat::mask::Greater(A, .5);
+
+    REQUIRE( m.count() == static_cast<size_t>(A.greater(.5).sum()) );
+    REQUIRE( m.where() == A.greater(.5).where() );
+    REQUIRE( m.size()  == A.size() );
+    REQUIRE( m.shape() == A.shape() );
+
+    cppmat::mask n = ~m;
+
+    REQUIRE( n.count() == m.size() - m.count() );
+    REQUIRE( ( m & n ).count() == 0 );
+    REQUIRE( ( m | n ).all() );
+    REQUIRE( ( m ^ m ).any() == false );
+    REQUIRE( cppmat::mask(A.greater(.5)) == m );
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "get/set, initialize" )
+{
+  cppmat::mask m({3,50});
+
+  REQUIRE( m.words() == 3 );
+  REQUIRE( not m.any() );
+
+  m.set(0);
+  m.set(64);
+  m.set(149);
+  m.set(64, false);
+
+  REQUIRE( m[0] );
+  REQUIRE( not m[64] );
+  REQUIRE( m[149] );
+  REQUIRE( m.count() == 2 );
+  REQUIRE( m.where() == std::vector<size_t>({0,149}) );
+
+  m.setOnes();
+
+  REQUIRE( m.all() );
+  REQUIRE( m.count() == 150 );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "select, putmask" )
+{
+  Arr A = Arr::Random({7,19});
+  Arr B = Arr::Random({7,19});
+
+  cppmat::mask m = cppmat::mask::Greater(A, B);
+
+  Arr C = cppmat::select(m, A, B);
+  Arr D = cppmat::select(m, A, 0.);
+  Arr E = A;
+  Arr F = A;
+
+  cppmat::putmask(E, ~m, 0.);
+  cppmat::putmask(F, ~m, B);
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+  {
+    EQ( C[i], std::max(A[i], B[i]) );
+    EQ( F[i], std::max(A[i], B[i]) );
+    EQ( D[i], A[i] > B[i] ? A[i] : 0. );
+    EQ( E[i], A[i] > B[i] ? A[i] : 0. );
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "masked reductions" )
+{
+  Arr A = Arr::Random({200});
+
+  cppmat::mask m = cppmat::mask::Less(A, .5);
+
+  double sum = 0.0;
+  double min = 1.0;
+  double max = 0.0;
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+  {
+    if ( A[i] < .5 )
+    {
+      sum += A[i];
+      min  = std::min(min, A[i]);
+      max  = std::max(max, A[i]);
+    }
+  }
+
+  EQ( cppmat::masked_sum (A, m), sum );
+  EQ( cppmat::masked_mean(A, m), sum / static_cast<double>(m.count()) );
+  EQ( cppmat::masked_min (A, m), min );
+  EQ( cppmat::masked_max (A, m), max );
+
+  REQUIRE_THROWS( cppmat::masked_min(A, cppmat::mask(A.shape())) );
+}
+
+// =================================================================================================
+
+}
@@ -0,0 +1,274 @@
+
+#include "support.h"
+
+typedef cppmat::array<double> Arr;
+
+// =================================================================================================
+
+// reference: central moments in two passes
+inline std::vector<double> Moments(const std::vector<double> &x, const std::vector<double> &w)
+{
+  double W = 0, m = 0, m2 = 0, m3 = 0, m4 = 0;
+
+  for ( size_t i = 0 ; i < x.size() ; ++i ) { W += w[i]; m += w[i] * x[i]; }
+
+  m /= W;
+
+  for ( size_t i = 0 ; i < x.size() ; ++i ) {
+    double d = x[i] - m;
+    m2 += w[i] * d * d / W;
+    m3 += w[i] * d * d * d / W;
+    m4 += w[i] * d * d * d * d / W;
+  }
+
+  return {m, m2, m3 / std::pow(m2, 1.5), m4 / ( m2 * m2 ) - 3.};
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline std::vector<double> Moments(const std::vector<double> &x)
+{
+  return Moments(x, std::vector<double>(x.size(), 1.));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline void Check(const cppmat::moments &M, const std::vector<double> &ref)
+{
+  EQ(M.mean()    , ref[0]);
+  EQ(M.var()     , ref[1]);
+  EQ(M.skewness(), ref[2]);
+  EQ(M.kurtosis(), ref[3]);
+}
+
+// =================================================================================================
+
+TEST_CASE("cppmat::moments", "moments.h")
+{
+
+// =================================================================================================
+
+SECTION( "scalar: push, and merge" )
+{
+  Arr A = Arr::Random({1000}, -1., 3.);
+
+  std::vector<double> x(A.begin(), A.end());
+
+  // single pass
+  cppmat::moments M;
+
+  M.push(x.begin(), x.end());
+
+  REQUIRE( M.weight() == 1000. );
+
+  Check(M, Moments(x));
+
+  EQ(M.var(1.), Moments(x)[1] * 1000. / 999.);
+  EQ(M.stddev(), std::sqrt(M.var()));
+
+  // merge chunks of different size
+  cppmat::moments a, b, c;
+
+  a.push(x.begin()    , x.begin()+1  );
+  b.push(x.begin()+1  , x.begin()+377);
+  c.push(x.begin()+377, x.end()      );
+
+  Check(a + b + c, Moments(x));
+
+  // merge with empty
+  Check(cppmat::moments() + M, Moments(x));
+  Check(M + cppmat::moments(), Moments(x));
+
+  // large offset: no cancellation (as for the naive "sum(x^2)/n - mean^2")
+  std::vector<double> y = x;
+
+  for ( auto &i : y )
+    i += 1.e9;
+
+  cppmat::moments L;
+
+  L.push(y.begin(), y.end());
+
+  REQUIRE( std::abs(L.var() - Moments(y)[1]) < 1.e-6 * Moments(y)[1] );
+}
+
+// =================================================================================================
+
+SECTION( "scalar: weighted" )
+{
+  Arr A = Arr::Random({500});
+  Arr W = Arr::Random({500}, 0., 2.);
+
+  std::vector<double> x(A.begin(), A.end());
+  std::vector<double> w(W.begin(), W.end());
+
+  // single pass
+  cppmat::moments M;
+
+  for ( size_t i = 0 ; i < x.size() ; ++i )
+    M.push(x[i], w[i]);
+
+  Check(M, Moments(x, w));
+
+  // merge
+  cppmat::moments a, b;
+
+  for ( size_t i = 0   ; i < 123      ; ++i ) a.push(x[i], w[i]);
+  for ( size_t i = 123 ; i < x.size() ; ++i ) b.push(x[i], w[i]);
+
+  Check(a + b, Moments(x, w));
+
+  // integer weights are equivalent to repeated values
+  cppmat::moments R, S;
+
+  for ( size_t i = 0 ; i < 20 ; ++i ) {
+    R.push(x[i], 3.);
+    S.push(x[i]); S.push(x[i]); S.push(x[i]);
+  }
+
+  EQ(R.mean()    , S.mean()    );
+  EQ(R.var()     , S.var()     );
+  EQ(R.skewness(), S.skewness());
+  EQ(R.kurtosis(), S.kurtosis());
+}
+
+// =================================================================================================
+
+SECTION( "cppmat::array : global, and along an axis" )
+{
+  // larger than one block (of the multi-threaded reduction)
+  Arr A = Arr::Random({11,13,101});
+
+  Check(A.moments(), Moments(std::vector<double>(A.begin(), A.end())));
+
+  EQ(A.var(), A.moments().var());
+  EQ(A.stddev(), std::sqrt(A.var()));
+
+  for ( int axis = 0 ; axis < 3 ; ++axis )
+  {
+    Arr V = A.var     (axis);
+    Arr S = A.skewness(axis);
+    Arr K = A.kurtosis(axis);
+    Arr D = A.stddev  (axis);
+
+    REQUIRE( V.shape() == A.sum(axis).shape() );
+
+    Arr mean = A.mean(axis);
+
+    // reference for each lane
+    cppmat::multi_index<> idx(V.shape());
+
+    for ( ; not idx.end() ; ++idx )
+    {
+      std::vector<double> x;
+
+      for ( size_t k = 0 ; k < A.shape(axis) ; ++k ) {
+        std::vector<size_t> i(idx.index());
+        i.insert(i.begin()+axis, k);
+        x.push_back(A.at(i.begin(), i.end()));
+      }
+
+      std::vector<double> ref = Moments(x);
+
+      EQ(mean[idx.flat()], ref[0]);
+      EQ(V   [idx.flat()], ref[1]);
+      EQ(S   [idx.flat()], ref[2]);
+      EQ(K   [idx.flat()], ref[3]);
+      EQ(D   [idx.flat()], std::sqrt(ref[1]));
+    }
+
+    // negative axis
+    Equal(A.var(axis-3), V);
+  }
+}
+
+// =================================================================================================
+
+SECTION( "cppmat::array : along a list of axes, merge of chunks" )
+{
+  Arr A = Arr::Random({6,5,7,4});
+
+  // list of axes, against an explicit loop
+  Arr V = A.var({0,2});
+  Arr M = A.mean({0,2});
+
+  REQUIRE( V.shape() == cppmat::shape_t({5,4}) );
+
+  for ( size_t j = 0 ; j < 5 ; ++j ) {
+    for ( size_t l = 0 ; l < 4 ; ++l ) {
+      std::vector<double> x;
+      for ( size_t i = 0 ; i < 6 ; ++i )
+        for ( size_t k = 0 ; k < 7 ; ++k )
+          x.push_back(A(i,j,k,l));
+      EQ(V(j,l), Moments(x)[1]);
+      EQ(M(j,l), Moments(x)[0]);
+    }
+  }
+
+  // chunks along the first axis (e.g. realisations), merged lane-by-lane
+  Arr a = A.slice({0,1}      , {}, {}, {});
+  Arr b = A.slice({2,3,4,5}  , {}, {}, {});
+
+  cppmat::array<cppmat::moments> Ma = a.moments(0);
+  cppmat::array<cppmat::moments> Mb = b.moments(0);
+  cppmat::array<cppmat::moments> Mc = A.moments(0);
+
+  for ( size_t i = 0 ; i < Mc.size() ; ++i ) {
+    EQ((Ma[i]+Mb[i]).var()     , Mc[i].var()     );
+    EQ((Ma[i]+Mb[i]).kurtosis(), Mc[i].kurtosis());
+  }
+}
+
+// =================================================================================================
+
+SECTION( "cppmat::array : weighted, consistent with \"average\"" )
+{
+  Arr A = Arr::Random({8,9,10});
+  Arr W = Arr::Random({8,9,10}, .1, 1.);
+
+  // global
+  double mean = A.average(W);
+
+  EQ(A.moments(W).mean(), mean);
+  EQ(A.var(W), ((A-mean)*(A-mean)).average(W));
+
+  // along an axis / axes
+  for ( int axis = 0 ; axis < 3 ; ++axis )
+  {
+    Arr m = A.average(W, axis);
+    Arr V = A.var(W, axis);
+    Arr R = Arr::Zero(A.shape());
+
+    // "(A - m)^2", with "m" broadcasted along "axis"
+    cppmat::multi_index<> idx(A.shape(), {cppmat::Private::reduce_strides(m.strides(), static_cast<size_t>(axis))});
+
+    for ( size_t i = 0 ; i < A.size() ; ++i, ++idx )
+      R[i] = ( A[i] - m[idx.offset()] ) * ( A[i] - m[idx.offset()] );
+
+    Equal(V, R.average(W, axis));
+  }
+
+  Equal(A.var(W, std::vector<int>{1}), A.var(W, 1));
+}
+
+// =================================================================================================
+
+SECTION( "cppmat::array<int> : \"double\" along axes, as the global result" )
+{
+  cppmat::array<int> A({2,3});
+
+  A.setArange();
+
+  cppmat::array<double> V = A.var(1);
+  cppmat::array<double> S = A.stddev(1);
+
+  EQ(V(0), 2./3.);
+  EQ(V(1), 2./3.);
+  EQ(S(0), std::sqrt(2./3.));
+  EQ(A.var(), A.moments().var());
+  Equal(A.var(std::vector<int>{1}), V);
+}
+
+// =================================================================================================
+
+}
@@ -0,0 +1,145 @@
+
+#include "support.h"
+
+typedef cppmat::array<double> Arr;
+
+// =================================================================================================
+
+TEST_CASE("cppmat::multi_index", "multi_index.h")
+{
+
+// =================================================================================================
+
+SECTION( "contiguous: equivalent to \"decompress\"" )
+{
+  std::vector<std::vector<size_t>> shapes = {{7}, {3,4}, {2,3,4}, {2,1,3,2,2,3}};
+
+  for ( auto &shape : shapes )
+  {
+    Arr A = Arr::Arange(shape);
+
+    cppmat::multi_index<> idx(A.shape());
+
+    REQUIRE( idx.size() == A.size() );
+    REQUIRE( idx.rank() == A.rank() );
+
+    for ( size_t i = 0 ; i < A.size() ; ++i, ++idx )
+    {
+      REQUIRE( not idx.end() );
+      REQUIRE( idx.flat() == i );
+      REQUIRE( idx.offset() == i );
+      REQUIRE( std::vector<size_t>(idx.index()) == A.decompress(i) );
+    }
+
+    REQUIRE( idx.end() );
+
+    // all axes have wrapped
+    REQUIRE( idx.offset() == 0 );
+
+    for ( size_t i = 0 ; i < idx.rank() ; ++i )
+      REQUIRE( idx.index(i) == 0 );
+  }
+}
+
+// =================================================================================================
+
+SECTION( "strided view, and multiple operands" )
+{
+  Arr A = Arr::Random({5,6,7});
+
+  // the block "A[1:4,2:6:2,3:7]", and its contiguous copy "B"
+  cppmat::shape_t shape   = {3,2,4};
+  cppmat::shape_t strides = {42,14,1};
+  size_t          start   = 1*42 + 2*7 + 3;
+
+  Arr B = Arr::Zero(shape);
+
+  for ( size_t i = 0 ; i < 3 ; ++i )
+    for ( size_t j = 0 ; j < 2 ; ++j )
+      for ( size_t k = 0 ; k < 4 ; ++k )
+        B(i,j,k) = A(1+i,2+2*j,3+k);
+
+  cppmat::multi_index<2> idx(shape, {strides, B.strides()}, {start, 0});
+
+  size_t n = 0;
+
+  for ( ; not idx.end() ; ++idx, ++n ) {
+    REQUIRE( idx.offset(1) == idx.flat() );
+    REQUIRE( A[idx.offset(0)] == B[idx.offset(1)] );
+  }
+
+  REQUIRE( n == B.size() );
+
+  // reset
+  idx.reset();
+
+  REQUIRE( not idx.end() );
+  REQUIRE( idx.offset(0) == start );
+}
+
+// =================================================================================================
+
+SECTION( "edge cases: rank zero, and zero size" )
+{
+  cppmat::multi_index<> a(cppmat::shape_t{});
+
+  REQUIRE( a.size() == 1 );
+  REQUIRE( not a.end() );
+  REQUIRE( (++a).end() );
+
+  cppmat::multi_index<> b(cppmat::shape_t{3,0,2});
+
+  REQUIRE( b.size() == 0 );
+  REQUIRE( b.end() );
+}
+
+// =================================================================================================
+
+SECTION( "used by: reductions along an axis, slice, pad" )
+{
+  Arr A = Arr::Random({3,4,5});
+
+  // reductions, against an explicit loop
+  for ( size_t axis = 0 ; axis < 3 ; ++axis )
+  {
+    Arr S = A.sum(axis);
+    Arr L = A.min(axis);
+    Arr U = A.max(axis);
+
+    cppmat::multi_index<> idx(A.shape());
+
+    for ( size_t i = 0 ; i < A.size() ; ++i, ++idx )
+    {
+      std::vector<size_t> j = cppmat::del(std::vector<size_t>(idx.index()), axis);
+
+      REQUIRE( L.at(j.begin(), j.end()) <= A[i] );
+      REQUIRE( U.at(j.begin(), j.end()) >= A[i] );
+    }
+
+    EQ(S.sum(), A.sum());
+  }
+
+  // slice
+  Arr B = A.slice({0,2}, {}, {-1});
+
+  REQUIRE( B.shape() == cppmat::shape_t({2,4}) );
+
+  for ( size_t i = 0 ; i < 2 ; ++i )
+    for ( size_t j = 0 ; j < 4 ; ++j )
+      REQUIRE( B(i,j) == A(2*i,j,4) );
+
+  // pad
+  Arr P = A.pad({1,0,2}, -1.);
+
+  REQUIRE( P.shape() == cppmat::shape_t({5,4,9}) );
+  EQ(P.sum(), A.sum() - static_cast<double>(P.size()-A.size()));
+
+  for ( size_t i = 0 ; i < 3 ; ++i )
+    for ( size_t j = 0 ; j < 4 ; ++j )
+      for ( size_t k = 0 ; k < 5 ; ++k )
+        REQUIRE( P(1+i,j,2+k) == A(i,j,k) );
+}
+
+// =================================================================================================
+
+}
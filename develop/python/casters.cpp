@@ -0,0 +1,94 @@
+#include "../../src/cppmat/pybind11.h"
+
+// =================================================================================================
+// Python module with functions that pass their argument through the type casters, used by
+// "test_casters.py"
+// =================================================================================================
+
+namespace py = pybind11;
+
+typedef cppmat::view::cartesian::tensor2<double,3> V2;
+typedef cppmat::view::cartesian::tensor4<double,3> V4;
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+void identity(py::module &m, const char *name)
+{
+  m.def(name, [](const T &A) { return A; }, py::arg("A"));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+PYBIND11_MODULE(casters, m)
+{
+
+m.doc() = "Round-trip of the cppmat type casters";
+
+m.attr("bulk") = static_cast<size_t>(CPPMAT_PYBIND11_BULK);
+
+// variable size
+
+identity<cppmat::array<double>>(m, "array");
+identity<cppmat::array<int>>(m, "array_int");
+identity<cppmat::matrix<double>>(m, "matrix");
+identity<cppmat::symmetric::matrix<double>>(m, "symmetric_matrix");
+identity<cppmat::diagonal::matrix<double>>(m, "diagonal_matrix");
+identity<cppmat::cartesian::tensor4<double>>(m, "tensor4");
+identity<cppmat::cartesian::tensor2<double>>(m, "tensor2");
+identity<cppmat::cartesian::tensor2s<double>>(m, "tensor2s");
+identity<cppmat::cartesian::tensor2d<double>>(m, "tensor2d");
+
+// fixed size
+
+identity<cppmat::tiny::array<double,3,2,3,4>>(m, "tiny_array");
+identity<cppmat::tiny::matrix<double,2,3>>(m, "tiny_matrix");
+identity<cppmat::tiny::symmetric::matrix<double,3,3>>(m, "tiny_symmetric_matrix");
+identity<cppmat::tiny::diagonal::matrix<double,3,3>>(m, "tiny_diagonal_matrix");
+identity<cppmat::tiny::cartesian::tensor4<double,3>>(m, "tiny_tensor4");
+identity<cppmat::tiny::cartesian::tensor2<double,3>>(m, "tiny_tensor2");
+identity<cppmat::tiny::cartesian::tensor2s<double,3>>(m, "tiny_tensor2s");
+identity<cppmat::tiny::cartesian::tensor2d<double,3>>(m, "tiny_tensor2d");
+
+// batch of views
+
+m.def("batch_array", [](const cppmat::view::batch<V2> &A) { return A; }, py::arg("A"));
+
+m.def("batch_trace", [](const cppmat::view::batch<V2> &A)
+{
+  py::array_t<double> out(static_cast<py::ssize_t>(A.size()));
+
+  double *o = out.mutable_data();
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    o[i] = A[i](0,0) + A[i](1,1) + A[i](2,2);
+
+  return out;
+}, py::arg("A"));
+
+// read through copies of the batch, after the original is gone
+m.def("batch_copy", [](py::array_t<double> A)
+{
+  cppmat::view::batch<V2> B;
+
+  {
+    cppmat::view::batch<V2> C(py::array_t<double, py::array::c_style>::ensure(A));
+    cppmat::view::batch<V2> D = C;
+    B = D;
+  }
+
+  auto out = cppmat::view::batch<V2>::Empty(B.size());
+
+  double *o = out.mutable_data();
+
+  for ( size_t i = 0 ; i < B.size() ; ++i )
+    for ( size_t j = 0 ; j < 3 ; ++j )
+      for ( size_t k = 0 ; k < 3 ; ++k )
+        o[i*9+j*3+k] = B[i](j,k);
+
+  return out;
+}, py::arg("A"));
+
+m.def("batch_size4", [](const cppmat::view::batch<V4> &A) { return A.size(); }, py::arg("A"));
+
+} // PYBIND11_MODULE
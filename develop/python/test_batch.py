@@ -0,0 +1,109 @@
+import unittest
+import threading
+
+import numpy as np
+
+# module compiled from "cppmat/batch.cpp" (installed as "cppmat.batch")
+import batch
+
+# ==================================================================================================
+
+class Test_batch(unittest.TestCase):
+
+  def setUp(self):
+
+    np.random.seed(0)
+
+  def check(self, items, nd):
+
+    A4 = np.random.random(items + (nd,nd,nd,nd))
+    B4 = np.random.random(items + (nd,nd,nd,nd))
+    A2 = np.random.random(items + (nd,nd)) + 2. * np.eye(nd)
+    B2 = np.random.random(items + (nd,nd))
+    A1 = np.random.random(items + (nd,))
+    B1 = np.random.random(items + (nd,))
+
+    self.assertTrue(np.allclose(batch.ddot44  (A4, B4), np.einsum('...ijkl,...lkmn->...ijmn', A4, B4)))
+    self.assertTrue(np.allclose(batch.ddot42  (A4, B2), np.einsum('...ijkl,...lk->...ij', A4, B2)))
+    self.assertTrue(np.allclose(batch.ddot24  (A2, B4), np.einsum('...ij,...jikl->...kl', A2, B4)))
+    self.assertTrue(np.allclose(batch.ddot22  (A2, B2), np.einsum('...ij,...ji->...', A2, B2)))
+    self.assertTrue(np.allclose(batch.dot22   (A2, B2), np.einsum('...ij,...jk->...ik', A2, B2)))
+    self.assertTrue(np.allclose(batch.dot21   (A2, B1), np.einsum('...ij,...j->...i', A2, B1)))
+    self.assertTrue(np.allclose(batch.dot12   (A1, B2), np.einsum('...i,...ij->...j', A1, B2)))
+    self.assertTrue(np.allclose(batch.dot11   (A1, B1), np.einsum('...i,...i->...', A1, B1)))
+    self.assertTrue(np.allclose(batch.dyadic22(A2, B2), np.einsum('...ij,...kl->...ijkl', A2, B2)))
+    self.assertTrue(np.allclose(batch.dyadic11(A1, B1), np.einsum('...i,...j->...ij', A1, B1)))
+
+    self.assertTrue(np.allclose(batch.inv  (A2), np.linalg.inv(A2)))
+    self.assertTrue(np.allclose(batch.det  (A2), np.linalg.det(A2)))
+    self.assertTrue(np.allclose(batch.trace(A2), np.trace(A2, axis1=-2, axis2=-1)))
+
+    I   = np.eye(nd)
+    dev = A2 - np.trace(A2, axis1=-2, axis2=-1)[..., np.newaxis, np.newaxis] * I / float(nd)
+    self.assertTrue(np.allclose(batch.deviator(A2), dev))
+
+    # eigen-decomposition of the symmetric part: "A v = lambda v", eigenvalues in ascending order
+    S        = ( A2 + np.swapaxes(A2, -1, -2) ) / 2.
+    val, vec = batch.eigs(A2)
+    self.assertEqual(val.shape, items + (nd,))
+    self.assertEqual(vec.shape, items + (nd,nd))
+    self.assertTrue(np.allclose(val, np.linalg.eigvalsh(S)))
+    self.assertTrue(np.allclose(np.einsum('...ij,...jk->...ik', S, vec), vec * val[..., np.newaxis, :]))
+
+  def test_items(self):
+
+    for nd in [2, 3, 4]:
+      self.check((4,5), nd)
+      self.check((7,), nd)
+
+  def test_single(self):
+
+    # a scalar per item has the batch shape as shape
+    A = np.random.random((3,3))
+    B = np.random.random((3,3))
+
+    C = batch.ddot22(A, B)
+    self.assertEqual(C.shape, ())
+    self.assertTrue(np.isclose(C, np.einsum('ij,ji', A, B)))
+
+    self.check((), 3)
+
+  def test_convert(self):
+
+    # non-contiguous and integer input
+    A = np.random.random((3,3,10))
+    B = np.transpose(A, (2,0,1))
+    self.assertTrue(np.allclose(batch.trace(B), np.trace(B, axis1=-2, axis2=-1)))
+
+    A = np.arange(90).reshape(10,3,3)
+    self.assertTrue(np.allclose(batch.trace(A), np.trace(A, axis1=-2, axis2=-1)))
+
+  def test_shape(self):
+
+    with self.assertRaises(RuntimeError):
+      batch.dot22(np.zeros((4,3,3)), np.zeros((5,3,3)))
+
+    with self.assertRaises(RuntimeError):
+      batch.ddot42(np.zeros((4,3,3,3,2)), np.zeros((4,3,3)))
+
+  def test_threads(self):
+
+    A = [np.random.random((1000,3,3)) for i in range(8)]
+    B = [None for i in range(8)]
+
+    def run(i):
+      B[i] = batch.inv(A[i] + 3. * np.eye(3))
+
+    threads = [threading.Thread(target=run, args=(i,)) for i in range(8)]
+
+    for thread in threads: thread.start()
+    for thread in threads: thread.join()
+
+    for a, b in zip(A, B):
+      self.assertTrue(np.allclose(b, np.linalg.inv(a + 3. * np.eye(3))))
+
+# ==================================================================================================
+
+if __name__ == '__main__':
+
+  unittest.main()
@@ -0,0 +1,204 @@
+import unittest
+import threading
+
+import numpy as np
+
+import casters
+
+# ==================================================================================================
+
+def symmetric(n):
+  A = np.random.random((n,n))
+  return A + A.T
+
+def diagonal(n):
+  return np.diag(np.random.random(n))
+
+# ==================================================================================================
+
+class Test_variable(unittest.TestCase):
+
+  def test_roundtrip(self):
+
+    A = np.random.random((2,3,4))
+    self.assertTrue(np.array_equal(casters.array(A), A))
+
+    A = np.random.random((4,5))
+    self.assertTrue(np.array_equal(casters.matrix(A), A))
+
+    A = symmetric(4)
+    self.assertTrue(np.array_equal(casters.symmetric_matrix(A), A))
+
+    A = diagonal(4)
+    self.assertTrue(np.array_equal(casters.diagonal_matrix(A), A))
+
+    A = np.random.random((3,3,3,3))
+    self.assertTrue(np.array_equal(casters.tensor4(A), A))
+
+    A = np.random.random((2,2))
+    self.assertTrue(np.array_equal(casters.tensor2(A), A))
+
+    A = symmetric(3)
+    self.assertTrue(np.array_equal(casters.tensor2s(A), A))
+
+    A = diagonal(3)
+    self.assertTrue(np.array_equal(casters.tensor2d(A), A))
+
+  def test_convert(self):
+
+    # non-contiguous
+    A = np.random.random((6,4))
+    self.assertTrue(np.array_equal(casters.array(A.T), A.T))
+    self.assertTrue(np.array_equal(casters.matrix(A[::2,:]), A[::2,:]))
+
+    # other data-type
+    A = np.arange(24).reshape(2,3,4)
+    self.assertTrue(np.array_equal(casters.array(A), A))
+    self.assertEqual(casters.array(A).dtype, np.float64)
+    self.assertTrue(np.array_equal(casters.array_int(A), A))
+
+    # list
+    self.assertTrue(np.array_equal(casters.matrix([[1,2],[3,4]]), np.array([[1.,2.],[3.,4.]])))
+
+  def test_bulk(self):
+
+    # larger than the threshold from which the copy is made without the GIL
+    n = int(np.sqrt(2 * casters.bulk / 8)) + 1
+
+    A = np.random.random((n,n))
+    self.assertGreater(A.nbytes, casters.bulk)
+    self.assertTrue(np.array_equal(casters.array(A), A))
+    self.assertTrue(np.array_equal(casters.matrix(A), A))
+    self.assertTrue(np.array_equal(casters.array(A.T), A.T))
+
+    A = symmetric(n)
+    self.assertTrue(np.array_equal(casters.symmetric_matrix(A), A))
+    self.assertTrue(np.array_equal(casters.tensor2s(A), A))
+
+    A = diagonal(n)
+    self.assertTrue(np.array_equal(casters.diagonal_matrix(A), A))
+    self.assertTrue(np.array_equal(casters.tensor2d(A), A))
+
+  def test_bulk_threads(self):
+
+    n = int(np.sqrt(2 * casters.bulk / 8)) + 1
+
+    data = [np.random.random((n,n)) for i in range(8)]
+    out  = [None for i in range(8)]
+
+    def run(i):
+      for k in range(4):
+        out[i] = casters.array(data[i])
+
+    threads = [threading.Thread(target=run, args=(i,)) for i in range(8)]
+
+    for thread in threads: thread.start()
+    for thread in threads: thread.join()
+
+    for A, B in zip(data, out):
+      self.assertTrue(np.array_equal(A, B))
+
+# ==================================================================================================
+
+class Test_fixed(unittest.TestCase):
+
+  def test_roundtrip(self):
+
+    A = np.random.random((2,3,4))
+    self.assertTrue(np.array_equal(casters.tiny_array(A), A))
+
+    A = np.random.random((2,3))
+    self.assertTrue(np.array_equal(casters.tiny_matrix(A), A))
+
+    A = symmetric(3)
+    self.assertTrue(np.array_equal(casters.tiny_symmetric_matrix(A), A))
+
+    A = diagonal(3)
+    self.assertTrue(np.array_equal(casters.tiny_diagonal_matrix(A), A))
+
+    A = np.random.random((3,3,3,3))
+    self.assertTrue(np.array_equal(casters.tiny_tensor4(A), A))
+
+    A = np.random.random((3,3))
+    self.assertTrue(np.array_equal(casters.tiny_tensor2(A), A))
+
+    A = symmetric(3)
+    self.assertTrue(np.array_equal(casters.tiny_tensor2s(A), A))
+
+    A = diagonal(3)
+    self.assertTrue(np.array_equal(casters.tiny_tensor2d(A), A))
+
+  def test_convert(self):
+
+    A = np.random.random((3,3))
+    self.assertTrue(np.array_equal(casters.tiny_tensor2(A.T), A.T))
+
+    A = np.arange(9).reshape(3,3)
+    self.assertTrue(np.array_equal(casters.tiny_tensor2(A), A))
+
+    self.assertTrue(np.array_equal(casters.tiny_matrix([[1,2,3],[4,5,6]]), [[1,2,3],[4,5,6]]))
+
+  def test_shape(self):
+
+    with self.assertRaises(TypeError):
+      casters.tiny_tensor2(np.random.random((2,2)))
+
+    with self.assertRaises(TypeError):
+      casters.tiny_tensor2(np.random.random((3,3,3)))
+
+    with self.assertRaises(TypeError):
+      casters.tiny_array(np.random.random((2,4,3)))
+
+# ==================================================================================================
+
+class Test_batch(unittest.TestCase):
+
+  def test_map(self):
+
+    A = np.random.random((10,3,3))
+
+    self.assertTrue(np.allclose(casters.batch_trace(A), np.trace(A, axis1=1, axis2=2)))
+
+    # the NumPy-array is mapped, not copied
+    self.assertTrue(casters.batch_array(A) is A)
+
+  def test_convert(self):
+
+    A = np.random.random((3,3,10))
+    B = np.transpose(A, (2,0,1))
+
+    self.assertTrue(np.allclose(casters.batch_trace(B), np.trace(B, axis1=1, axis2=2)))
+
+    A = np.arange(90).reshape(10,3,3)
+
+    self.assertTrue(np.allclose(casters.batch_trace(A), np.trace(A, axis1=1, axis2=2)))
+
+  def test_copy(self):
+
+    A = np.random.random((10,3,3))
+
+    self.assertTrue(np.array_equal(casters.batch_copy(A), A))
+
+  def test_shape(self):
+
+    self.assertEqual(casters.batch_size4(np.zeros((5,3,3,3,3))), 5)
+    self.assertEqual(casters.batch_size4(np.zeros((0,3,3,3,3))), 0)
+
+    with self.assertRaises(TypeError):
+      casters.batch_trace(np.zeros((10,2,2)))
+
+    with self.assertRaises(TypeError):
+      casters.batch_trace(np.zeros((3,3)))
+
+    # the rank must be that of the item plus one (the batch axis)
+    with self.assertRaises(TypeError):
+      casters.batch_trace(np.zeros((10,3,3,3)))
+
+    with self.assertRaises(TypeError):
+      casters.batch_size4(np.zeros((5,3,3)))
+
+# ==================================================================================================
+
+if __name__ == '__main__':
+
+  unittest.main()
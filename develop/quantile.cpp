@@ -0,0 +1,191 @@
+
+#include "support.h"
+
+typedef cppmat::array<double> Arr;
+
+// =================================================================================================
+
+// reference: sort, and interpolate linearly between the closest values
+inline double Quantile(std::vector<double> x, double q)
+{
+  std::sort(x.begin(), x.end());
+
+  double h = q * static_cast<double>(x.size()-1);
+  size_t k = static_cast<size_t>(std::floor(h));
+
+  if ( k+1 >= x.size() ) return x.back();
+
+  return x[k] + ( h - static_cast<double>(k) ) * ( x[k+1] - x[k] );
+}
+
+// =================================================================================================
+
+TEST_CASE("cppmat::quantile", "quantile.h")
+{
+
+// =================================================================================================
+
+SECTION( "cppmat::array : global" )
+{
+  // median of an odd and an even number of values
+  EQ(Arr::Copy({5}, {3., 1., 4., 1., 5.}).median(), 3. );
+  EQ(Arr::Copy({4}, {3., 1., 4., 2.    }).median(), 2.5);
+
+  // against a sorted reference, the input is not modified
+  Arr A = Arr::Random({7,11,13});
+  Arr B = A;
+
+  std::vector<double> x(A.begin(), A.end());
+
+  for ( auto &q : {0., .1, .25, .5, .75, .9, 1.} )
+    EQ(A.quantile(q), Quantile(x, q));
+
+  Equal(A, B);
+
+  EQ(A.quantile(0.), A.min());
+  EQ(A.quantile(1.), A.max());
+  EQ(A.percentile(90.), A.quantile(.9));
+  EQ(A.median(), A.quantile(.5));
+
+  // repeated values
+  Arr C = Arr::Copy({8}, {2., 2., 2., 1., 1., 3., 3., 3.});
+
+  EQ(C.quantile(.5), 2.);
+  EQ(C.quantile(.2), Quantile(std::vector<double>(C.begin(), C.end()), .2));
+}
+
+// =================================================================================================
+
+SECTION( "cppmat::array : along an axis" )
+{
+  Arr A = Arr::Random({9,10,11});
+
+  for ( int axis = 0 ; axis < 3 ; ++axis )
+  {
+    for ( auto &q : {0., .3, .5, 1.} )
+    {
+      Arr Q = A.quantile(q, axis);
+
+      REQUIRE( Q.shape() == A.sum(axis).shape() );
+
+      // reference for each lane
+      for ( cppmat::multi_index<> idx(Q.shape()) ; not idx.end() ; ++idx )
+      {
+        std::vector<double> x;
+
+        for ( size_t k = 0 ; k < A.shape(axis) ; ++k ) {
+          std::vector<size_t> i(idx.index());
+          i.insert(i.begin()+axis, k);
+          x.push_back(A.at(i.begin(), i.end()));
+        }
+
+        EQ(Q[idx.flat()], Quantile(x, q));
+      }
+    }
+
+    // negative axis, and the other flavours
+    Equal(A.quantile(.3, axis-3), A.quantile(.3, axis));
+    Equal(A.percentile(30., axis), A.quantile(.3, axis));
+    Equal(A.median(axis), A.quantile(.5, axis));
+  }
+}
+
+// =================================================================================================
+
+SECTION( "cppmat::array : along a list of axes" )
+{
+  Arr A = Arr::Random({6,5,7,4});
+
+  Arr M = A.median({0,2});
+
+  REQUIRE( M.shape() == cppmat::shape_t({5,4}) );
+
+  for ( size_t j = 0 ; j < 5 ; ++j ) {
+    for ( size_t l = 0 ; l < 4 ; ++l ) {
+      std::vector<double> x;
+      for ( size_t i = 0 ; i < 6 ; ++i )
+        for ( size_t k = 0 ; k < 7 ; ++k )
+          x.push_back(A(i,j,k,l));
+      EQ(M(j,l), Quantile(x, .5));
+    }
+  }
+
+  // negative axes, single axis
+  Equal(A.median({-2,0}), M);
+  Equal(A.quantile(.7, std::vector<int>{1}), A.quantile(.7, 1));
+
+  // per-entry median over realisations (along the first axis)
+  Arr R = Arr::Random({101,3,4});
+  Arr m = R.median(0);
+
+  for ( size_t i = 0 ; i < 3 ; ++i ) {
+    for ( size_t j = 0 ; j < 4 ; ++j ) {
+      size_t below = 0;
+      for ( size_t k = 0 ; k < 101 ; ++k )
+        if ( R(k,i,j) < m(i,j) )
+          ++below;
+      REQUIRE( below == 50 );
+    }
+  }
+}
+
+// =================================================================================================
+
+SECTION( "cppmat::array<int> : interpolated values along axes, as the global result" )
+{
+  cppmat::array<int> A({2,4});
+
+  A.setArange();
+
+  cppmat::array<double> M = A.median(1);
+  cppmat::array<double> Q = A.quantile(.5, std::vector<int>{0});
+
+  EQ(M(0), 1.5);
+  EQ(M(1), 5.5);
+  EQ(Q(0), 2. );
+  EQ(A.percentile(50., 1)(1), A.median(1)(1));
+  EQ(A.median(), 3.5);
+}
+
+// =================================================================================================
+
+SECTION( "cppmat::streaming_quantile" )
+{
+  // empty
+  REQUIRE( std::isnan(cppmat::streaming_quantile().value()) );
+
+  // exact up to five values
+  std::vector<double> x = {4., 1., 3., 5., 2.};
+
+  for ( size_t n = 1 ; n <= 5 ; ++n )
+  {
+    cppmat::streaming_quantile a(.5), b(.3);
+
+    a.push(x.begin(), x.begin()+n);
+    b.push(x.begin(), x.begin()+n);
+
+    REQUIRE( a.size() == n );
+
+    EQ(a.value(), Quantile(std::vector<double>(x.begin(), x.begin()+n), .5));
+    EQ(b.value(), Quantile(std::vector<double>(x.begin(), x.begin()+n), .3));
+  }
+
+  // approximate for many values
+  Arr A = Arr::Random({100000});
+
+  std::vector<double> y(A.begin(), A.end());
+
+  for ( auto &q : {.1, .5, .9} )
+  {
+    cppmat::streaming_quantile S(q);
+
+    S.push(A.begin(), A.end());
+
+    REQUIRE( S.size() == A.size() );
+    REQUIRE( std::abs(S.value() - Quantile(y, q)) < 1.e-2 );
+  }
+}
+
+// =================================================================================================
+
+}
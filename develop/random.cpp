@@ -0,0 +1,224 @@
+
+#include "support.h"
+
+#include <thread>
+
+// =================================================================================================
+
+TEST_CASE("cppmat::random", "random.h")
+{
+
+// =================================================================================================
+
+SECTION( "philox4x32: known-answer tests" )
+{
+  uint32_t out[4];
+
+  {
+    uint32_t ctr[4] = {0, 0, 0, 0};
+    uint32_t key[2] = {0, 0};
+    cppmat::random::philox4x32(ctr, key, out);
+    REQUIRE( out[0] == 0x6627e8d5 );
+    REQUIRE( out[1] == 0xe169c58d );
+    REQUIRE( out[2] == 0xbc57ac4c );
+    REQUIRE( out[3] == 0x9b00dbd8 );
+  }
+
+  {
+    uint32_t ctr[4] = {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff};
+    uint32_t key[2] = {0xffffffff, 0xffffffff};
+    cppmat::random::philox4x32(ctr, key, out);
+    REQUIRE( out[0] == 0x408f276d );
+    REQUIRE( out[1] == 0x41c83b0e );
+    REQUIRE( out[2] == 0xa20bc7c6 );
+    REQUIRE( out[3] == 0x6d5451fd );
+  }
+
+  {
+    uint32_t ctr[4] = {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344};
+    uint32_t key[2] = {0xa4093822, 0x299f31d0};
+    cppmat::random::philox4x32(ctr, key, out);
+    REQUIRE( out[0] == 0xd16cfe09 );
+    REQUIRE( out[1] == 0x94fdcceb );
+    REQUIRE( out[2] == 0x5001e420 );
+    REQUIRE( out[3] == 0x24126ea1 );
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "Philox: seed, at, discard, split" )
+{
+  cppmat::random::Philox a(1234, 5);
+  cppmat::random::Philox b(1234, 5);
+  cppmat::random::Philox c(1235, 5);
+
+  for ( size_t i = 0 ; i < 11 ; ++i ) {
+    uint64_t r = a();
+    REQUIRE( r == b.at(i) );
+    REQUIRE( r != c()     );
+  }
+
+  REQUIRE( a.position() == 11 );
+
+  b.discard(11);
+
+  REQUIRE( a() == b() );
+
+  a.seed(1234, 5);
+
+  REQUIRE( a() == b.at(0) );
+
+  cppmat::random::Philox s0 = a.split(0);
+  cppmat::random::Philox s1 = a.split(1);
+
+  REQUIRE( s0.getStream() != s1.getStream() );
+  REQUIRE( s0.getStream() == a.split(0).getStream() );
+  REQUIRE( s0() != s1() );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "fill: independent of alignment" )
+{
+  size_t n = 101;
+
+  cppmat::random::Philox a(42);
+  cppmat::random::Philox b(42);
+
+  std::vector<double> x(n), y(n);
+
+  // all at once, or in pieces of odd length
+  cppmat::random::uniform(x.data(), n, 0., 1., a);
+  cppmat::random::uniform(y.data()   ,  1, 0., 1., b);
+  cppmat::random::uniform(y.data()+ 1, 40, 0., 1., b);
+  cppmat::random::uniform(y.data()+41, 60, 0., 1., b);
+
+  REQUIRE( a.position() == n );
+  REQUIRE( b.position() == n );
+
+  for ( size_t i = 0 ; i < n ; ++i )
+    REQUIRE( x[i] == y[i] );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "uniform, normal, weibull: moments" )
+{
+  size_t n = 200000;
+
+  cppmat::random::Philox rng(0);
+
+  cppmat::array<double> u({n});
+  cppmat::array<double> g({n});
+  cppmat::array<double> w({n});
+
+  cppmat::random::uniform(u, -1., 3., rng);
+  cppmat::random::normal (g,  2., 3., rng);
+  cppmat::random::weibull(w,  2., 1.5, rng);
+
+  REQUIRE( u.min() >= -1. );
+  REQUIRE( u.max() <   3. );
+  REQUIRE( w.min() >=  0. );
+
+  double pi = std::acos(-1.0);
+
+  REQUIRE_THAT( u.mean(), Catch::WithinAbs(1.0, 0.02) );
+  REQUIRE_THAT( g.mean(), Catch::WithinAbs(2.0, 0.03) );
+  REQUIRE_THAT( w.mean(), Catch::WithinAbs(1.5*std::sqrt(pi)/2., 0.01) );
+
+  double var = 0.0;
+
+  for ( auto &x : g ) var += (x-2.) * (x-2.);
+
+  REQUIRE_THAT( var/static_cast<double>(n), Catch::WithinAbs(9.0, 0.1) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "setRandom: reproducible after seed" )
+{
+  cppmat::random::seed(10);
+
+  cppmat::array<double> a = cppmat::array<double>::Random({10,5});
+  cppmat::cartesian::tensor2<double> A = cppmat::cartesian::tensor2<double>::Random(3);
+  cppmat::tiny::symmetric::matrix<double,3,3> S = cppmat::tiny::symmetric::matrix<double,3,3>::Random();
+
+  cppmat::random::seed(10);
+
+  cppmat::array<double> b = cppmat::array<double>::Random({10,5});
+  cppmat::cartesian::tensor2<double> B = cppmat::cartesian::tensor2<double>::Random(3);
+  cppmat::tiny::symmetric::matrix<double,3,3> T = cppmat::tiny::symmetric::matrix<double,3,3>::Random();
+
+  for ( size_t i = 0 ; i < a.size() ; ++i ) REQUIRE( a[i] == b[i] );
+  for ( size_t i = 0 ; i < A.size() ; ++i ) REQUIRE( A[i] == B[i] );
+  for ( size_t i = 0 ; i < S.size() ; ++i ) REQUIRE( S[i] == T[i] );
+
+  // successive calls differ
+  cppmat::array<double> c = cppmat::array<double>::Random({10,5});
+
+  REQUIRE( c[0] != b[0] );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "setRandom: one generator per thread" )
+{
+  size_t nt = 4;
+
+  std::vector<cppmat::array<double>> out(nt, cppmat::array<double>({100,50}));
+
+  cppmat::random::seed(10, 1);
+
+  // threads that are not started by OpenMP use an explicit generator
+  std::vector<std::thread> threads;
+
+  for ( size_t t = 0 ; t < nt ; ++t )
+    threads.emplace_back([&out, t]() {
+      cppmat::random::Philox rng = cppmat::random::Philox(10, 1).split(t);
+      cppmat::random::uniform(out[t], 0., 1., rng);
+    });
+
+  for ( auto &thread : threads ) thread.join();
+
+  for ( size_t t = 0 ; t < nt ; ++t ) {
+    cppmat::array<double> ref({100,50});
+    cppmat::random::Philox rng = cppmat::random::Philox(10, 1).split(t);
+    cppmat::random::uniform(ref, 0., 1., rng);
+    for ( size_t i = 0 ; i < ref.size() ; ++i ) REQUIRE( out[t][i] == ref[i] );
+  }
+
+#ifdef _OPENMP
+  // OpenMP threads: the stream follows from the thread number, independent of scheduling
+  for ( size_t repeat = 0 ; repeat < 2 ; ++repeat )
+  {
+    cppmat::random::seed(10, 1);
+
+    #pragma omp parallel num_threads(4)
+    {
+      size_t t = static_cast<size_t>(omp_get_thread_num());
+      out[t] = cppmat::array<double>::Random({100,50});
+    }
+
+    for ( size_t t = 0 ; t < static_cast<size_t>(omp_get_max_threads()) && t < nt ; ++t ) {
+      cppmat::array<double> ref({100,50});
+      cppmat::random::Philox rng(10, 1);
+      if ( t > 0 ) rng = rng.split(t);
+      cppmat::random::uniform(ref, 0., 1., rng);
+      for ( size_t i = 0 ; i < ref.size() ; ++i ) REQUIRE( out[t][i] == ref[i] );
+    }
+  }
+#endif
+
+  // outside parallel regions the calling thread uses the base stream
+  cppmat::random::seed(10);
+  cppmat::array<double> a = cppmat::array<double>::Random({10,5});
+  cppmat::array<double> b({10,5});
+  cppmat::random::Philox rng(10);
+  cppmat::random::uniform(b, 0., 1., rng);
+  for ( size_t i = 0 ; i < a.size() ; ++i ) REQUIRE( a[i] == b[i] );
+}
+
+// =================================================================================================
+
+}
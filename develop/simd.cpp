@@ -0,0 +1,157 @@
+
+#include "support.h"
+
+// =================================================================================================
+
+// relative comparison (the order of operations may differ between the kernels and the reference)
+template<typename X>
+bool near(X a, double b)
+{
+  return std::abs(static_cast<double>(a) - b) <= 1.e-5 * ( 1.0 + std::abs(b) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+void check_kernels(size_t n)
+{
+  std::vector<X> a(n), b(n), c(n), d(n);
+
+  for ( size_t i = 0 ; i < n ; ++i ) {
+    a[i] = static_cast<X>( 1.0 + std::sin(static_cast<double>(i)    ) );
+    b[i] = static_cast<X>( 2.0 + std::cos(static_cast<double>(i)*0.5) );
+  }
+
+  cppmat::simd::add(a.data(), b.data(), c.data(), n);
+  for ( size_t i = 0 ; i < n ; ++i ) EQ( c[i], a[i] + b[i] );
+
+  cppmat::simd::sub(a.data(), b.data(), c.data(), n);
+  for ( size_t i = 0 ; i < n ; ++i ) EQ( c[i], a[i] - b[i] );
+
+  cppmat::simd::mul(a.data(), b.data(), c.data(), n);
+  for ( size_t i = 0 ; i < n ; ++i ) EQ( c[i], a[i] * b[i] );
+
+  cppmat::simd::div(a.data(), b.data(), c.data(), n);
+  for ( size_t i = 0 ; i < n ; ++i ) EQ( c[i], a[i] / b[i] );
+
+  std::copy(a.begin(), a.end(), c.begin());
+  std::copy(a.begin(), a.end(), d.begin());
+
+  cppmat::simd::fmadd(a.data(), b.data(), c.data(), n);
+  for ( size_t i = 0 ; i < n ; ++i ) REQUIRE( near(c[i], static_cast<double>(d[i]+a[i]*b[i])) );
+
+  // in-place (output aliases input)
+  cppmat::simd::add(c.data(), a.data(), c.data(), n);
+  for ( size_t i = 0 ; i < n ; ++i ) REQUIRE( near(c[i], static_cast<double>(d[i]+a[i]*b[i]+a[i])) );
+
+  double s = 0.0;
+  for ( size_t i = 0 ; i < n ; ++i ) s += static_cast<double>(a[i]);
+
+  REQUIRE( near(cppmat::simd::sum(a.data(), n), s) );
+}
+
+// =================================================================================================
+
+TEST_CASE("cppmat::simd", "simd.h")
+{
+
+// =================================================================================================
+
+SECTION( "detect, setISA" )
+{
+  cppmat::simd::ISA level = cppmat::simd::detect();
+
+  REQUIRE( cppmat::simd::isa() == level );
+
+  cppmat::simd::setISA(cppmat::simd::ISA::avx512);
+
+  REQUIRE( cppmat::simd::isa() == level );
+
+  cppmat::simd::setISA(cppmat::simd::ISA::generic);
+
+  REQUIRE( cppmat::simd::isa() == cppmat::simd::ISA::generic );
+  REQUIRE( cppmat::simd::to_string(cppmat::simd::isa()) == "generic" );
+
+  cppmat::simd::setISA(level);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "kernels: all supported instruction sets, various lengths" )
+{
+  cppmat::simd::ISA level = cppmat::simd::detect();
+
+  for ( auto isa : {cppmat::simd::ISA::generic, cppmat::simd::ISA::avx2, cppmat::simd::ISA::avx512} )
+  {
+    if ( isa > level ) continue;
+
+    cppmat::simd::setISA(isa);
+
+    for ( size_t n : {0, 1, 7, 16, 33, 63, 64, 65, 1001} ) {
+      check_kernels<double>(n);
+      check_kernels<float >(n);
+      check_kernels<int   >(n);
+    }
+  }
+
+  cppmat::simd::setISA(level);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "fmadd: no fused multiply-add, identical for all instruction sets" )
+{
+  cppmat::simd::ISA level = cppmat::simd::detect();
+
+  // "a*b" rounds to one, such that "a*b-1" is zero only if the product is rounded
+  size_t n  = 3 * CPPMAT_SIMD_MIN;
+  double ed = std::ldexp(1.0 , -30);
+  float  ef = std::ldexp(1.0f, -13);
+
+  for ( auto isa : {cppmat::simd::ISA::generic, cppmat::simd::ISA::avx2, cppmat::simd::ISA::avx512} )
+  {
+    if ( isa > level ) continue;
+
+    cppmat::simd::setISA(isa);
+
+    std::vector<double> ad(n, 1.0+ed), bd(n, 1.0-ed), cd(n, -1.0);
+    std::vector<float > af(n, 1.0f+ef), bf(n, 1.0f-ef), cf(n, -1.0f);
+
+    cppmat::simd::fmadd(ad.data(), bd.data(), cd.data(), n);
+    cppmat::simd::fmadd(af.data(), bf.data(), cf.data(), n);
+
+    for ( size_t i = 0 ; i < n ; ++i ) REQUIRE( cd[i] == 0.0  );
+    for ( size_t i = 0 ; i < n ; ++i ) REQUIRE( cf[i] == 0.0f );
+  }
+
+  cppmat::simd::setISA(level);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "cppmat::array: arithmetic and sum" )
+{
+  cppmat::array<double> a = cppmat::array<double>::Random({11,7,3});
+  cppmat::array<double> b = cppmat::array<double>::Random({11,7,3}) + 2.;
+
+  cppmat::array<double> c = a + b;
+  cppmat::array<double> d = a * b;
+  cppmat::array<double> e = a;
+
+  e /= b;
+
+  double s = 0.0;
+
+  for ( size_t i = 0 ; i < a.size() ; ++i ) {
+    EQ( c[i], a[i] + b[i] );
+    EQ( d[i], a[i] * b[i] );
+    EQ( e[i], a[i] / b[i] );
+    s += a[i];
+  }
+
+  EQ( a.sum(), s );
+}
+
+// =================================================================================================
+
+}
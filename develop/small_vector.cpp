@@ -0,0 +1,226 @@
+
+#include "support.h"
+
+typedef cppmat::small_vector<size_t,3> Vec;
+
+// type without default constructor that counts its instances
+struct Counted
+{
+  static int count;
+  int value;
+  explicit Counted(int v) : value(v) { ++count; }
+  Counted(const Counted &D) : value(D.value) { ++count; }
+  Counted& operator=(const Counted &D) = default;
+  ~Counted() { --count; }
+  bool operator==(const Counted &D) const { return value == D.value; }
+};
+
+int Counted::count = 0;
+
+// =================================================================================================
+
+TEST_CASE("cppmat::small_vector", "small_vector.h")
+{
+
+// =================================================================================================
+
+SECTION( "construct, compare, convert" )
+{
+  std::vector<size_t> a = {1,2,3};
+  std::vector<size_t> b = {1,2,3,4,5};
+
+  Vec A = {1,2,3};
+  Vec B(b);
+
+  REQUIRE( A.size() == 3 );
+  REQUIRE( B.size() == 5 );
+  REQUIRE( A == a );
+  REQUIRE( b == B );
+  REQUIRE( A != B );
+  REQUIRE( std::vector<size_t>(A) == a );
+  REQUIRE( std::vector<size_t>(B) == b );
+  REQUIRE( Vec().empty() );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "resize: inline <-> heap" )
+{
+  Vec A = {1,2};
+
+  A.push_back(3);
+  A.push_back(4);
+  A.push_back(5);
+
+  REQUIRE( A == std::vector<size_t>({1,2,3,4,5}) );
+  REQUIRE( A.back() == 5 );
+
+  A.resize(2);
+
+  REQUIRE( A == std::vector<size_t>({1,2}) );
+
+  A.resize(4, 7);
+
+  REQUIRE( A == std::vector<size_t>({1,2,7,7}) );
+
+  A.pop_back();
+
+  REQUIRE( A == std::vector<size_t>({1,2,7}) );
+  REQUIRE( cppmat::del(A, 1) == std::vector<size_t>({1,7}) );
+  REQUIRE( cppmat::del(A,-1) == std::vector<size_t>({1,2}) );
+
+  A.clear();
+
+  REQUIRE( A.empty() );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "inline storage: only the entries in use are constructed" )
+{
+  typedef cppmat::small_vector<Counted,3> CVec;
+
+  REQUIRE( Counted::count == 0 );
+
+  {
+    CVec A;
+
+    REQUIRE( Counted::count == 0 );
+
+    A.push_back(Counted(1));
+    A.push_back(Counted(2));
+
+    REQUIRE( Counted::count == 2 );
+
+    // inline -> heap: the inline entries are destroyed
+    A.push_back(A.back());
+    A.push_back(Counted(4));
+
+    REQUIRE( Counted::count == 4 );
+    REQUIRE( A[2].value == 2 );
+
+    CVec B = A;
+    CVec C = std::move(A);
+
+    REQUIRE( Counted::count == 8 );
+
+    // heap -> inline
+    B.pop_back();
+    B.pop_back();
+
+    REQUIRE( Counted::count == 6 );
+    REQUIRE( B[1].value == 2 );
+
+    C = B;
+
+    REQUIRE( Counted::count == 4 );
+
+    B.clear();
+
+    REQUIRE( Counted::count == 2 );
+
+    B.resize(3, Counted(5));
+    B = std::move(C);
+
+    REQUIRE( Counted::count == 2 );
+  }
+
+  REQUIRE( Counted::count == 0 );
+
+  // the inline storage is sized in bytes
+  REQUIRE( cppmat::inline_size<double>::value == CPPMAT_INLINE_BYTES / sizeof(double) );
+  REQUIRE( cppmat::inline_size<float >::value == CPPMAT_INLINE_BYTES / sizeof(float ) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "shape and strides of arrays" )
+{
+  cppmat::array<double> A = cppmat::array<double>::Random({2,3,4});
+  cppmat::array<double> B(A.shape());
+
+  REQUIRE( A.shape() == B.shape() );
+  REQUIRE( A.shape() == std::vector<size_t>({2,3,4}) );
+  REQUIRE( A.strides() == std::vector<size_t>({12,4,1}) );
+
+  cppmat::tiny::array<double,2,3,4> C;
+
+  REQUIRE( C.shape() == std::vector<size_t>({3,4}) );
+  REQUIRE( C.strides() == std::vector<size_t>({4,1}) );
+
+  cppmat::symmetric::matrix<double> D(3,3);
+
+  REQUIRE( D.shape() == std::vector<size_t>({3,3}) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "copy/move: inline and heap" )
+{
+  for ( size_t n : {2, 5} )
+  {
+    Vec A = Vec(std::vector<size_t>(n, 3));
+    Vec B = A;
+    Vec C = std::move(B);
+    Vec D;
+    Vec E = {1,2,3,4,5,6,7};
+
+    D = C;
+    E = std::move(D);
+
+    REQUIRE( C == A );
+    REQUIRE( E == A );
+    REQUIRE( B.empty() );
+    REQUIRE( D.empty() );
+    REQUIRE( C.data() != A.data() );
+
+    D = E;
+
+    REQUIRE( D == A );
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "data of arrays: inline and heap" )
+{
+  for ( size_t n : {3, 10} )
+  {
+    cppmat::array<double> A = cppmat::array<double>::Random({n,n});
+    cppmat::array<double> B = A;
+    cppmat::array<double> C = std::move(B);
+    cppmat::array<double> D = A + C;
+
+    Equal(C, A);
+    Equal(D, 2. * A);
+
+    cppmat::cartesian::tensor2<double> T = cppmat::cartesian::tensor2<double>::Random(n);
+    cppmat::cartesian::tensor2<double> U = T;
+
+    U = std::move(T);
+
+    Equal(U.dot(cppmat::cartesian::tensor2<double>::I(n)), U);
+
+    cppmat::vector<double> v = cppmat::vector<double>::Random(n);
+    cppmat::vector<double> w = v;
+
+    for ( size_t i = 0 ; i < 100 ; ++i )
+      w.push_back(static_cast<double>(i));
+
+    w.append(v);
+
+    REQUIRE( w.size() == 2*n + 100 );
+    EQ( w[n], 0. );
+    EQ( w[n+99], 99. );
+
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      EQ( w[i], v[i] );
+      EQ( w[n+100+i], v[i] );
+    }
+  }
+}
+
+// =================================================================================================
+
+}
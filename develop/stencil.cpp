@@ -0,0 +1,148 @@
+
+#include "support.h"
+
+typedef cppmat::array<double> Arr;
+typedef cppmat::stencil::Boundary BC;
+
+// =================================================================================================
+
+// reference: direct evaluation using the index operators (rank 3, padded to rank 3 by the caller)
+static double value(const Arr &f, int i, int j, int k, BC bc, double D)
+{
+  int n[3] = { f.shape<int>(0), f.shape<int>(1), f.shape<int>(2) };
+  int x[3] = { i, j, k };
+
+  for ( size_t a = 0 ; a < 3 ; ++a ) {
+    if ( x[a] >= 0 and x[a] < n[a] ) continue;
+    if      ( bc == BC::periodic ) x[a] = ( x[a] % n[a] + n[a] ) % n[a];
+    else if ( bc == BC::clamp    ) x[a] = x[a] < 0 ? 0 : n[a] - 1;
+    else                           return D;
+  }
+
+  return f(x[0], x[1], x[2]);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+static Arr reference(const Arr &f, const Arr &mask, BC bc, double D)
+{
+  Arr out = Arr::Zero(f.shape());
+
+  int r[3] = { (mask.shape<int>(0)-1)/2, (mask.shape<int>(1)-1)/2, (mask.shape<int>(2)-1)/2 };
+
+  for ( int i = 0 ; i < f.shape<int>(0) ; ++i )
+    for ( int j = 0 ; j < f.shape<int>(1) ; ++j )
+      for ( int k = 0 ; k < f.shape<int>(2) ; ++k )
+        for ( int a = 0 ; a < mask.shape<int>(0) ; ++a )
+          for ( int b = 0 ; b < mask.shape<int>(1) ; ++b )
+            for ( int c = 0 ; c < mask.shape<int>(2) ; ++c )
+              out(i,j,k) += mask(a,b,c) * value(f, i+a-r[0], j+b-r[1], k+c-r[2], bc, D);
+
+  return out;
+}
+
+// =================================================================================================
+
+TEST_CASE("cppmat::stencil", "stencil.h")
+{
+
+// =================================================================================================
+
+SECTION( "apply: all boundary conditions, compared to direct evaluation" )
+{
+  for ( auto bc : {BC::periodic, BC::clamp, BC::constant} )
+  {
+    // rank 3: including an axis that is shorter than the mask, and a zero weight
+    {
+      Arr f    = Arr::Random({7,2,9});
+      Arr mask = Arr::Random({3,3,5});
+
+      mask(1,0,2) = 0.;
+
+      Arr out = cppmat::stencil::apply(f, mask, bc, 2.);
+      Arr ref = reference(f, mask, bc, 2.);
+
+      for ( size_t i = 0 ; i < out.size() ; ++i )
+        EQ( out[i], ref[i] );
+    }
+
+    // rank 1 and 2, compared to the rank 3 reference
+    {
+      Arr f    = Arr::Random({20});
+      Arr mask = Arr::Random({5});
+
+      Arr out = cppmat::stencil::apply(f, mask, bc, -1.);
+
+      f   .reshape({1,1,20});
+      mask.reshape({1,1,5});
+
+      Arr ref = reference(f, mask, bc, -1.);
+
+      for ( size_t i = 0 ; i < out.size() ; ++i )
+        EQ( out[i], ref[i] );
+    }
+
+    {
+      Arr f    = Arr::Random({11,13});
+      Arr mask = Arr::Random({5,3});
+
+      Arr out = cppmat::stencil::apply(f, mask, bc);
+
+      f   .reshape({1,11,13});
+      mask.reshape({1,5,3});
+
+      Arr ref = reference(f, mask, bc, 0.);
+
+      for ( size_t i = 0 ; i < out.size() ; ++i )
+        EQ( out[i], ref[i] );
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "apply: output argument, fixed size mask" )
+{
+  Arr f = Arr::Random({10,12});
+
+  cppmat::tiny::array<double,2,3,3> mask = cppmat::tiny::array<double,2,3,3>::Random();
+
+  Arr a = cppmat::stencil::apply(f, mask, BC::clamp);
+  Arr b(f.shape());
+
+  cppmat::stencil::apply(f, Arr(mask), b, BC::clamp);
+
+  for ( size_t i = 0 ; i < a.size() ; ++i )
+    EQ( a[i], b[i] );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "laplacian, box" )
+{
+  // Laplacian of a quadratic field: exact in the interior
+  Arr f({8,9,10});
+
+  for ( size_t i = 0 ; i < 8 ; ++i )
+    for ( size_t j = 0 ; j < 9 ; ++j )
+      for ( size_t k = 0 ; k < 10 ; ++k )
+        f(i,j,k) = double(i*i) + 2.*double(j*j) + 3.*double(k*k);
+
+  Arr L = cppmat::stencil::apply(f, cppmat::stencil::laplacian<double>(3));
+
+  for ( size_t i = 1 ; i < 7 ; ++i )
+    for ( size_t j = 1 ; j < 8 ; ++j )
+      for ( size_t k = 1 ; k < 9 ; ++k )
+        EQ( L(i,j,k), 12. );
+
+  // box average of a constant field
+  Arr c = Arr::Constant({6,7}, 3.);
+  Arr m = cppmat::stencil::apply(c, cppmat::stencil::box<double>(2, 2), BC::periodic);
+
+  for ( auto &i : m )
+    EQ( i, 3. );
+}
+
+// =================================================================================================
+
+}
@@ -0,0 +1,143 @@
+
+#include "support.h"
+
+typedef cppmat::cartesian::tensor4<double> T4;
+typedef cppmat::cartesian::tensor2<double> T2;
+typedef cppmat::cartesian::vector <double> V;
+
+typedef cppmat::cartesian::soa::tensor4<double> sT4;
+typedef cppmat::cartesian::soa::tensor2<double> sT2;
+typedef cppmat::cartesian::soa::vector <double> sV;
+
+static const size_t nd = 3;
+static const size_t np = 13;
+
+// =================================================================================================
+
+TEST_CASE("cppmat::cartesian::soa", "var_cartesian_soa.h")
+{
+
+// =================================================================================================
+// layout conversion
+// =================================================================================================
+
+SECTION( "CopyAoS, AoS" )
+{
+  cppmat::array<double> a = cppmat::array<double>::Random({np/2+1, 2, nd, nd});
+
+  sT2 A = sT2::CopyAoS(a);
+
+  REQUIRE( A.points() == (np/2+1)*2 );
+  REQUIRE( A.ndim() == nd );
+
+  for ( size_t p = 0 ; p < A.points() ; ++p )
+    for ( size_t i = 0 ; i < nd ; ++i )
+      for ( size_t j = 0 ; j < nd ; ++j )
+        EQ( A(i,j,p), a[(p*nd+i)*nd+j] );
+
+  cppmat::array<double> b = A.AoS();
+
+  REQUIRE( b.size() == a.size() );
+
+  for ( size_t i = 0 ; i < a.size() ; ++i )
+    EQ( b[i], a[i] );
+
+  std::vector<double> c(a.size());
+
+  A.copyToAoS(c.begin());
+
+  for ( size_t i = 0 ; i < a.size() ; ++i )
+    EQ( c[i], a[i] );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "get, set" )
+{
+  sT4 A(np, nd);
+  sT2 B(np, nd);
+  sV  C(np, nd);
+
+  std::vector<T4> a;
+  std::vector<T2> b;
+  std::vector<V>  c;
+
+  for ( size_t p = 0 ; p < np ; ++p ) {
+    a.push_back(T4::Random(nd)); A.set(p, a[p]);
+    b.push_back(T2::Random(nd)); B.set(p, b[p]);
+    c.push_back(V ::Random(nd)); C.set(p, c[p]);
+  }
+
+  for ( size_t p = 0 ; p < np ; ++p ) {
+    Equal(A.get(p), a[p]);
+    Equal(B.get(p), b[p]);
+    Equal(C.get(p), c[p]);
+  }
+
+  cppmat::tiny::cartesian::tensor2<double,nd> t = cppmat::tiny::cartesian::tensor2<double,nd>::Random();
+
+  B.set(0, t);
+
+  cppmat::tiny::cartesian::tensor2<double,nd> s;
+
+  B.get(0, s);
+
+  for ( size_t i = 0 ; i < t.size() ; ++i )
+    EQ( s[i], t[i] );
+}
+
+// =================================================================================================
+// tensor products
+// =================================================================================================
+
+SECTION( "ddot, dot, dyadic, T, RT, LT, trace" )
+{
+  cppmat::array<double> a = cppmat::array<double>::Random({np, nd, nd, nd, nd});
+  cppmat::array<double> b = cppmat::array<double>::Random({np, nd, nd});
+  cppmat::array<double> c = cppmat::array<double>::Random({np, nd, nd});
+  cppmat::array<double> v = cppmat::array<double>::Random({np, nd});
+
+  sT4 A = sT4::CopyAoS(a);
+  sT2 B = sT2::CopyAoS(b);
+  sT2 C = sT2::CopyAoS(c);
+  sV  W = sV ::CopyAoS(v);
+
+  sT2               AB  = cppmat::cartesian::soa::ddot  (A, B);
+  sT2               BA  = cppmat::cartesian::soa::ddot  (B, A);
+  cppmat::vector<double> BC = cppmat::cartesian::soa::ddot(B, C);
+  sT2               BdC = cppmat::cartesian::soa::dot   (B, C);
+  sV                BW  = cppmat::cartesian::soa::dot   (B, W);
+  sT4               BxC = cppmat::cartesian::soa::dyadic(B, C);
+  sT4               AA  = cppmat::cartesian::soa::ddot  (A, A);
+  sT4               At  = cppmat::cartesian::soa::T     (A);
+  sT4               Ar  = cppmat::cartesian::soa::RT    (A);
+  sT4               Al  = cppmat::cartesian::soa::LT    (A);
+  sT2               Bt  = cppmat::cartesian::soa::T     (B);
+  cppmat::vector<double> tr = cppmat::cartesian::soa::trace(B);
+
+  for ( size_t p = 0 ; p < np ; ++p )
+  {
+    T4 ap = A.get(p);
+    T2 bp = B.get(p);
+    T2 cp = C.get(p);
+    V  wp = W.get(p);
+
+    Equal(AB .get(p), ap.ddot(bp));
+    Equal(BA .get(p), bp.ddot(ap));
+    Equal(BdC.get(p), bp.dot(cp));
+    Equal(BW .get(p), bp.dot(wp));
+    Equal(BxC.get(p), bp.dyadic(cp));
+    Equal(AA .get(p), ap.ddot(ap));
+    Equal(At .get(p), ap.T());
+    Equal(Ar .get(p), ap.RT());
+    Equal(Al .get(p), ap.LT());
+    Equal(Bt .get(p), bp.T());
+
+    EQ( BC[p], bp.ddot(cp) );
+    EQ( tr[p], bp.trace()  );
+  }
+}
+
+// =================================================================================================
+
+}
@@ -237,6 +237,114 @@ SECTION("T2.inv() -- 2D")
   Equal(C, c);
 }
 
+// =================================================================================================
+// fixed size kernels (ND = 1, 2, 3) and generic kernels (other ND)
+// =================================================================================================
+
+SECTION( "products, ND = 1, 2, 3, 4" )
+{
+  for ( size_t nd = 1 ; nd <= 4 ; ++nd )
+  {
+    T4 A = T4::Random(nd);
+    T2 B = T2::Random(nd);
+    T2 C = T2::Random(nd);
+    V  u = V ::Random(nd);
+    V  v = V ::Random(nd);
+
+    T2     AB  = A.ddot(B);
+    T2     BA  = B.ddot(A);
+    double BC  = B.ddot(C);
+    T2     BdC = B.dot(C);
+    V      Bu  = B.dot(u);
+    V      uB  = u.dot(B);
+    double uv  = u.dot(v);
+    T2     uxv = u.dyadic(v);
+    T2     Bt  = B.T();
+    double tr  = B.trace();
+
+    double bc = 0., uv_ = 0., tr_ = 0.;
+
+    for ( size_t i = 0 ; i < nd ; ++i )
+    {
+      double bu = 0., ub = 0.;
+
+      tr_ += B(i,i);
+      uv_ += u(i) * v(i);
+
+      for ( size_t j = 0 ; j < nd ; ++j )
+      {
+        double ab = 0., ba = 0., bdc = 0.;
+
+        bc += B(i,j) * C(j,i);
+        bu += B(i,j) * u(j);
+        ub += u(j) * B(j,i);
+
+        for ( size_t k = 0 ; k < nd ; ++k ) {
+          bdc += B(i,k) * C(k,j);
+          for ( size_t l = 0 ; l < nd ; ++l ) {
+            ab += A(i,j,k,l) * B(l,k);
+            ba += B(k,l) * A(l,k,i,j);
+          }
+        }
+
+        EQ( AB (i,j), ab );
+        EQ( BA (i,j), ba );
+        EQ( BdC(i,j), bdc );
+        EQ( uxv(i,j), u(i) * v(j) );
+        EQ( Bt (i,j), B(j,i) );
+      }
+
+      EQ( Bu(i), bu );
+      EQ( uB(i), ub );
+    }
+
+    EQ( BC, bc  );
+    EQ( uv, uv_ );
+    EQ( tr, tr_ );
+  }
+}
+
+// =================================================================================================
+// output argument
+// =================================================================================================
+
+SECTION( "output argument, reused" )
+{
+  T2  C;
+  T2s Cs;
+  T2d Cd;
+  T4  D;
+  V   w;
+
+  for ( size_t nd = 2 ; nd <= 3 ; ++nd )
+  {
+    T4  A  = T4 ::Random(nd);
+    T2  B  = T2 ::Random(nd);
+    T2s Bs = T2s::Random(nd);
+    T2d Bd = T2d::Random(nd);
+    V   u  = V  ::Random(nd);
+
+    B  += T2 ::I(nd) * static_cast<double>(nd);
+    Bd += T2d::I(nd);
+    Bs += T2s::I(nd) * static_cast<double>(nd);
+
+    for ( size_t iter = 0 ; iter < 2 ; ++iter )
+    {
+      cppmat::cartesian::ddot  (A, B , C ); Equal(C , A.ddot(B));
+      cppmat::cartesian::ddot  (B, A , C ); Equal(C , B.ddot(A));
+      cppmat::cartesian::ddot  (A, A , D ); Equal(D , A.ddot(A));
+      cppmat::cartesian::dot   (B, Bs, C ); Equal(C , B.dot(Bs));
+      cppmat::cartesian::dot   (Bd, Bd, Cd); Equal(Cd, Bd.dot(Bd));
+      cppmat::cartesian::dot   (B, u , w ); Equal(w , B.dot(u));
+      cppmat::cartesian::dyadic(B, Bd, D ); Equal(D , B.dyadic(Bd));
+      cppmat::cartesian::T     (B, C    ); Equal(C , B.T());
+      cppmat::cartesian::RT    (A, D    ); Equal(D , A.RT());
+      cppmat::cartesian::inv   (B, C    ); Equal(C , B.inv());
+      cppmat::cartesian::inv   (Bs, Cs  ); Equal(Cs.dot(Bs), T2::I(nd));
+    }
+  }
+}
+
 // =================================================================================================
 
 }
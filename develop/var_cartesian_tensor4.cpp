@@ -61,6 +61,48 @@ SECTION( "LT" )
           EQ( B(i,j,k,l), A(j,i,k,l) );
 }
 
+// =================================================================================================
+// tensor products
+// =================================================================================================
+
+SECTION( "T4.ddot(T4)" )
+{
+  T4 A = T4::Random(ND);
+  T4 B = T4::Random(ND);
+
+  T4 C = A.ddot(B);
+
+  for ( size_t i = 0 ; i < C.ndim() ; ++i ) {
+    for ( size_t j = 0 ; j < C.ndim() ; ++j ) {
+      for ( size_t m = 0 ; m < C.ndim() ; ++m ) {
+        for ( size_t n = 0 ; n < C.ndim() ; ++n ) {
+          double c = 0.;
+          for ( size_t k = 0 ; k < C.ndim() ; ++k )
+            for ( size_t l = 0 ; l < C.ndim() ; ++l )
+              c += A(i,j,k,l) * B(l,k,m,n);
+          EQ( C(i,j,m,n), c );
+        }
+      }
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "T2.dyadic(T2)" )
+{
+  T2 A = T2::Random(ND);
+  T2 B = T2::Random(ND);
+
+  T4 C = A.dyadic(B);
+
+  for ( size_t i = 0 ; i < C.ndim() ; ++i )
+    for ( size_t j = 0 ; j < C.ndim() ; ++j )
+      for ( size_t k = 0 ; k < C.ndim() ; ++k )
+        for ( size_t l = 0 ; l < C.ndim() ; ++l )
+          EQ( C(i,j,k,l), A(i,j) * B(k,l) );
+}
+
 // =================================================================================================
 // unit tensors
 // =================================================================================================
@@ -0,0 +1,158 @@
+
+#include "support.h"
+
+typedef cppmat::array<double>       Arr;
+typedef cppmat::halo::array<double> Halo;
+
+// periodic index
+static size_t per(int i, size_t n)
+{
+  return static_cast<size_t>( ( i + 2*static_cast<int>(n) ) % static_cast<int>(n) );
+}
+
+// =================================================================================================
+
+TEST_CASE("cppmat::halo::array", "var_halo_array.h")
+{
+
+// =================================================================================================
+
+SECTION( "Copy, interior, shape" )
+{
+  Arr  a = Arr::Random({4,5,6});
+  Halo A = Halo::Copy(a, {1,0,2});
+
+  REQUIRE( A.shape() == std::vector<size_t>({6,5,10}) );
+  REQUIRE( A.interiorShape() == a.shape() );
+  REQUIRE( A.interiorSize() == a.size() );
+  REQUIRE( A.width() == std::vector<size_t>({1,0,2}) );
+
+  for ( size_t i = 0 ; i < 4 ; ++i )
+    for ( size_t j = 0 ; j < 5 ; ++j )
+      for ( size_t k = 0 ; k < 6 ; ++k )
+        EQ( A(i,j,k), a(i,j,k) );
+
+  EQ( *A.origin(), a[0] );
+
+  Arr b = A.interior();
+
+  REQUIRE( b.shape() == a.shape() );
+
+  for ( size_t i = 0 ; i < a.size() ; ++i )
+    EQ( b[i], a[i] );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "refreshPeriodic: rank 1" )
+{
+  Arr  a = Arr::Random({7});
+  Halo A = Halo::Copy(a, 3);
+
+  A.refreshPeriodic();
+
+  for ( int i = -3 ; i < 7+3 ; ++i )
+    EQ( A(i), a(per(i,7)) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "refreshPeriodic: rank 2, including corners" )
+{
+  Arr  a = Arr::Random({5,8});
+  Halo A = Halo::Copy(a, {2,3});
+
+  A.refreshPeriodic();
+
+  for ( int i = -2 ; i < 5+2 ; ++i )
+    for ( int j = -3 ; j < 8+3 ; ++j )
+      EQ( A(i,j), a(per(i,5),per(j,8)) );
+
+  // reuse: new interior, no reallocation
+  const double *ptr = A.data();
+
+  Arr b = Arr::Random({5,8});
+
+  A.setInterior(b);
+  A.refreshPeriodic();
+
+  REQUIRE( A.data() == ptr );
+
+  for ( int i = -2 ; i < 5+2 ; ++i )
+    for ( int j = -3 ; j < 8+3 ; ++j )
+      EQ( A(i,j), b(per(i,5),per(j,8)) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "refreshPeriodic: rank 4" )
+{
+  Arr  a = Arr::Random({3,4,2,5});
+  Halo A = Halo::Copy(a, {1,2,1,1});
+
+  A.refreshPeriodic();
+
+  for ( int i = -1 ; i < 3+1 ; ++i )
+    for ( int j = -2 ; j < 4+2 ; ++j )
+      for ( int k = -1 ; k < 2+1 ; ++k )
+        for ( int l = -1 ; l < 5+1 ; ++l )
+          EQ( A(i,j,k,l), a(per(i,3),per(j,4),per(k,2),per(l,5)) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "refreshPeriodic: rank 6" )
+{
+  Arr  a = Arr::Random({2,3,2,3,2,3});
+  Halo A = Halo::Copy(a, 1);
+
+  A.refreshPeriodic();
+
+  for ( int i = -1 ; i < 2+1 ; ++i )
+    for ( int j = -1 ; j < 3+1 ; ++j )
+      for ( int k = -1 ; k < 2+1 ; ++k )
+        for ( int l = -1 ; l < 3+1 ; ++l )
+          for ( int m = -1 ; m < 2+1 ; ++m )
+            for ( int n = -1 ; n < 3+1 ; ++n )
+              EQ( A(i,j,k,l,m,n), a(per(i,2),per(j,3),per(k,2),per(l,3),per(m,2),per(n,3)) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "refreshConstant" )
+{
+  Arr  a = Arr::Random({4,6});
+  Halo A = Halo::Copy(a, {1,2});
+
+  A.refreshConstant(-1.);
+
+  for ( int i = -1 ; i < 4+1 ; ++i ) {
+    for ( int j = -2 ; j < 6+2 ; ++j ) {
+      if ( i < 0 or i >= 4 or j < 0 or j >= 6 ) EQ( A(i,j), -1. )
+      else                                      EQ( A(i,j), a(i,j) )
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "cppmat::array::pad" )
+{
+  Arr a = Arr::Random({3,4,5});
+  Arr b = a.pad({1,0,2}, 7.);
+
+  REQUIRE( b.shape() == std::vector<size_t>({5,4,9}) );
+
+  for ( size_t i = 0 ; i < 5 ; ++i ) {
+    for ( size_t j = 0 ; j < 4 ; ++j ) {
+      for ( size_t k = 0 ; k < 9 ; ++k ) {
+        if ( i < 1 or i >= 4 or k < 2 or k >= 7 ) EQ( b(i,j,k), 7. )
+        else                                      EQ( b(i,j,k), a(i-1,j,k-2) )
+      }
+    }
+  }
+}
+
+// =================================================================================================
+
+}
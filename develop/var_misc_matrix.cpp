@@ -833,6 +833,60 @@ SECTION( "diagonal::matrix * symmetric::matrix" )
   Equal(C, c);
 }
 
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "output argument" )
+{
+  MatD a = MatD::Random(M,N);
+  MatD b = makeSymmetric(MatD::Random(M,N));
+  MatD d = makeDiagonal (MatD::Random(M,N));
+
+   Mat A =  Mat::Copy     (M, N, a.data(), a.data()+a.size());
+  sMat B = sMat::CopyDense(M, N, b.data(), b.data()+b.size());
+  dMat D = dMat::CopyDense(M, N, d.data(), d.data()+d.size());
+
+   Mat C;
+  sMat S;
+
+  cppmat::add(A, B, C); Equal(C, a + b);
+  cppmat::sub(B, A, C); Equal(C, b - a);
+  cppmat::add(B, D, S); Equal(S, b + d);
+  cppmat::sub(D, B, S); Equal(S, d - b);
+
+  // the output may be one of the inputs
+  cppmat::add(A, D, A); Equal(A, a + d);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "chained arithmetic: temporaries are re-used" )
+{
+  MatD a = MatD::Random(M,N);
+  MatD b = makeSymmetric(MatD::Random(M,N));
+  MatD d = makeDiagonal (MatD::Random(M,N));
+
+   Mat A =  Mat::Copy     (M, N, a.data(), a.data()+a.size());
+  sMat B = sMat::CopyDense(M, N, b.data(), b.data()+b.size());
+  dMat D = dMat::CopyDense(M, N, d.data(), d.data()+d.size());
+
+  MatD e = ( d.array() * a.array() * b.array() ).matrix();
+
+  Equal(  B - ( A + B ), MatD( b - ( a + b ) ));
+  Equal(  D + ( B - D ), MatD( d + ( b - d ) ));
+  Equal( ( D * A ) * B , e                   );
+
+  // the storage of the temporary is returned ("M*N" entries are not stored inline)
+  Mat T = A + B;
+
+  const double *p = T.data();
+
+  Mat C = D - std::move(T);
+
+  REQUIRE( C.data() == p );
+
+  Equal(C, MatD( d - ( a + b ) ));
+}
+
 // =================================================================================================
 
 }
@@ -415,6 +415,38 @@ SECTION( "scalar / array" )
   Equal(C, c);
 }
 
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "chained arithmetic: temporaries are re-used" )
+{
+  MatD a = MatD::Random(M,N);
+  MatD b = MatD::Random(M,N) + MatD::Ones(M,N);
+
+  Arr A = Arr::Copy({M,N}, a.data(), a.data()+a.size());
+  Arr B = Arr::Copy({M,N}, b.data(), b.data()+b.size());
+
+  MatD c = MatD::Zero(M,N);
+
+  for ( size_t i = 0 ; i < M ; ++i )
+    for ( size_t j = 0 ; j < N ; ++j )
+      c(i,j) = 2. - ( a(i,j) - ( a(i,j) + b(i,j) ) * a(i,j) / 2. ) / b(i,j);
+
+  Arr C = 2. - ( A - ( A + B ) * A / 2. ) / B;
+
+  Equal(C, c);
+
+  // the storage of the temporary is returned ("M*N" entries are not stored inline)
+  Arr T = A + B;
+
+  const double *p = T.data();
+
+  Arr D = A - std::move(T);
+
+  REQUIRE( D.data() == p );
+
+  Equal(D, MatD(-b));
+}
+
 // =================================================================================================
 // algebra - partial
 // =================================================================================================
@@ -664,6 +696,52 @@ SECTION( "decompress" )
   REQUIRE( idx == jdx );
 }
 
+// =================================================================================================
+// rank > 6
+// =================================================================================================
+
+SECTION( "rank > 6" )
+{
+  // e.g. element x integration point x RVE integration point x 3 x 3 x 3 x 3
+  Arr A = Arr::Arange({4,2,3,3,3,3,3});
+
+  REQUIRE( A.rank() == 7 );
+  REQUIRE( A.size() == 4*2*3*81 );
+  REQUIRE( A.strides() == cppmat::shape_t({486,243,81,27,9,3,1}) );
+
+  // index operators, using unsigned and signed (periodic) indices
+  size_t a = 3, b = 1, c = 2, d = 0, e = 1, f = 2, g = 1;
+
+  REQUIRE( A.compress(a,b,c,d,e,f,g) == 3*486+243+2*81+9+2*3+1 );
+  REQUIRE( A(a,b,c,d,e,f,g) == static_cast<double>(A.compress(a,b,c,d,e,f,g)) );
+  REQUIRE( A(-1,-1,-1,0,1,-1,1) == A(a,b,c,d,e,f,g) );
+
+  // iterator-based access, and decompress
+  std::vector<size_t> idx = {a,b,c,d,e,f,g};
+
+  REQUIRE( A.at(idx.begin(), idx.end()) == A(a,b,c,d,e,f,g) );
+  REQUIRE( A.decompress(A.compress(a,b,c,d,e,f,g)) == idx );
+
+  // reductions
+  Arr B = A.sum(6);
+
+  REQUIRE( B.rank() == 6 );
+  REQUIRE( B(3,1,2,0,1,2) == 3. * A(a,b,c,d,e,f,0) + 3. );
+
+  EQ(A.sum(std::vector<int>{6,5,4,3}).sum(), A.sum());
+
+  // reshape to a lower rank, and back
+  Arr C = A;
+
+  C.reshape({8,3,81});
+
+  REQUIRE( C(7,2,9+2*3+1) == A(a,b,c,d,e,f,g) );
+
+  C.reshape(A.shape());
+
+  REQUIRE( C == A );
+}
+
 // =================================================================================================
 // where
 // =================================================================================================
@@ -0,0 +1,185 @@
+
+#include "support.h"
+
+static const size_t M = 11;
+static const size_t N = 9;
+
+typedef cppmat::sparse::matrix<double> spMat;
+typedef cppmat::        matrix<double> Mat;
+
+// =================================================================================================
+
+// dense matrix with roughly one third of the entries non-zero
+inline MatD makeSparse(size_t m, size_t n)
+{
+  MatD a = MatD::Random(m,n);
+
+  for ( size_t i = 0 ; i < m ; ++i )
+    for ( size_t j = 0 ; j < n ; ++j )
+      if ( (i+2*j) % 3 != 0 )
+        a(i,j) = 0.0;
+
+  return a;
+}
+
+// =================================================================================================
+
+TEST_CASE("cppmat::sparse::matrix", "var_sparse_matrix.h")
+{
+
+// =================================================================================================
+// assembly
+// =================================================================================================
+
+SECTION( "CopyDense" )
+{
+  MatD a = makeSparse(M,N);
+
+  Mat  A = Mat::Copy(M, N, a.data(), a.data()+a.size());
+
+  spMat B = spMat::CopyDense(A);
+
+  REQUIRE( B.nnz() == static_cast<size_t>((a.array() != 0.0).count()) );
+
+  for ( size_t i = 0 ; i < M ; ++i )
+    for ( size_t j = 0 ; j < N ; ++j )
+      EQ( B(i,j), a(i,j) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "add, duplicates are summed" )
+{
+  MatD a = MatD::Zero(M,N);
+
+  spMat A(M,N);
+
+  for ( size_t k = 0 ; k < 100 ; ++k )
+  {
+    size_t i = (k*7 ) % M;
+    size_t j = (k*13) % N;
+    double v = static_cast<double>(k) / 10.;
+
+    a(i,j) += v;
+    A.add(i, j, v);
+  }
+
+  REQUIRE( not A.isCompressed() );
+
+  A.compress();
+
+  REQUIRE( A.isCompressed() );
+
+  Mat B(M,N);
+
+  A.copyToDense(B.begin(), B.end());
+
+  Equal(B, a);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "Copy (triplets)" )
+{
+  std::vector<size_t> row = {0, 1, 0, 3, 1};
+  std::vector<size_t> col = {2, 1, 2, 0, 1};
+  std::vector<double> val = {1., 2., 3., 4., 5.};
+
+  spMat A = spMat::Copy(4, 3, row, col, val);
+
+  REQUIRE( A.nnz() == 3 );
+
+  EQ( A(0,2), 4. );
+  EQ( A(1,1), 7. );
+  EQ( A(3,0), 4. );
+  EQ( A(2,2), 0. );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "add element matrices" )
+{
+  // 1-d mesh of 10 two-noded elements, 2 DOFs per node
+  size_t nelem = 10;
+  size_t ndof  = 2 * (nelem+1);
+
+  MatD a = MatD::Zero(ndof,ndof);
+
+  spMat A(ndof,ndof);
+
+  for ( size_t repeat = 0 ; repeat < 2 ; ++repeat )
+  {
+    a.setZero();
+    A.setZero();
+
+    for ( size_t e = 0 ; e < nelem ; ++e )
+    {
+      MatD ke = makeSymmetric(MatD::Random(4,4));
+
+      Mat Ke = Mat::Copy(4, 4, ke.data(), ke.data()+ke.size());
+
+      std::vector<size_t> dofs = {2*e, 2*e+1, 2*e+2, 2*e+3};
+
+      for ( size_t i = 0 ; i < 4 ; ++i )
+        for ( size_t j = 0 ; j < 4 ; ++j )
+          a(dofs[i],dofs[j]) += ke(i,j);
+
+      A.add(Ke, dofs);
+    }
+
+    // in the second pass the sparsity pattern is known: no entries are buffered
+    if ( repeat == 1 ) REQUIRE( A.isCompressed() );
+
+    A.compress();
+
+    for ( size_t i = 0 ; i < ndof ; ++i )
+      for ( size_t j = 0 ; j < ndof ; ++j )
+        EQ( A(i,j), a(i,j) );
+  }
+}
+
+// =================================================================================================
+// products
+// =================================================================================================
+
+SECTION( "dot(matrix, vector)" )
+{
+  MatD a = makeSparse(M,N);
+  MatD b = MatD::Random(N,1);
+  MatD c = a * b;
+
+  spMat A = spMat::CopyDense(Mat::Copy(M, N, a.data(), a.data()+a.size()));
+
+  cppmat::vector<double> B = cppmat::vector<double>::Copy(N, b.data(), b.data()+b.size());
+
+  cppmat::vector<double> C = cppmat::sparse::dot(A, B);
+
+  REQUIRE( C.size() == M );
+
+  for ( size_t i = 0 ; i < M ; ++i )
+    EQ( C[i], c(i,0) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "dot(matrix, array)" )
+{
+  MatD a = makeSparse(M,N);
+  MatD b = MatD::Random(N,3);
+  MatD c = a * b;
+
+  spMat A = spMat::CopyDense(Mat::Copy(M, N, a.data(), a.data()+a.size()));
+
+  cppmat::array<double> B = cppmat::array<double>::Copy({N,3}, b.data(), b.data()+b.size());
+
+  cppmat::array<double> C = cppmat::sparse::dot(A, B);
+
+  REQUIRE( C.shape(0) == M );
+  REQUIRE( C.shape(1) == 3 );
+
+  Equal(C, c);
+}
+
+// =================================================================================================
+
+}
@@ -413,6 +413,27 @@ SECTION( "scalar / matrix" )
   Equal(C, c);
 }
 
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "chained arithmetic: temporaries are re-used" )
+{
+  MatD a = makeSymmetric(MatD::Random(M,N));
+  MatD b = makeSymmetric(MatD::Random(M,N) + MatD::Ones(M,N));
+
+  sMat A = sMat::CopyDense(M, N, a.data(), a.data()+a.size());
+  sMat B = sMat::CopyDense(M, N, b.data(), b.data()+b.size());
+
+  MatD c = MatD::Zero(M,N);
+
+  for ( size_t i = 0 ; i < M ; ++i )
+    for ( size_t j = 0 ; j < N ; ++j )
+      c(i,j) = 2. - ( a(i,j) - ( a(i,j) + b(i,j) ) * a(i,j) / 2. ) / b(i,j);
+
+  sMat C = 2. - ( A - ( A + B ) * A / 2. ) / B;
+
+  Equal(C, c);
+}
+
 // =================================================================================================
 // algebra
 // =================================================================================================
@@ -545,6 +566,120 @@ SECTION( "decompress" )
   REQUIRE( idx == jdx );
 }
 
+// =================================================================================================
+// packed-storage kernels
+// =================================================================================================
+
+SECTION( "rowBegin/rowEnd" )
+{
+  MatD a = makeSymmetric(MatD::Random(M,N));
+
+  sMat A = sMat::CopyDense(M, N, a.data(), a.data()+a.size());
+
+  for ( size_t i = 0 ; i < M ; ++i )
+  {
+    REQUIRE( static_cast<size_t>(A.rowEnd(i) - A.rowBegin(i)) == N-i );
+
+    size_t j = i;
+
+    for ( auto it = A.rowBegin(i) ; it != A.rowEnd(i) ; ++it, ++j )
+      EQ( *it, a(i,j) );
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "dot(matrix, vector)" )
+{
+  MatD a = makeSymmetric(MatD::Random(M,N));
+  MatD b = MatD::Random(N,1);
+
+  sMat A = sMat::CopyDense(M, N, a.data(), a.data()+a.size());
+
+  cppmat::vector<double> B = cppmat::vector<double>::Copy(N, b.data(), b.data()+b.size());
+
+  MatD c = a * b;
+
+  cppmat::vector<double> C = cppmat::symmetric::dot(A, B);
+
+  REQUIRE( C.size() == M );
+
+  for ( size_t i = 0 ; i < M ; ++i )
+    EQ( C[i], c(i,0) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "dot(matrix, dense)" )
+{
+  MatD a = makeSymmetric(MatD::Random(M,N));
+  MatD b = MatD::Random(N,7);
+
+  sMat A = sMat::CopyDense(M, N, a.data(), a.data()+a.size());
+
+  cppmat::matrix<double> B = cppmat::matrix<double>::Copy(N, 7, b.data(), b.data()+b.size());
+
+  MatD c = a * b;
+
+  cppmat::matrix<double> C = cppmat::symmetric::dot(A, B);
+
+  Equal(C, c);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "dot(dense, matrix)" )
+{
+  MatD a = MatD::Random(7,M);
+  MatD b = makeSymmetric(MatD::Random(M,N));
+
+  cppmat::matrix<double> A = cppmat::matrix<double>::Copy(7, M, a.data(), a.data()+a.size());
+
+  sMat B = sMat::CopyDense(M, N, b.data(), b.data()+b.size());
+
+  MatD c = a * b;
+
+  cppmat::matrix<double> C = cppmat::symmetric::dot(A, B);
+
+  Equal(C, c);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "syr" )
+{
+  MatD a = makeSymmetric(MatD::Random(M,N));
+  MatD x = MatD::Random(N,1);
+
+  sMat A = sMat::CopyDense(M, N, a.data(), a.data()+a.size());
+
+  cppmat::vector<double> X = cppmat::vector<double>::Copy(N, x.data(), x.data()+x.size());
+
+  MatD c = a + 2.0 * x * x.transpose();
+
+  cppmat::symmetric::syr(A, X, 2.0);
+
+  Equal(A, c);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "syrk" )
+{
+  MatD a = makeSymmetric(MatD::Random(M,N));
+  MatD b = MatD::Random(N,7);
+
+  sMat A = sMat::CopyDense(M, N, a.data(), a.data()+a.size());
+
+  cppmat::matrix<double> B = cppmat::matrix<double>::Copy(N, 7, b.data(), b.data()+b.size());
+
+  MatD c = a + 2.0 * b * b.transpose();
+
+  cppmat::symmetric::syrk(A, B, 2.0);
+
+  Equal(A, c);
+}
+
 // =================================================================================================
 
 }
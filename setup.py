@@ -8,7 +8,7 @@ depend on cppmat. There is no direct use for Python.
 '''
 
 import re, os
-from setuptools import setup
+from setuptools import setup, Extension
 
 header = open('src/cppmat/cppmat.h','r').read()
 world  = re.split(r'(.*)(\#define CPPMAT_WORLD_VERSION\ )([0-9]+)(.*)',header)[3]
@@ -17,6 +17,48 @@ minor  = re.split(r'(.*)(\#define CPPMAT_MINOR_VERSION\ )([0-9]+)(.*)',header)[3
 
 __version__ = '.'.join([world,major,minor])
 
+# optional compiled module "cppmat.batch" (batched tensor operations on NumPy-arrays), it is only
+# built if pybind11 is available, and a failing build does not prevent the installation
+ext_modules = []
+cmdclass    = {}
+
+try:
+
+  import pybind11
+  import cppmat
+
+  class BuildExtOpenMP(cppmat.BuildExt):
+
+    def build_extension(self, ext):
+      try:
+        openmp = cppmat.has_flag(self.compiler, '-fopenmp')
+      except Exception:
+        openmp = False
+      # (new lists: the arguments may be shared with other extensions)
+      if openmp:
+        ext.extra_compile_args = ext.extra_compile_args + ['-fopenmp']
+        ext.extra_link_args    = ext.extra_link_args    + ['-fopenmp']
+      cppmat.BuildExt.build_extension(self, ext)
+
+  ext_modules = [
+    Extension(
+      'cppmat.batch',
+      ['cppmat/batch.cpp'],
+      include_dirs = [
+        'src',
+        pybind11.get_include(False),
+        pybind11.get_include(True ),
+      ],
+      language = 'c++',
+      optional = True,
+    ),
+  ]
+
+  cmdclass = {'build_ext': BuildExtOpenMP}
+
+except ImportError:
+  pass
+
 setup(
   name             = 'cppmat',
   description      = 'Multidimensional arrays and tensors in C++',
@@ -34,8 +76,30 @@ setup(
     'src/cppmat/private.h',
     'src/cppmat/stl.hpp',
     'src/cppmat/stl.h',
+    'src/cppmat/small_vector.hpp',
+    'src/cppmat/small_vector.h',
+    'src/cppmat/multi_index.hpp',
+    'src/cppmat/multi_index.h',
+    'src/cppmat/simd.hpp',
+    'src/cppmat/simd.h',
+    'src/cppmat/random.hpp',
+    'src/cppmat/random.h',
     'src/cppmat/histogram.hpp',
     'src/cppmat/histogram.h',
+    'src/cppmat/moments.hpp',
+    'src/cppmat/moments.h',
+    'src/cppmat/quantile.hpp',
+    'src/cppmat/quantile.h',
+    'src/cppmat/assembly.hpp',
+    'src/cppmat/assembly.h',
+    'src/cppmat/stencil.hpp',
+    'src/cppmat/stencil.h',
+    'src/cppmat/einsum.hpp',
+    'src/cppmat/einsum.h',
+    'src/cppmat/batch.hpp',
+    'src/cppmat/batch.h',
+    'src/cppmat/mask.hpp',
+    'src/cppmat/mask.h',
     'src/cppmat/fix_cartesian.hpp',
     'src/cppmat/fix_cartesian.h',
     'src/cppmat/fix_cartesian_2.hpp',
@@ -50,6 +114,10 @@ setup(
     'src/cppmat/fix_cartesian_tensor4.h',
     'src/cppmat/fix_cartesian_vector.hpp',
     'src/cppmat/fix_cartesian_vector.h',
+    'src/cppmat/cartesian_projection.hpp',
+    'src/cppmat/cartesian_projection.h',
+    'src/cppmat/cartesian_transpose.hpp',
+    'src/cppmat/cartesian_transpose.h',
     'src/cppmat/fix_diagonal_matrix.hpp',
     'src/cppmat/fix_diagonal_matrix.h',
     'src/cppmat/fix_misc_matrix.hpp',
@@ -94,6 +162,8 @@ setup(
     'src/cppmat/var_cartesian_tensor4.h',
     'src/cppmat/var_cartesian_vector.hpp',
     'src/cppmat/var_cartesian_vector.h',
+    'src/cppmat/var_cartesian_soa.hpp',
+    'src/cppmat/var_cartesian_soa.h',
     'src/cppmat/var_diagonal_matrix.hpp',
     'src/cppmat/var_diagonal_matrix.h',
     'src/cppmat/var_misc_matrix.hpp',
@@ -104,9 +174,14 @@ setup(
     'src/cppmat/var_regular_matrix.h',
     'src/cppmat/var_regular_vector.hpp',
     'src/cppmat/var_regular_vector.h',
+    'src/cppmat/var_sparse_matrix.hpp',
+    'src/cppmat/var_sparse_matrix.h',
+    'src/cppmat/var_halo_array.hpp',
+    'src/cppmat/var_halo_array.h',
     'src/cppmat/var_symmetric_matrix.hpp',
     'src/cppmat/var_symmetric_matrix.h',
     'src/cppmat/pybind11.h',
+    'src/cppmat/pybind11_batch.hpp',
     'src/cppmat/pybind11_fix_cartesian_tensor2.hpp',
     'src/cppmat/pybind11_fix_cartesian_tensor2d.hpp',
     'src/cppmat/pybind11_fix_cartesian_tensor2s.hpp',
@@ -117,6 +192,7 @@ setup(
     'src/cppmat/pybind11_fix_regular_matrix.hpp',
     'src/cppmat/pybind11_fix_regular_vector.hpp',
     'src/cppmat/pybind11_fix_symmetric_matrix.hpp',
+    'src/cppmat/pybind11_private.hpp',
     'src/cppmat/pybind11_var_cartesian_tensor2.hpp',
     'src/cppmat/pybind11_var_cartesian_tensor2d.hpp',
     'src/cppmat/pybind11_var_cartesian_tensor2s.hpp',
@@ -127,7 +203,11 @@ setup(
     'src/cppmat/pybind11_var_regular_matrix.hpp',
     'src/cppmat/pybind11_var_regular_vector.hpp',
     'src/cppmat/pybind11_var_symmetric_matrix.hpp',
+    'src/cppmat/pybind11_view_batch.hpp',
   ],
   install_requires = ['pybind11>=2.2.0'],
+  ext_modules      = ext_modules,
+  cmdclass         = cmdclass,
+  zip_safe         = False,
 )
 
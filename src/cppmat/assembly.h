@@ -0,0 +1,75 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_ASSEMBLY_H
+#define CPPMAT_ASSEMBLY_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace assembly {
+
+// =================================================================================================
+// Batched gather/scatter for element-based assembly. Conventions:
+//
+//   conn     [nelem, nne]                  connectivity: the nodes of each element
+//   nodevec  [nnode, ndim]                 nodal vector field
+//   elemvec  [nelem, nne, ndim]            nodal vector field per element
+//   elemmat  [nelem, nne*ndim, nne*ndim]   matrix per element
+//   K        [nnode*ndim, nnode*ndim]      global matrix, the DOF of (node,i) is "node*ndim+i"
+//
+// Scatter-add operations write to nodes that are shared between elements. To run them in parallel
+// a colouring has to be provided (see "colouring"): the elements are then processed colour by
+// colour, whereby the elements of one colour (which share no nodes) are distributed over threads.
+// =================================================================================================
+
+// group elements such that the elements in each group share no nodes (greedy colouring)
+std::vector<std::vector<size_t>> colouring(const cppmat::array<size_t> &conn);
+
+// gather nodal values to elements: elemvec(e,m,i) = nodevec(conn(e,m),i)
+template<typename X>
+cppmat::array<X> gather(const cppmat::array<X> &nodevec, const cppmat::array<size_t> &conn);
+
+// scatter-add element values to nodes: nodevec(conn(e,m),i) += elemvec(e,m,i)
+template<typename X>
+void scatter_add(cppmat::array<X> &nodevec, const cppmat::array<X> &elemvec,
+  const cppmat::array<size_t> &conn);
+
+template<typename X>
+void scatter_add(cppmat::array<X> &nodevec, const cppmat::array<X> &elemvec,
+  const cppmat::array<size_t> &conn, const std::vector<std::vector<size_t>> &colours);
+
+// scatter-add element matrices to a dense global matrix
+template<typename X>
+void scatter_add(cppmat::matrix<X> &K, const cppmat::array<X> &elemmat,
+  const cppmat::array<size_t> &conn);
+
+template<typename X>
+void scatter_add(cppmat::matrix<X> &K, const cppmat::array<X> &elemmat,
+  const cppmat::array<size_t> &conn, const std::vector<std::vector<size_t>> &colours);
+
+// scatter-add element matrices to a sparse global matrix (compressed on return); the colouring is
+// only used if the sparsity pattern already contains all entries (e.g. after "setZero()")
+template<typename X>
+void scatter_add(cppmat::sparse::matrix<X> &K, const cppmat::array<X> &elemmat,
+  const cppmat::array<size_t> &conn);
+
+template<typename X>
+void scatter_add(cppmat::sparse::matrix<X> &K, const cppmat::array<X> &elemmat,
+  const cppmat::array<size_t> &conn, const std::vector<std::vector<size_t>> &colours);
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -0,0 +1,429 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_ASSEMBLY_HPP
+#define CPPMAT_ASSEMBLY_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace assembly {
+
+// =================================================================================================
+// colouring
+// =================================================================================================
+
+inline
+std::vector<std::vector<size_t>> colouring(const cppmat::array<size_t> &conn)
+{
+  assert( conn.rank() == 2 );
+
+  size_t nelem = conn.shape(0);
+  size_t nne   = conn.shape(1);
+  size_t nnode = conn.size() > 0 ? conn.max() + 1 : 0;
+
+  const size_t *c = conn.data();
+
+  // colours of the elements connected to each node
+  std::vector<std::vector<size_t>> node(nnode);
+
+  // per colour: the last element to which the colour is unavailable (stored as "element+1")
+  std::vector<size_t> mark;
+
+  // elements per colour
+  std::vector<std::vector<size_t>> out;
+
+  for ( size_t e = 0 ; e < nelem ; ++e )
+  {
+    // mark colours used by neighbours
+    for ( size_t m = 0 ; m < nne ; ++m )
+      for ( auto &colour : node[c[e*nne+m]] )
+        mark[colour] = e+1;
+
+    // select the first available colour, or start a new one
+    size_t colour = 0;
+
+    while ( colour < mark.size() and mark[colour] == e+1 ) ++colour;
+
+    if ( colour == out.size() ) {
+      out.push_back({});
+      mark.push_back(0);
+    }
+
+    // store
+    out[colour].push_back(e);
+
+    for ( size_t m = 0 ; m < nne ; ++m )
+      node[c[e*nne+m]].push_back(colour);
+  }
+
+  return out;
+}
+
+// =================================================================================================
+// gather
+// =================================================================================================
+
+template<typename X>
+inline
+cppmat::array<X> gather(const cppmat::array<X> &nodevec, const cppmat::array<size_t> &conn)
+{
+  assert( nodevec.rank() == 2 );
+  assert( conn   .rank() == 2 );
+
+  size_t nelem = conn   .shape(0);
+  size_t nne   = conn   .shape(1);
+  size_t ndim  = nodevec.shape(1);
+
+  cppmat::array<X> elemvec({nelem, nne, ndim});
+
+  const size_t *c = conn   .data();
+  const X      *u = nodevec.data();
+  X            *v = elemvec.data();
+
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for ( size_t e = 0 ; e < nelem ; ++e )
+  {
+    for ( size_t m = 0 ; m < nne ; ++m )
+    {
+      const X *ui = u + c[e*nne+m]*ndim;
+      X       *vi = v + (e*nne+m) *ndim;
+
+      for ( size_t i = 0 ; i < ndim ; ++i )
+        vi[i] = ui[i];
+    }
+  }
+
+  return elemvec;
+}
+
+// =================================================================================================
+// scatter-add : nodal vector
+// =================================================================================================
+
+template<typename X>
+inline
+void scatter_add(cppmat::array<X> &nodevec, const cppmat::array<X> &elemvec,
+  const cppmat::array<size_t> &conn)
+{
+  assert( nodevec.rank() == 2 );
+  assert( elemvec.rank() == 3 );
+  assert( conn   .rank() == 2 );
+  assert( elemvec.shape(0) == conn   .shape(0) );
+  assert( elemvec.shape(1) == conn   .shape(1) );
+  assert( elemvec.shape(2) == nodevec.shape(1) );
+
+  size_t nelem = conn   .shape(0);
+  size_t nne   = conn   .shape(1);
+  size_t ndim  = nodevec.shape(1);
+
+  const size_t *c = conn   .data();
+  const X      *v = elemvec.data();
+  X            *u = nodevec.data();
+
+  // the connectivity is stored per element, but here it is sufficient to treat it as a flat list
+  for ( size_t k = 0 ; k < nelem*nne ; ++k )
+  {
+    X       *ui = u + c[k]*ndim;
+    const X *vi = v + k   *ndim;
+
+    for ( size_t i = 0 ; i < ndim ; ++i )
+      ui[i] += vi[i];
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void scatter_add(cppmat::array<X> &nodevec, const cppmat::array<X> &elemvec,
+  const cppmat::array<size_t> &conn, const std::vector<std::vector<size_t>> &colours)
+{
+  assert( nodevec.rank() == 2 );
+  assert( elemvec.rank() == 3 );
+  assert( conn   .rank() == 2 );
+  assert( elemvec.shape(0) == conn   .shape(0) );
+  assert( elemvec.shape(1) == conn   .shape(1) );
+  assert( elemvec.shape(2) == nodevec.shape(1) );
+
+  size_t nne   = conn   .shape(1);
+  size_t ndim  = nodevec.shape(1);
+
+  const size_t *c = conn   .data();
+  const X      *v = elemvec.data();
+  X            *u = nodevec.data();
+
+  for ( auto &elem : colours )
+  {
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+    #endif
+    for ( size_t k = 0 ; k < elem.size() ; ++k )
+    {
+      size_t e = elem[k];
+
+      for ( size_t m = 0 ; m < nne ; ++m )
+      {
+        X       *ui = u + c[e*nne+m]*ndim;
+        const X *vi = v + (e*nne+m) *ndim;
+
+        for ( size_t i = 0 ; i < ndim ; ++i )
+          ui[i] += vi[i];
+      }
+    }
+  }
+}
+
+// =================================================================================================
+// support function: the DOFs of an element
+// =================================================================================================
+
+namespace Private {
+
+// dof[p] = conn(e,p/ndim)*ndim + p%ndim, for p < nne*ndim
+inline
+void elementDofs(const size_t *c, size_t e, size_t nne, size_t ndim, size_t *dof)
+{
+  for ( size_t m = 0 ; m < nne ; ++m )
+    for ( size_t i = 0 ; i < ndim ; ++i )
+      dof[m*ndim+i] = c[e*nne+m]*ndim+i;
+}
+
+} // namespace ...
+
+// =================================================================================================
+// scatter-add : dense matrix
+// =================================================================================================
+
+template<typename X>
+inline
+void scatter_add(cppmat::matrix<X> &K, const cppmat::array<X> &elemmat,
+  const cppmat::array<size_t> &conn)
+{
+  size_t nelem = conn   .shape(0);
+  size_t nne   = conn   .shape(1);
+  size_t n     = elemmat.shape(1);
+  size_t ndim  = n / nne;
+  size_t N     = K      .shape(1);
+
+  assert( elemmat.rank() == 3 );
+  assert( elemmat.shape(0) == nelem );
+  assert( elemmat.shape(2) == n );
+  assert( n == nne*ndim );
+
+  const size_t *c = conn   .data();
+  const X      *a = elemmat.data();
+  X            *k = K      .data();
+
+  std::vector<size_t> dof(n);
+
+  for ( size_t e = 0 ; e < nelem ; ++e )
+  {
+    Private::elementDofs(c, e, nne, ndim, dof.data());
+
+    for ( size_t p = 0 ; p < n ; ++p )
+    {
+      X       *kp = k + dof[p]*N;
+      const X *ap = a + (e*n+p)*n;
+
+      for ( size_t q = 0 ; q < n ; ++q )
+        kp[dof[q]] += ap[q];
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void scatter_add(cppmat::matrix<X> &K, const cppmat::array<X> &elemmat,
+  const cppmat::array<size_t> &conn, const std::vector<std::vector<size_t>> &colours)
+{
+  size_t nne   = conn   .shape(1);
+  size_t n     = elemmat.shape(1);
+  size_t ndim  = n / nne;
+  size_t N     = K      .shape(1);
+
+  assert( elemmat.rank() == 3 );
+  assert( elemmat.shape(0) == conn.shape(0) );
+  assert( elemmat.shape(2) == n );
+  assert( n == nne*ndim );
+
+  const size_t *c = conn   .data();
+  const X      *a = elemmat.data();
+  X            *k = K      .data();
+
+  #ifdef _OPENMP
+  #pragma omp parallel
+  #endif
+  {
+    std::vector<size_t> dof(n);
+
+    for ( auto &elem : colours )
+    {
+      #ifdef _OPENMP
+      #pragma omp for schedule(static)
+      #endif
+      for ( size_t l = 0 ; l < elem.size() ; ++l )
+      {
+        size_t e = elem[l];
+
+        Private::elementDofs(c, e, nne, ndim, dof.data());
+
+        for ( size_t p = 0 ; p < n ; ++p )
+        {
+          X       *kp = k + dof[p]*N;
+          const X *ap = a + (e*n+p)*n;
+
+          for ( size_t q = 0 ; q < n ; ++q )
+            kp[dof[q]] += ap[q];
+        }
+      }
+    }
+  }
+}
+
+// =================================================================================================
+// scatter-add : sparse matrix
+// =================================================================================================
+
+template<typename X>
+inline
+void scatter_add(cppmat::sparse::matrix<X> &K, const cppmat::array<X> &elemmat,
+  const cppmat::array<size_t> &conn)
+{
+  size_t nelem = conn   .shape(0);
+  size_t nne   = conn   .shape(1);
+  size_t n     = elemmat.shape(1);
+  size_t ndim  = n / nne;
+
+  assert( elemmat.rank() == 3 );
+  assert( elemmat.shape(0) == nelem );
+  assert( elemmat.shape(2) == n );
+  assert( n == nne*ndim );
+
+  const size_t *c = conn   .data();
+  const X      *a = elemmat.data();
+
+  std::vector<size_t> dof(n);
+
+  for ( size_t e = 0 ; e < nelem ; ++e )
+  {
+    Private::elementDofs(c, e, nne, ndim, dof.data());
+
+    for ( size_t p = 0 ; p < n ; ++p )
+      for ( size_t q = 0 ; q < n ; ++q )
+        K.add(dof[p], dof[q], a[(e*n+p)*n+q]);
+  }
+
+  K.compress();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void scatter_add(cppmat::sparse::matrix<X> &K, const cppmat::array<X> &elemmat,
+  const cppmat::array<size_t> &conn, const std::vector<std::vector<size_t>> &colours)
+{
+  // no sparsity pattern yet: entries have to be inserted, which is done serially
+  if ( K.nnz() == 0 or not K.isCompressed() )
+    return scatter_add(K, elemmat, conn);
+
+  size_t nne   = conn   .shape(1);
+  size_t n     = elemmat.shape(1);
+  size_t ndim  = n / nne;
+
+  assert( elemmat.rank() == 3 );
+  assert( elemmat.shape(0) == conn.shape(0) );
+  assert( elemmat.shape(2) == n );
+  assert( n == nne*ndim );
+
+  const size_t *c     = conn   .data();
+  const X      *a     = elemmat.data();
+  const size_t *outer = K.indptr();
+  const size_t *inner = K.indices();
+  X            *k     = K.data();
+
+  // entries that are not part of the sparsity pattern (as flat index in "elemmat"): added serially
+  // afterwards, in element order
+  std::vector<size_t> missing;
+
+  #ifdef _OPENMP
+  #pragma omp parallel
+  #endif
+  {
+    std::vector<size_t> dof(n);
+    std::vector<size_t> order(n);
+    std::vector<size_t> local;
+
+    for ( auto &elem : colours )
+    {
+      #ifdef _OPENMP
+      #pragma omp for schedule(static)
+      #endif
+      for ( size_t l = 0 ; l < elem.size() ; ++l )
+      {
+        size_t e = elem[l];
+
+        Private::elementDofs(c, e, nne, ndim, dof.data());
+
+        // columns in ascending order, such that each row is searched in one pass
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&dof](size_t i, size_t j) { return dof[i] < dof[j]; });
+
+        for ( size_t p = 0 ; p < n ; ++p )
+        {
+          const X *ap  = a + (e*n+p)*n;
+          size_t   j   = outer[dof[p]];
+          size_t   end = outer[dof[p]+1];
+
+          for ( auto &q : order )
+          {
+            while ( j < end and inner[j] < dof[q] ) ++j;
+
+            if ( j < end and inner[j] == dof[q] ) k[j] += ap[q];
+            else                                  local.push_back((e*n+p)*n+q);
+          }
+        }
+      }
+    }
+
+    #ifdef _OPENMP
+    #pragma omp critical
+    #endif
+    missing.insert(missing.end(), local.begin(), local.end());
+  }
+
+  // the flat index orders the entries by element
+  std::sort(missing.begin(), missing.end());
+
+  for ( auto &i : missing )
+  {
+    size_t e = i / (n*n);
+    size_t p = (i / n) % n;
+    size_t q = i % n;
+
+    K.add(c[e*nne+p/ndim]*ndim+p%ndim, c[e*nne+q/ndim]*ndim+q%ndim, a[i]);
+  }
+
+  K.compress();
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -0,0 +1,110 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_BATCH_H
+#define CPPMAT_BATCH_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace batch {
+
+// =================================================================================================
+// Operations on a batch of cartesian tensors (e.g. one per integration point). The tensors are
+// stored as the last axes of an array:
+//
+//   fourth-order tensor  [..., nd, nd, nd, nd]
+//   second-order tensor  [..., nd, nd]
+//   vector               [..., nd]
+//
+// The leading axes ("...") are the batch shape, which must be the same for all operands. The result
+// has the same batch shape (a scalar per item; an array of shape [1] for an empty batch shape). The
+// items are distributed over threads (with OpenMP). The names refer to the rank of the operands,
+// e.g. "ddot42" is "A_ijkl * B_lk".
+//
+// Each function has an overload that operates on the plain (row-major) storage of "n" items.
+// =================================================================================================
+
+// double contraction
+template<typename X> cppmat::array<X> ddot44(const cppmat::array<X> &A, const cppmat::array<X> &B);
+template<typename X> cppmat::array<X> ddot42(const cppmat::array<X> &A, const cppmat::array<X> &B);
+template<typename X> cppmat::array<X> ddot24(const cppmat::array<X> &A, const cppmat::array<X> &B);
+template<typename X> cppmat::array<X> ddot22(const cppmat::array<X> &A, const cppmat::array<X> &B);
+
+// dot product
+template<typename X> cppmat::array<X> dot22(const cppmat::array<X> &A, const cppmat::array<X> &B);
+template<typename X> cppmat::array<X> dot21(const cppmat::array<X> &A, const cppmat::array<X> &B);
+template<typename X> cppmat::array<X> dot12(const cppmat::array<X> &A, const cppmat::array<X> &B);
+template<typename X> cppmat::array<X> dot11(const cppmat::array<X> &A, const cppmat::array<X> &B);
+
+// dyadic product
+template<typename X> cppmat::array<X> dyadic22(const cppmat::array<X> &A, const cppmat::array<X> &B);
+template<typename X> cppmat::array<X> dyadic11(const cppmat::array<X> &A, const cppmat::array<X> &B);
+
+// second-order tensors: inverse, determinant, trace, deviator
+template<typename X> cppmat::array<X> inv     (const cppmat::array<X> &A);
+template<typename X> cppmat::array<X> det     (const cppmat::array<X> &A);
+template<typename X> cppmat::array<X> trace   (const cppmat::array<X> &A);
+template<typename X> cppmat::array<X> deviator(const cppmat::array<X> &A);
+
+// second-order tensors: eigen-decomposition of the symmetric part; eigenvalues "val" [..., nd] in
+// ascending order, and eigenvectors as columns of "vec" [..., nd, nd] (both resized)
+template<typename X>
+void eigs(const cppmat::array<X> &A, cppmat::array<X> &vec, cppmat::array<X> &val);
+
+// -------------------------------------------------------------------------------------------------
+// plain storage of "n" items, of "nd" dimensions ("C" may not alias the input)
+// -------------------------------------------------------------------------------------------------
+
+template<typename X> void ddot44  (const X *A, const X *B, X *C, size_t n, size_t nd);
+template<typename X> void ddot42  (const X *A, const X *B, X *C, size_t n, size_t nd);
+template<typename X> void ddot24  (const X *A, const X *B, X *C, size_t n, size_t nd);
+template<typename X> void ddot22  (const X *A, const X *B, X *C, size_t n, size_t nd);
+template<typename X> void dot22   (const X *A, const X *B, X *C, size_t n, size_t nd);
+template<typename X> void dot21   (const X *A, const X *B, X *C, size_t n, size_t nd);
+template<typename X> void dot12   (const X *A, const X *B, X *C, size_t n, size_t nd);
+template<typename X> void dot11   (const X *A, const X *B, X *C, size_t n, size_t nd);
+template<typename X> void dyadic22(const X *A, const X *B, X *C, size_t n, size_t nd);
+template<typename X> void dyadic11(const X *A, const X *B, X *C, size_t n, size_t nd);
+template<typename X> void inv     (const X *A, X *C, size_t n, size_t nd);
+template<typename X> void det     (const X *A, X *C, size_t n, size_t nd);
+template<typename X> void trace   (const X *A, X *C, size_t n, size_t nd);
+template<typename X> void deviator(const X *A, X *C, size_t n, size_t nd);
+template<typename X> void eigs    (const X *A, X *vec, X *val, size_t n, size_t nd);
+
+// -------------------------------------------------------------------------------------------------
+
+namespace Private {
+
+// number of dimensions: the size of the last axis
+size_t ndim(const cppmat::shape_t &shape);
+
+// batch shape of an array whose last "rank" axes are of size "nd" (throws if that is not the case)
+std::vector<size_t> items(const cppmat::shape_t &shape, size_t rank, size_t nd);
+
+// shape of the result: the batch shape followed by "rank" axes of size "nd"
+std::vector<size_t> shape(const std::vector<size_t> &items, size_t rank, size_t nd);
+
+// number of items
+size_t size(const std::vector<size_t> &items);
+
+// call "f(i)" for "i = 0, ..., n-1" (distributed over threads)
+template<class F> void loop(size_t n, F f);
+
+} // namespace ...
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
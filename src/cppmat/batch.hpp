@@ -0,0 +1,578 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_BATCH_HPP
+#define CPPMAT_BATCH_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace batch {
+
+// =================================================================================================
+// support functions
+// =================================================================================================
+
+namespace Private {
+
+inline
+size_t ndim(const cppmat::shape_t &shape)
+{
+  if ( shape.size() == 0 )
+    throw std::runtime_error("cppmat::batch: rank too low");
+
+  return shape.back();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+std::vector<size_t> items(const cppmat::shape_t &shape, size_t rank, size_t nd)
+{
+  if ( shape.size() < rank )
+    throw std::runtime_error("cppmat::batch: rank too low");
+
+  for ( size_t i = shape.size()-rank ; i < shape.size() ; ++i )
+    if ( shape[i] != nd )
+      throw std::runtime_error("cppmat::batch: shape mismatch");
+
+  return std::vector<size_t>(shape.begin(), shape.end()-rank);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+std::vector<size_t> shape(const std::vector<size_t> &items, size_t rank, size_t nd)
+{
+  std::vector<size_t> out = items;
+
+  for ( size_t i = 0 ; i < rank ; ++i )
+    out.push_back(nd);
+
+  if ( out.size() == 0 )
+    out.push_back(1);
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+size_t size(const std::vector<size_t> &items)
+{
+  return std::accumulate(items.begin(), items.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class F>
+inline
+void loop(size_t n, F f)
+{
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for ( size_t i = 0 ; i < n ; ++i )
+    f(i);
+}
+
+} // namespace ...
+
+// =================================================================================================
+// plain storage
+// =================================================================================================
+
+template<typename X>
+inline
+void ddot44(const X *A, const X *B, X *C, size_t n, size_t nd)
+{
+  cppmat::Private::nd_dispatch(nd, [&](auto N) {
+    Private::loop(n, [&](size_t i) {
+      cppmat::Private::ddot44<decltype(N)::value>(A+i*nd*nd*nd*nd, B+i*nd*nd*nd*nd, C+i*nd*nd*nd*nd, nd);
+    });
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void ddot42(const X *A, const X *B, X *C, size_t n, size_t nd)
+{
+  cppmat::Private::nd_dispatch(nd, [&](auto N) {
+    Private::loop(n, [&](size_t i) {
+      cppmat::Private::ddot42<decltype(N)::value>(A+i*nd*nd*nd*nd, B+i*nd*nd, C+i*nd*nd, nd);
+    });
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void ddot24(const X *A, const X *B, X *C, size_t n, size_t nd)
+{
+  cppmat::Private::nd_dispatch(nd, [&](auto N) {
+    Private::loop(n, [&](size_t i) {
+      cppmat::Private::ddot24<decltype(N)::value>(A+i*nd*nd, B+i*nd*nd*nd*nd, C+i*nd*nd, nd);
+    });
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void ddot22(const X *A, const X *B, X *C, size_t n, size_t nd)
+{
+  cppmat::Private::nd_dispatch(nd, [&](auto N) {
+    Private::loop(n, [&](size_t i) {
+      C[i] = cppmat::Private::ddot22<decltype(N)::value>(A+i*nd*nd, B+i*nd*nd, nd);
+    });
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void dot22(const X *A, const X *B, X *C, size_t n, size_t nd)
+{
+  cppmat::Private::nd_dispatch(nd, [&](auto N) {
+    Private::loop(n, [&](size_t i) {
+      cppmat::Private::dot22<decltype(N)::value>(A+i*nd*nd, B+i*nd*nd, C+i*nd*nd, nd);
+    });
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void dot21(const X *A, const X *B, X *C, size_t n, size_t nd)
+{
+  cppmat::Private::nd_dispatch(nd, [&](auto N) {
+    Private::loop(n, [&](size_t i) {
+      cppmat::Private::dot21<decltype(N)::value>(A+i*nd*nd, B+i*nd, C+i*nd, nd);
+    });
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void dot12(const X *A, const X *B, X *C, size_t n, size_t nd)
+{
+  cppmat::Private::nd_dispatch(nd, [&](auto N) {
+    Private::loop(n, [&](size_t i) {
+      cppmat::Private::dot12<decltype(N)::value>(A+i*nd, B+i*nd*nd, C+i*nd, nd);
+    });
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void dot11(const X *A, const X *B, X *C, size_t n, size_t nd)
+{
+  cppmat::Private::nd_dispatch(nd, [&](auto N) {
+    Private::loop(n, [&](size_t i) {
+      C[i] = cppmat::Private::dot11<decltype(N)::value>(A+i*nd, B+i*nd, nd);
+    });
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void dyadic22(const X *A, const X *B, X *C, size_t n, size_t nd)
+{
+  cppmat::Private::nd_dispatch(nd, [&](auto N) {
+    Private::loop(n, [&](size_t i) {
+      cppmat::Private::dyadic22<decltype(N)::value>(A+i*nd*nd, B+i*nd*nd, C+i*nd*nd*nd*nd, nd);
+    });
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void dyadic11(const X *A, const X *B, X *C, size_t n, size_t nd)
+{
+  cppmat::Private::nd_dispatch(nd, [&](auto N) {
+    Private::loop(n, [&](size_t i) {
+      cppmat::Private::dyadic11<decltype(N)::value>(A+i*nd, B+i*nd, C+i*nd*nd, nd);
+    });
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void inv(const X *A, X *C, size_t n, size_t nd)
+{
+  cppmat::Private::nd_dispatch(nd, [&](auto N) {
+    Private::loop(n, [&](size_t i) {
+      cppmat::Private::inv2<decltype(N)::value>(A+i*nd*nd, C+i*nd*nd, nd);
+    });
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void det(const X *A, X *C, size_t n, size_t nd)
+{
+  cppmat::Private::nd_dispatch(nd, [&](auto N) {
+    Private::loop(n, [&](size_t i) {
+      C[i] = cppmat::Private::det2<decltype(N)::value>(A+i*nd*nd, nd);
+    });
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void trace(const X *A, X *C, size_t n, size_t nd)
+{
+  cppmat::Private::nd_dispatch(nd, [&](auto N) {
+    Private::loop(n, [&](size_t i) {
+      C[i] = cppmat::Private::trace2<decltype(N)::value>(A+i*nd*nd, nd);
+    });
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void deviator(const X *A, X *C, size_t n, size_t nd)
+{
+  cppmat::Private::nd_dispatch(nd, [&](auto N) {
+    Private::loop(n, [&](size_t i) {
+      cppmat::Private::dev2<decltype(N)::value>(A+i*nd*nd, C+i*nd*nd, nd);
+    });
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void eigs(const X *A, X *vec, X *val, size_t n, size_t nd)
+{
+  cppmat::Private::nd_dispatch(nd, [&](auto N) {
+    Private::loop(n, [&](size_t i) {
+      cppmat::Private::eigs2<decltype(N)::value>(A+i*nd*nd, vec+i*nd*nd, val+i*nd, nd);
+    });
+  });
+}
+
+// =================================================================================================
+// cppmat::array
+// =================================================================================================
+
+template<typename X>
+inline
+cppmat::array<X> ddot44(const cppmat::array<X> &A, const cppmat::array<X> &B)
+{
+  size_t nd = Private::ndim(A.shape());
+
+  std::vector<size_t> items = Private::items(A.shape(), 4, nd);
+
+  if ( Private::items(B.shape(), 4, nd) != items )
+    throw std::runtime_error("cppmat::batch: batch shapes do not match");
+
+  cppmat::array<X> C(Private::shape(items, 4, nd));
+
+  ddot44(A.data(), B.data(), C.data(), Private::size(items), nd);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> ddot42(const cppmat::array<X> &A, const cppmat::array<X> &B)
+{
+  size_t nd = Private::ndim(A.shape());
+
+  std::vector<size_t> items = Private::items(A.shape(), 4, nd);
+
+  if ( Private::items(B.shape(), 2, nd) != items )
+    throw std::runtime_error("cppmat::batch: batch shapes do not match");
+
+  cppmat::array<X> C(Private::shape(items, 2, nd));
+
+  ddot42(A.data(), B.data(), C.data(), Private::size(items), nd);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> ddot24(const cppmat::array<X> &A, const cppmat::array<X> &B)
+{
+  size_t nd = Private::ndim(A.shape());
+
+  std::vector<size_t> items = Private::items(A.shape(), 2, nd);
+
+  if ( Private::items(B.shape(), 4, nd) != items )
+    throw std::runtime_error("cppmat::batch: batch shapes do not match");
+
+  cppmat::array<X> C(Private::shape(items, 2, nd));
+
+  ddot24(A.data(), B.data(), C.data(), Private::size(items), nd);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> ddot22(const cppmat::array<X> &A, const cppmat::array<X> &B)
+{
+  size_t nd = Private::ndim(A.shape());
+
+  std::vector<size_t> items = Private::items(A.shape(), 2, nd);
+
+  if ( Private::items(B.shape(), 2, nd) != items )
+    throw std::runtime_error("cppmat::batch: batch shapes do not match");
+
+  cppmat::array<X> C(Private::shape(items, 0, nd));
+
+  ddot22(A.data(), B.data(), C.data(), Private::size(items), nd);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> dot22(const cppmat::array<X> &A, const cppmat::array<X> &B)
+{
+  size_t nd = Private::ndim(A.shape());
+
+  std::vector<size_t> items = Private::items(A.shape(), 2, nd);
+
+  if ( Private::items(B.shape(), 2, nd) != items )
+    throw std::runtime_error("cppmat::batch: batch shapes do not match");
+
+  cppmat::array<X> C(Private::shape(items, 2, nd));
+
+  dot22(A.data(), B.data(), C.data(), Private::size(items), nd);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> dot21(const cppmat::array<X> &A, const cppmat::array<X> &B)
+{
+  size_t nd = Private::ndim(A.shape());
+
+  std::vector<size_t> items = Private::items(A.shape(), 2, nd);
+
+  if ( Private::items(B.shape(), 1, nd) != items )
+    throw std::runtime_error("cppmat::batch: batch shapes do not match");
+
+  cppmat::array<X> C(Private::shape(items, 1, nd));
+
+  dot21(A.data(), B.data(), C.data(), Private::size(items), nd);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> dot12(const cppmat::array<X> &A, const cppmat::array<X> &B)
+{
+  size_t nd = Private::ndim(A.shape());
+
+  std::vector<size_t> items = Private::items(A.shape(), 1, nd);
+
+  if ( Private::items(B.shape(), 2, nd) != items )
+    throw std::runtime_error("cppmat::batch: batch shapes do not match");
+
+  cppmat::array<X> C(Private::shape(items, 1, nd));
+
+  dot12(A.data(), B.data(), C.data(), Private::size(items), nd);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> dot11(const cppmat::array<X> &A, const cppmat::array<X> &B)
+{
+  size_t nd = Private::ndim(A.shape());
+
+  std::vector<size_t> items = Private::items(A.shape(), 1, nd);
+
+  if ( Private::items(B.shape(), 1, nd) != items )
+    throw std::runtime_error("cppmat::batch: batch shapes do not match");
+
+  cppmat::array<X> C(Private::shape(items, 0, nd));
+
+  dot11(A.data(), B.data(), C.data(), Private::size(items), nd);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> dyadic22(const cppmat::array<X> &A, const cppmat::array<X> &B)
+{
+  size_t nd = Private::ndim(A.shape());
+
+  std::vector<size_t> items = Private::items(A.shape(), 2, nd);
+
+  if ( Private::items(B.shape(), 2, nd) != items )
+    throw std::runtime_error("cppmat::batch: batch shapes do not match");
+
+  cppmat::array<X> C(Private::shape(items, 4, nd));
+
+  dyadic22(A.data(), B.data(), C.data(), Private::size(items), nd);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> dyadic11(const cppmat::array<X> &A, const cppmat::array<X> &B)
+{
+  size_t nd = Private::ndim(A.shape());
+
+  std::vector<size_t> items = Private::items(A.shape(), 1, nd);
+
+  if ( Private::items(B.shape(), 1, nd) != items )
+    throw std::runtime_error("cppmat::batch: batch shapes do not match");
+
+  cppmat::array<X> C(Private::shape(items, 2, nd));
+
+  dyadic11(A.data(), B.data(), C.data(), Private::size(items), nd);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> inv(const cppmat::array<X> &A)
+{
+  size_t nd = Private::ndim(A.shape());
+
+  std::vector<size_t> items = Private::items(A.shape(), 2, nd);
+
+  cppmat::array<X> C(Private::shape(items, 2, nd));
+
+  inv(A.data(), C.data(), Private::size(items), nd);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> det(const cppmat::array<X> &A)
+{
+  size_t nd = Private::ndim(A.shape());
+
+  std::vector<size_t> items = Private::items(A.shape(), 2, nd);
+
+  cppmat::array<X> C(Private::shape(items, 0, nd));
+
+  det(A.data(), C.data(), Private::size(items), nd);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> trace(const cppmat::array<X> &A)
+{
+  size_t nd = Private::ndim(A.shape());
+
+  std::vector<size_t> items = Private::items(A.shape(), 2, nd);
+
+  cppmat::array<X> C(Private::shape(items, 0, nd));
+
+  trace(A.data(), C.data(), Private::size(items), nd);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> deviator(const cppmat::array<X> &A)
+{
+  size_t nd = Private::ndim(A.shape());
+
+  std::vector<size_t> items = Private::items(A.shape(), 2, nd);
+
+  cppmat::array<X> C(Private::shape(items, 2, nd));
+
+  deviator(A.data(), C.data(), Private::size(items), nd);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void eigs(const cppmat::array<X> &A, cppmat::array<X> &vec, cppmat::array<X> &val)
+{
+  size_t nd = Private::ndim(A.shape());
+
+  std::vector<size_t> items = Private::items(A.shape(), 2, nd);
+
+  vec.resize(Private::shape(items, 2, nd));
+  val.resize(Private::shape(items, 1, nd));
+
+  eigs(A.data(), vec.data(), val.data(), Private::size(items), nd);
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -0,0 +1,144 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_CARTESIAN_PROJECTION_H
+#define CPPMAT_CARTESIAN_PROJECTION_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace cartesian {
+namespace projection {
+
+// =================================================================================================
+// Tags for the fourth-order projection tensors. A double contraction with a tag is evaluated in
+// closed form (e.g. as a transpose, symmetrization, or deviator), without constructing the tensor:
+//
+//   I   : I_ijkl   = delta_il * delta_jk   ->  I   : A = A
+//   Irt : Irt_ijkl = delta_ik * delta_jl   ->  Irt : A = A^T
+//   Is  : (I + Irt) / 2                    ->  Is  : A = sym(A)
+//   II  : II_ijkl  = delta_ij * delta_kl   ->  II  : A = tr(A) * I
+//   Id  : I  - II / nd                     ->  Id  : A = A - tr(A) / nd * I
+//   Isd : Is - II / nd                     ->  Isd : A = sym(A) - tr(A) / nd * I
+//
+// The number of dimensions follows from the other operand.
+// =================================================================================================
+
+struct I   {};
+struct Irt {};
+struct Is  {};
+struct II  {};
+struct Id  {};
+struct Isd {};
+
+// -------------------------------------------------------------------------------------------------
+
+// check if a type is a projection tag
+template<class P> struct is_projection : std::false_type {};
+
+template<> struct is_projection<I  > : std::true_type {};
+template<> struct is_projection<Irt> : std::true_type {};
+template<> struct is_projection<Is > : std::true_type {};
+template<> struct is_projection<II > : std::true_type {};
+template<> struct is_projection<Id > : std::true_type {};
+template<> struct is_projection<Isd> : std::true_type {};
+
+// -------------------------------------------------------------------------------------------------
+
+// dense tensor, computed once per type, number of dimensions, and thread (and then cached)
+template<typename X, class P> const cppmat::cartesian::tensor4<X>& dense(const P &, size_t nd);
+
+// =================================================================================================
+
+} // namespace ...
+
+// =================================================================================================
+// double contraction with a projection: "P : A" and "A : P"
+// =================================================================================================
+
+#define CPPMAT_PROJECTION_ENABLE(P, ...) \
+  typename std::enable_if<cppmat::cartesian::projection::is_projection<P>::value, __VA_ARGS__>::type
+
+// -------------------------------------------------------------------------------------------------
+
+template<class P, typename X>
+CPPMAT_PROJECTION_ENABLE(P, cppmat::cartesian::tensor4<X>) ddot(
+  const P &, const cppmat::cartesian::tensor4<X> &A
+);
+
+template<class P, typename X>
+CPPMAT_PROJECTION_ENABLE(P, cppmat::cartesian::tensor4<X>) ddot(
+  const cppmat::cartesian::tensor4<X> &A, const P &
+);
+
+template<class P, typename X>
+CPPMAT_PROJECTION_ENABLE(P, cppmat::cartesian::tensor2<X>) ddot(
+  const P &, const cppmat::cartesian::tensor2<X> &A
+);
+
+template<class P, typename X>
+CPPMAT_PROJECTION_ENABLE(P, cppmat::cartesian::tensor2<X>) ddot(
+  const cppmat::cartesian::tensor2<X> &A, const P &
+);
+
+template<class P, typename X>
+CPPMAT_PROJECTION_ENABLE(P, cppmat::cartesian::tensor2s<X>) ddot(
+  const P &, const cppmat::cartesian::tensor2s<X> &A
+);
+
+template<class P, typename X>
+CPPMAT_PROJECTION_ENABLE(P, cppmat::cartesian::tensor2s<X>) ddot(
+  const cppmat::cartesian::tensor2s<X> &A, const P &
+);
+
+// -------------------------------------------------------------------------------------------------
+
+template<class P, typename X, size_t ND>
+CPPMAT_PROJECTION_ENABLE(P, cppmat::tiny::cartesian::tensor4<X,ND>) ddot(
+  const P &, const cppmat::tiny::cartesian::tensor4<X,ND> &A
+);
+
+template<class P, typename X, size_t ND>
+CPPMAT_PROJECTION_ENABLE(P, cppmat::tiny::cartesian::tensor4<X,ND>) ddot(
+  const cppmat::tiny::cartesian::tensor4<X,ND> &A, const P &
+);
+
+template<class P, typename X, size_t ND>
+CPPMAT_PROJECTION_ENABLE(P, cppmat::tiny::cartesian::tensor2<X,ND>) ddot(
+  const P &, const cppmat::tiny::cartesian::tensor2<X,ND> &A
+);
+
+template<class P, typename X, size_t ND>
+CPPMAT_PROJECTION_ENABLE(P, cppmat::tiny::cartesian::tensor2<X,ND>) ddot(
+  const cppmat::tiny::cartesian::tensor2<X,ND> &A, const P &
+);
+
+template<class P, typename X, size_t ND>
+CPPMAT_PROJECTION_ENABLE(P, cppmat::tiny::cartesian::tensor2s<X,ND>) ddot(
+  const P &, const cppmat::tiny::cartesian::tensor2s<X,ND> &A
+);
+
+template<class P, typename X, size_t ND>
+CPPMAT_PROJECTION_ENABLE(P, cppmat::tiny::cartesian::tensor2s<X,ND>) ddot(
+  const cppmat::tiny::cartesian::tensor2s<X,ND> &A, const P &
+);
+
+// -------------------------------------------------------------------------------------------------
+
+#undef CPPMAT_PROJECTION_ENABLE
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -0,0 +1,396 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_CARTESIAN_PROJECTION_HPP
+#define CPPMAT_CARTESIAN_PROJECTION_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace cartesian {
+namespace projection {
+
+// =================================================================================================
+// closed-form kernels: "P : B" for a second-order tensor "B(i,j) = b[(i*nd+j)*s]" (in-place)
+// =================================================================================================
+
+namespace Private {
+
+template<typename X>
+inline
+X trace(const X *b, size_t nd, size_t s)
+{
+  X t = static_cast<X>(0);
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    t += b[(i*nd+i)*s];
+
+  return t;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void project(const I &, X *b, size_t nd, size_t s)
+{
+  UNUSED(b);
+  UNUSED(nd);
+  UNUSED(s);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void project(const Irt &, X *b, size_t nd, size_t s)
+{
+  for ( size_t i = 0 ; i < nd ; ++i )
+    for ( size_t j = i+1 ; j < nd ; ++j )
+      std::swap(b[(i*nd+j)*s], b[(j*nd+i)*s]);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void project(const Is &, X *b, size_t nd, size_t s)
+{
+  for ( size_t i = 0 ; i < nd ; ++i ) {
+    for ( size_t j = i+1 ; j < nd ; ++j ) {
+      X c = ( b[(i*nd+j)*s] + b[(j*nd+i)*s] ) / static_cast<X>(2);
+      b[(i*nd+j)*s] = c;
+      b[(j*nd+i)*s] = c;
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void project(const II &, X *b, size_t nd, size_t s)
+{
+  X t = trace(b, nd, s);
+
+  for ( size_t i = 0 ; i < nd*nd ; ++i )
+    b[i*s] = static_cast<X>(0);
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    b[(i*nd+i)*s] = t;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void project(const Id &, X *b, size_t nd, size_t s)
+{
+  X t = trace(b, nd, s) / static_cast<X>(nd);
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    b[(i*nd+i)*s] -= t;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void project(const Isd &, X *b, size_t nd, size_t s)
+{
+  project(Is(), b, nd, s);
+  project(Id(), b, nd, s);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// "P : A" for a fourth-order tensor: act on the first index-pair of each column
+template<class P, typename X>
+inline
+void projectLeft(const P &p, X *a, size_t nd)
+{
+  for ( size_t c = 0 ; c < nd*nd ; ++c )
+    project(p, a+c, nd, nd*nd);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// "A : P" for a fourth-order tensor: act on the last index-pair of each row
+template<class P, typename X>
+inline
+void projectRight(const P &p, X *a, size_t nd)
+{
+  for ( size_t r = 0 ; r < nd*nd ; ++r )
+    project(p, a+r*nd*nd, nd, 1);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// "P : A" for a symmetric second-order tensor (all projections are symmetric then)
+template<class P, class T>
+inline
+void projectSymmetric(const P &, T &A)
+{
+  UNUSED(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+void projectSymmetric(const II &, T &A)
+{
+  auto t = A.trace();
+
+  A.setZero();
+
+  for ( size_t i = 0 ; i < A.ndim() ; ++i )
+    A(i,i) = t;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+void projectSymmetric(const Id &, T &A)
+{
+  auto t = A.trace() / static_cast<decltype(A.trace())>(A.ndim());
+
+  for ( size_t i = 0 ; i < A.ndim() ; ++i )
+    A(i,i) -= t;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+void projectSymmetric(const Isd &, T &A)
+{
+  projectSymmetric(Id(), A);
+}
+
+} // namespace ...
+
+// =================================================================================================
+// dense tensor
+// =================================================================================================
+
+template<typename X, class P>
+inline
+const cppmat::cartesian::tensor4<X>& dense(const P &p, size_t nd)
+{
+  // node-based: inserting a new "nd" does not move the entries that were returned before
+  static thread_local std::map<size_t, cppmat::cartesian::tensor4<X>> cache;
+
+  auto it = cache.find(nd);
+
+  if ( it != cache.end() )
+    return it->second;
+
+  cppmat::cartesian::tensor4<X> &A = cache[nd];
+
+  A = cppmat::cartesian::tensor4<X>::I(nd);
+
+  Private::projectLeft(p, A.data(), nd);
+
+  return A;
+}
+
+// =================================================================================================
+
+} // namespace ...
+
+// =================================================================================================
+// double contraction with a projection
+// =================================================================================================
+
+#define CPPMAT_PROJECTION_ENABLE(P, ...) \
+  typename std::enable_if<cppmat::cartesian::projection::is_projection<P>::value, __VA_ARGS__>::type
+
+// =================================================================================================
+// cppmat::cartesian
+// =================================================================================================
+
+template<class P, typename X>
+inline
+CPPMAT_PROJECTION_ENABLE(P, cppmat::cartesian::tensor4<X>) ddot(
+  const P &p, const cppmat::cartesian::tensor4<X> &A
+)
+{
+  cppmat::cartesian::tensor4<X> C = A;
+
+  projection::Private::projectLeft(p, C.data(), C.ndim());
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class P, typename X>
+inline
+CPPMAT_PROJECTION_ENABLE(P, cppmat::cartesian::tensor4<X>) ddot(
+  const cppmat::cartesian::tensor4<X> &A, const P &p
+)
+{
+  cppmat::cartesian::tensor4<X> C = A;
+
+  projection::Private::projectRight(p, C.data(), C.ndim());
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class P, typename X>
+inline
+CPPMAT_PROJECTION_ENABLE(P, cppmat::cartesian::tensor2<X>) ddot(
+  const P &p, const cppmat::cartesian::tensor2<X> &A
+)
+{
+  cppmat::cartesian::tensor2<X> C = A;
+
+  projection::Private::project(p, C.data(), C.ndim(), 1);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class P, typename X>
+inline
+CPPMAT_PROJECTION_ENABLE(P, cppmat::cartesian::tensor2<X>) ddot(
+  const cppmat::cartesian::tensor2<X> &A, const P &p
+)
+{
+  return ddot(p, A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class P, typename X>
+inline
+CPPMAT_PROJECTION_ENABLE(P, cppmat::cartesian::tensor2s<X>) ddot(
+  const P &p, const cppmat::cartesian::tensor2s<X> &A
+)
+{
+  cppmat::cartesian::tensor2s<X> C = A;
+
+  projection::Private::projectSymmetric(p, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class P, typename X>
+inline
+CPPMAT_PROJECTION_ENABLE(P, cppmat::cartesian::tensor2s<X>) ddot(
+  const cppmat::cartesian::tensor2s<X> &A, const P &p
+)
+{
+  return ddot(p, A);
+}
+
+// =================================================================================================
+// cppmat::tiny::cartesian
+// =================================================================================================
+
+template<class P, typename X, size_t ND>
+inline
+CPPMAT_PROJECTION_ENABLE(P, cppmat::tiny::cartesian::tensor4<X,ND>) ddot(
+  const P &p, const cppmat::tiny::cartesian::tensor4<X,ND> &A
+)
+{
+  cppmat::tiny::cartesian::tensor4<X,ND> C = A;
+
+  projection::Private::projectLeft(p, C.data(), ND);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class P, typename X, size_t ND>
+inline
+CPPMAT_PROJECTION_ENABLE(P, cppmat::tiny::cartesian::tensor4<X,ND>) ddot(
+  const cppmat::tiny::cartesian::tensor4<X,ND> &A, const P &p
+)
+{
+  cppmat::tiny::cartesian::tensor4<X,ND> C = A;
+
+  projection::Private::projectRight(p, C.data(), ND);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class P, typename X, size_t ND>
+inline
+CPPMAT_PROJECTION_ENABLE(P, cppmat::tiny::cartesian::tensor2<X,ND>) ddot(
+  const P &p, const cppmat::tiny::cartesian::tensor2<X,ND> &A
+)
+{
+  cppmat::tiny::cartesian::tensor2<X,ND> C = A;
+
+  projection::Private::project(p, C.data(), ND, 1);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class P, typename X, size_t ND>
+inline
+CPPMAT_PROJECTION_ENABLE(P, cppmat::tiny::cartesian::tensor2<X,ND>) ddot(
+  const cppmat::tiny::cartesian::tensor2<X,ND> &A, const P &p
+)
+{
+  return ddot(p, A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class P, typename X, size_t ND>
+inline
+CPPMAT_PROJECTION_ENABLE(P, cppmat::tiny::cartesian::tensor2s<X,ND>) ddot(
+  const P &p, const cppmat::tiny::cartesian::tensor2s<X,ND> &A
+)
+{
+  cppmat::tiny::cartesian::tensor2s<X,ND> C = A;
+
+  projection::Private::projectSymmetric(p, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class P, typename X, size_t ND>
+inline
+CPPMAT_PROJECTION_ENABLE(P, cppmat::tiny::cartesian::tensor2s<X,ND>) ddot(
+  const cppmat::tiny::cartesian::tensor2s<X,ND> &A, const P &p
+)
+{
+  return ddot(p, A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+#undef CPPMAT_PROJECTION_ENABLE
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -0,0 +1,372 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_CARTESIAN_TRANSPOSE_H
+#define CPPMAT_CARTESIAN_TRANSPOSE_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace cartesian {
+namespace lazy {
+
+// =================================================================================================
+// Lazy transpositions. They refer to the storage of the tensor (which has to outlive them) and
+// permute the indices on access. The tensor products recognise them, and choose their loop order
+// accordingly, such that the transposed tensor is never constructed:
+//
+//   T  : T(A)_ijkl  = A_lkji
+//   RT : RT(A)_ijkl = A_ijlk
+//   LT : LT(A)_ijkl = A_jikl
+//   T  : T(A)_ij    = A_ji
+//
+// The number of dimensions is the template parameter "ND", or (for "ND == 0", which is the result
+// for cppmat::cartesian::...) it is set at runtime.
+// =================================================================================================
+
+enum class transposition { T, RT, LT };
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND=0>
+class tensor4
+{
+private:
+
+  const X      *mData;   // storage of the (non-transposed) tensor
+  size_t        mNd;     // number of dimensions
+  transposition mKind;   // kind of transposition
+
+public:
+
+  // constructor: refer to the storage of a tensor
+  tensor4(const X *A, size_t nd, transposition kind);
+
+  // get dimensions
+  size_t ndim() const;
+
+  // storage of the (non-transposed) tensor, and kind of transposition
+  const X*      data() const;
+  transposition kind() const;
+
+  // index operator: the entry of the transposed tensor
+  X operator()(size_t i, size_t j, size_t k, size_t l) const;
+
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND=0>
+class tensor2
+{
+private:
+
+  const X *mData;   // storage of the (non-transposed) tensor
+  size_t   mNd;     // number of dimensions
+
+public:
+
+  // constructor: refer to the storage of a tensor
+  tensor2(const X *A, size_t nd);
+
+  // get dimensions
+  size_t ndim() const;
+
+  // storage of the (non-transposed) tensor
+  const X* data() const;
+
+  // index operator: the entry of the transposed tensor
+  X operator()(size_t i, size_t j) const;
+
+};
+
+// =================================================================================================
+// construct a lazy transposition
+// =================================================================================================
+
+template<typename X> tensor4<X> T (const cppmat::cartesian::tensor4<X> &A);
+template<typename X> tensor4<X> RT(const cppmat::cartesian::tensor4<X> &A);
+template<typename X> tensor4<X> LT(const cppmat::cartesian::tensor4<X> &A);
+template<typename X> tensor2<X> T (const cppmat::cartesian::tensor2<X> &A);
+
+template<typename X, size_t ND> tensor4<X,ND> T (const cppmat::tiny::cartesian::tensor4<X,ND> &A);
+template<typename X, size_t ND> tensor4<X,ND> RT(const cppmat::tiny::cartesian::tensor4<X,ND> &A);
+template<typename X, size_t ND> tensor4<X,ND> LT(const cppmat::tiny::cartesian::tensor4<X,ND> &A);
+template<typename X, size_t ND> tensor2<X,ND> T (const cppmat::tiny::cartesian::tensor2<X,ND> &A);
+
+template<typename X, size_t ND> tensor4<X,ND> T (const cppmat::view::cartesian::tensor4<X,ND> &A);
+template<typename X, size_t ND> tensor4<X,ND> RT(const cppmat::view::cartesian::tensor4<X,ND> &A);
+template<typename X, size_t ND> tensor4<X,ND> LT(const cppmat::view::cartesian::tensor4<X,ND> &A);
+template<typename X, size_t ND> tensor2<X,ND> T (const cppmat::view::cartesian::tensor2<X,ND> &A);
+
+// =================================================================================================
+
+namespace Private {
+
+// Kernels on the (row-major) storage. A fourth-order tensor is an "nd^2 x nd^2" matrix, and "S" the
+// permutation that swaps the indices of a pair, such that "LT(A) = S A", "RT(A) = A S",
+// "T(A) = S A^t S", and "A : B = A S B". A lazy transposition is thus "S^r A^t S^c" (whereby "A^t"
+// is only used for "T"), and a product is "S^r op(A) S^m op(B) S^c". The product of the stored
+// matrices, "op(A) = A" or "op(A) = A^t", is evaluated with a loop order that depends on "op",
+// followed by a swap of the rows and/or the columns of the result (in place).
+// - "C = op(A) S^m op(B)", with "op(A) = A^t" if "ta", and "S^m = S" if "m"
+// - "c = op(A) S^m b", with "A" a fourth-order, and "b" a second-order tensor
+// - "C_ik = op(A)_ij op(B)_jk", with "A" and "B" second-order tensors
+// - "LT", "RT", and "T" (of a second-order tensor) in place
+// The output may not alias the input.
+template<size_t N=0, typename X>
+void ddot44t(const X *A, bool ta, const X *B, bool tb, bool m, X *C, size_t ndim);
+
+template<size_t N=0, typename X>
+void ddot42t(const X *A, bool ta, const X *b, bool m, X *c, size_t ndim);
+
+template<size_t N=0, typename X>
+void dot22t(const X *A, bool ta, const X *B, bool tb, X *C, size_t ndim);
+
+template<size_t N=0, typename X> void LT4(X *A, size_t ndim);
+template<size_t N=0, typename X> void RT4(X *A, size_t ndim);
+template<size_t N=0, typename X> void T2 (X *A, size_t ndim);
+
+// a fourth-order tensor as "S^r A^t S^c" (for a tensor that is not transposed all are false)
+struct transposition4 { bool t=false; bool r=false; bool c=false; };
+
+template<typename X, size_t ND> transposition4 decompose(const tensor4<X,ND> &A);
+
+// products of (lazy) transposed tensors, a second-order tensor is transposed if "ta" or "tb"
+template<size_t N=0, typename X>
+void ddot44(const X *A, transposition4 a, const X *B, transposition4 b, X *C, size_t ndim);
+
+template<size_t N=0, typename X>
+void ddot42(const X *A, transposition4 a, const X *B, bool tb, X *C, size_t ndim);
+
+template<size_t N=0, typename X>
+void ddot24(const X *A, bool ta, const X *B, transposition4 b, X *C, size_t ndim);
+
+} // namespace ...
+
+} // namespace ...
+
+// =================================================================================================
+// tensor products with lazy transpositions: cppmat::cartesian (with an output argument, see
+// "var_cartesian.h")
+// =================================================================================================
+
+template<typename X>
+void ddot(
+  const cppmat::cartesian::lazy::tensor4<X> &A, const cppmat::cartesian::tensor4<X> &B,
+  cppmat::cartesian::tensor4<X> &C
+);
+
+template<typename X>
+void ddot(
+  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::lazy::tensor4<X> &B,
+  cppmat::cartesian::tensor4<X> &C
+);
+
+template<typename X>
+void ddot(
+  const cppmat::cartesian::lazy::tensor4<X> &A, const cppmat::cartesian::lazy::tensor4<X> &B,
+  cppmat::cartesian::tensor4<X> &C
+);
+
+template<typename X>
+void ddot(
+  const cppmat::cartesian::lazy::tensor4<X> &A, const cppmat::cartesian::tensor2<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+);
+
+template<typename X>
+void ddot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::lazy::tensor4<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+);
+
+template<typename X>
+void ddot(
+  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::lazy::tensor2<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+);
+
+template<typename X>
+void ddot(
+  const cppmat::cartesian::lazy::tensor2<X> &A, const cppmat::cartesian::tensor4<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+);
+
+template<typename X>
+void dot(
+  const cppmat::cartesian::lazy::tensor2<X> &A, const cppmat::cartesian::tensor2<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+);
+
+template<typename X>
+void dot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::lazy::tensor2<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+);
+
+template<typename X>
+void dot(
+  const cppmat::cartesian::lazy::tensor2<X> &A, const cppmat::cartesian::vector<X> &B,
+  cppmat::cartesian::vector<X> &C
+);
+
+template<typename X>
+void dot(
+  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::lazy::tensor2<X> &B,
+  cppmat::cartesian::vector<X> &C
+);
+
+// =================================================================================================
+// tensor products with lazy transpositions: cppmat::cartesian
+// =================================================================================================
+
+template<typename X>
+cppmat::cartesian::tensor4<X> ddot(
+  const cppmat::cartesian::lazy::tensor4<X> &A, const cppmat::cartesian::tensor4<X> &B
+);
+
+template<typename X>
+cppmat::cartesian::tensor4<X> ddot(
+  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::lazy::tensor4<X> &B
+);
+
+template<typename X>
+cppmat::cartesian::tensor4<X> ddot(
+  const cppmat::cartesian::lazy::tensor4<X> &A, const cppmat::cartesian::lazy::tensor4<X> &B
+);
+
+template<typename X>
+cppmat::cartesian::tensor2<X> ddot(
+  const cppmat::cartesian::lazy::tensor4<X> &A, const cppmat::cartesian::tensor2<X> &B
+);
+
+template<typename X>
+cppmat::cartesian::tensor2<X> ddot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::lazy::tensor4<X> &B
+);
+
+template<typename X>
+cppmat::cartesian::tensor2<X> ddot(
+  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::lazy::tensor2<X> &B
+);
+
+template<typename X>
+cppmat::cartesian::tensor2<X> ddot(
+  const cppmat::cartesian::lazy::tensor2<X> &A, const cppmat::cartesian::tensor4<X> &B
+);
+
+template<typename X>
+X ddot(
+  const cppmat::cartesian::lazy::tensor2<X> &A, const cppmat::cartesian::tensor2<X> &B
+);
+
+template<typename X>
+X ddot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::lazy::tensor2<X> &B
+);
+
+template<typename X>
+cppmat::cartesian::tensor2<X> dot(
+  const cppmat::cartesian::lazy::tensor2<X> &A, const cppmat::cartesian::tensor2<X> &B
+);
+
+template<typename X>
+cppmat::cartesian::tensor2<X> dot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::lazy::tensor2<X> &B
+);
+
+template<typename X>
+cppmat::cartesian::vector<X> dot(
+  const cppmat::cartesian::lazy::tensor2<X> &A, const cppmat::cartesian::vector<X> &B
+);
+
+template<typename X>
+cppmat::cartesian::vector<X> dot(
+  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::lazy::tensor2<X> &B
+);
+
+// =================================================================================================
+// tensor products with lazy transpositions: cppmat::tiny::cartesian
+// =================================================================================================
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor4<X,ND> ddot(
+  const cppmat::cartesian::lazy::tensor4<X,ND> &A, const cppmat::tiny::cartesian::tensor4<X,ND> &B
+);
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor4<X,ND> ddot(
+  const cppmat::tiny::cartesian::tensor4<X,ND> &A, const cppmat::cartesian::lazy::tensor4<X,ND> &B
+);
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor4<X,ND> ddot(
+  const cppmat::cartesian::lazy::tensor4<X,ND> &A, const cppmat::cartesian::lazy::tensor4<X,ND> &B
+);
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2<X,ND> ddot(
+  const cppmat::cartesian::lazy::tensor4<X,ND> &A, const cppmat::tiny::cartesian::tensor2<X,ND> &B
+);
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2<X,ND> ddot(
+  const cppmat::tiny::cartesian::tensor2<X,ND> &A, const cppmat::cartesian::lazy::tensor4<X,ND> &B
+);
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2<X,ND> ddot(
+  const cppmat::tiny::cartesian::tensor4<X,ND> &A, const cppmat::cartesian::lazy::tensor2<X,ND> &B
+);
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2<X,ND> ddot(
+  const cppmat::cartesian::lazy::tensor2<X,ND> &A, const cppmat::tiny::cartesian::tensor4<X,ND> &B
+);
+
+template<typename X, size_t ND>
+X ddot(
+  const cppmat::cartesian::lazy::tensor2<X,ND> &A, const cppmat::tiny::cartesian::tensor2<X,ND> &B
+);
+
+template<typename X, size_t ND>
+X ddot(
+  const cppmat::tiny::cartesian::tensor2<X,ND> &A, const cppmat::cartesian::lazy::tensor2<X,ND> &B
+);
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2<X,ND> dot(
+  const cppmat::cartesian::lazy::tensor2<X,ND> &A, const cppmat::tiny::cartesian::tensor2<X,ND> &B
+);
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2<X,ND> dot(
+  const cppmat::tiny::cartesian::tensor2<X,ND> &A, const cppmat::cartesian::lazy::tensor2<X,ND> &B
+);
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::vector<X,ND> dot(
+  const cppmat::cartesian::lazy::tensor2<X,ND> &A, const cppmat::tiny::cartesian::vector<X,ND> &B
+);
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::vector<X,ND> dot(
+  const cppmat::tiny::cartesian::vector<X,ND> &A, const cppmat::cartesian::lazy::tensor2<X,ND> &B
+);
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -0,0 +1,1154 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_CARTESIAN_TRANSPOSE_HPP
+#define CPPMAT_CARTESIAN_TRANSPOSE_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace cartesian {
+namespace lazy {
+
+// =================================================================================================
+// lazy transposition of a fourth-order tensor
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+tensor4<X,ND>::tensor4(const X *A, size_t nd, transposition kind) : mData(A), mNd(ND ? ND : nd),
+  mKind(kind)
+{
+  assert( ND == 0 or nd == ND );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+size_t tensor4<X,ND>::ndim() const
+{
+  return mNd;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+const X* tensor4<X,ND>::data() const
+{
+  return mData;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+transposition tensor4<X,ND>::kind() const
+{
+  return mKind;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+X tensor4<X,ND>::operator()(size_t i, size_t j, size_t k, size_t l) const
+{
+  const size_t nd = mNd;
+
+  switch ( mKind )
+  {
+    case transposition::T  : return mData[((l*nd+k)*nd+j)*nd+i];
+    case transposition::RT : return mData[((i*nd+j)*nd+l)*nd+k];
+    default                : return mData[((j*nd+i)*nd+k)*nd+l];
+  }
+}
+
+// =================================================================================================
+// lazy transposition of a second-order tensor
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+tensor2<X,ND>::tensor2(const X *A, size_t nd) : mData(A), mNd(ND ? ND : nd)
+{
+  assert( ND == 0 or nd == ND );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+size_t tensor2<X,ND>::ndim() const
+{
+  return mNd;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+const X* tensor2<X,ND>::data() const
+{
+  return mData;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+X tensor2<X,ND>::operator()(size_t i, size_t j) const
+{
+  return mData[j*mNd+i];
+}
+
+// =================================================================================================
+// construct a lazy transposition
+// =================================================================================================
+
+template<typename X>
+inline
+tensor4<X> T(const cppmat::cartesian::tensor4<X> &A)
+{
+  return tensor4<X>(A.data(), A.ndim(), transposition::T);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor4<X> RT(const cppmat::cartesian::tensor4<X> &A)
+{
+  return tensor4<X>(A.data(), A.ndim(), transposition::RT);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor4<X> LT(const cppmat::cartesian::tensor4<X> &A)
+{
+  return tensor4<X>(A.data(), A.ndim(), transposition::LT);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor2<X> T(const cppmat::cartesian::tensor2<X> &A)
+{
+  return tensor2<X>(A.data(), A.ndim());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+tensor4<X,ND> T(const cppmat::tiny::cartesian::tensor4<X,ND> &A)
+{
+  return tensor4<X,ND>(A.data(), A.ndim(), transposition::T);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+tensor4<X,ND> RT(const cppmat::tiny::cartesian::tensor4<X,ND> &A)
+{
+  return tensor4<X,ND>(A.data(), A.ndim(), transposition::RT);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+tensor4<X,ND> LT(const cppmat::tiny::cartesian::tensor4<X,ND> &A)
+{
+  return tensor4<X,ND>(A.data(), A.ndim(), transposition::LT);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+tensor2<X,ND> T(const cppmat::tiny::cartesian::tensor2<X,ND> &A)
+{
+  return tensor2<X,ND>(A.data(), A.ndim());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+tensor4<X,ND> T(const cppmat::view::cartesian::tensor4<X,ND> &A)
+{
+  return tensor4<X,ND>(A.data(), A.ndim(), transposition::T);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+tensor4<X,ND> RT(const cppmat::view::cartesian::tensor4<X,ND> &A)
+{
+  return tensor4<X,ND>(A.data(), A.ndim(), transposition::RT);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+tensor4<X,ND> LT(const cppmat::view::cartesian::tensor4<X,ND> &A)
+{
+  return tensor4<X,ND>(A.data(), A.ndim(), transposition::LT);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+tensor2<X,ND> T(const cppmat::view::cartesian::tensor2<X,ND> &A)
+{
+  return tensor2<X,ND>(A.data(), A.ndim());
+}
+
+// =================================================================================================
+// kernels
+// =================================================================================================
+
+namespace Private {
+
+template<size_t N, typename X>
+inline
+void ddot44t(const X *A, bool ta, const X *B, bool tb, bool m, X *C, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+  const size_t n  = nd*nd;
+
+  // - "C = A S B" and "C = A B" : the kernels of the plain products
+  if ( not ta and not tb )
+  {
+    if ( m ) cppmat::Private::ddot44<N>(A, B, C, nd);
+    else     cppmat::Private::gemm(A, B, C, n, n, n);
+    return;
+  }
+
+  // - "C(r,c) = A(r,q) * B(c,s(q))" : inner products of rows
+  if ( not ta and tb )
+  {
+    for ( size_t r = 0 ; r < n ; ++r )
+    {
+      for ( size_t c = 0 ; c < n ; ++c )
+      {
+        const X *a = A + r*n;
+        const X *b = B + c*n;
+        X        x = static_cast<X>(0);
+
+        for ( size_t k = 0 ; k < nd ; ++k )
+          for ( size_t l = 0 ; l < nd ; ++l )
+            x += a[k*nd+l] * b[ m ? l*nd+k : k*nd+l ];
+
+        C[r*n+c] = x;
+      }
+    }
+    return;
+  }
+
+  std::fill(C, C+n*n, static_cast<X>(0));
+
+  // - "C(r,:) += A(q,r) * B(s(q),:)" : rows of "B" scaled by the rows of "A"
+  if ( ta and not tb )
+  {
+    for ( size_t k = 0 ; k < nd ; ++k )
+    {
+      for ( size_t l = 0 ; l < nd ; ++l )
+      {
+        const X *a = A + (k*nd+l)*n;
+        const X *b = B + ( m ? l*nd+k : k*nd+l )*n;
+
+        for ( size_t r = 0 ; r < n ; ++r )
+        {
+          const X  ar = a[r];
+          X       *c  = C + r*n;
+
+          for ( size_t j = 0 ; j < n ; ++j )
+            c[j] += ar * b[j];
+        }
+      }
+    }
+    return;
+  }
+
+  // - "C(:,c) += A(q,:) * B(c,s(q))" : rows of "A" scaled by the rows of "B"
+  for ( size_t c = 0 ; c < n ; ++c )
+  {
+    const X *b = B + c*n;
+
+    for ( size_t k = 0 ; k < nd ; ++k )
+    {
+      for ( size_t l = 0 ; l < nd ; ++l )
+      {
+        const X  bq = b[ m ? l*nd+k : k*nd+l ];
+        const X *a  = A + (k*nd+l)*n;
+
+        for ( size_t r = 0 ; r < n ; ++r )
+          C[r*n+c] += a[r] * bq;
+      }
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void ddot42t(const X *A, bool ta, const X *b, bool m, X *c, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+  const size_t n  = nd*nd;
+
+  // - "c(r) = A(r,q) * b(s(q))" : inner products with the rows of "A"
+  if ( not ta )
+  {
+    for ( size_t r = 0 ; r < n ; ++r )
+    {
+      const X *a = A + r*n;
+      X        x = static_cast<X>(0);
+
+      for ( size_t k = 0 ; k < nd ; ++k )
+        for ( size_t l = 0 ; l < nd ; ++l )
+          x += a[k*nd+l] * b[ m ? l*nd+k : k*nd+l ];
+
+      c[r] = x;
+    }
+    return;
+  }
+
+  // - "c(:) += A(q,:) * b(s(q))" : rows of "A" scaled
+  std::fill(c, c+n, static_cast<X>(0));
+
+  for ( size_t k = 0 ; k < nd ; ++k )
+  {
+    for ( size_t l = 0 ; l < nd ; ++l )
+    {
+      const X  bq = b[ m ? l*nd+k : k*nd+l ];
+      const X *a  = A + (k*nd+l)*n;
+
+      for ( size_t r = 0 ; r < n ; ++r )
+        c[r] += a[r] * bq;
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void dot22t(const X *A, bool ta, const X *B, bool tb, X *C, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+
+  // - "C = A B"
+  if ( not ta and not tb )
+  {
+    cppmat::Private::dot22<N>(A, B, C, nd);
+    return;
+  }
+
+  // - "C = A^t B^t = (B A)^t"
+  if ( ta and tb )
+  {
+    cppmat::Private::dot22<N>(B, A, C, nd);
+    T2<N>(C, nd);
+    return;
+  }
+
+  // - "C_ik = A_ij B_kj" : inner products of rows
+  if ( tb )
+  {
+    for ( size_t i = 0 ; i < nd ; ++i )
+    {
+      for ( size_t k = 0 ; k < nd ; ++k )
+      {
+        X x = static_cast<X>(0);
+
+        for ( size_t j = 0 ; j < nd ; ++j )
+          x += A[i*nd+j] * B[k*nd+j];
+
+        C[i*nd+k] = x;
+      }
+    }
+    return;
+  }
+
+  // - "C_ik = A_ji B_jk" : rows of "B" scaled by the rows of "A"
+  std::fill(C, C+nd*nd, static_cast<X>(0));
+
+  for ( size_t j = 0 ; j < nd ; ++j )
+    for ( size_t i = 0 ; i < nd ; ++i )
+      for ( size_t k = 0 ; k < nd ; ++k )
+        C[i*nd+k] += A[j*nd+i] * B[j*nd+k];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void LT4(X *A, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+  const size_t n  = nd*nd;
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    for ( size_t j = i+1 ; j < nd ; ++j )
+      std::swap_ranges(A+(i*nd+j)*n, A+(i*nd+j+1)*n, A+(j*nd+i)*n);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void RT4(X *A, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+  const size_t n  = nd*nd;
+
+  for ( size_t r = 0 ; r < n ; ++r )
+    for ( size_t k = 0 ; k < nd ; ++k )
+      for ( size_t l = k+1 ; l < nd ; ++l )
+        std::swap(A[r*n+k*nd+l], A[r*n+l*nd+k]);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void T2(X *A, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    for ( size_t j = i+1 ; j < nd ; ++j )
+      std::swap(A[i*nd+j], A[j*nd+i]);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+transposition4 decompose(const tensor4<X,ND> &A)
+{
+  transposition4 out;
+
+  switch ( A.kind() )
+  {
+    case transposition::T  : out.t = true; out.r = true; out.c = true; break;
+    case transposition::RT : out.c = true; break;
+    case transposition::LT : out.r = true; break;
+  }
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void ddot44(const X *A, transposition4 a, const X *B, transposition4 b, X *C, size_t ndim)
+{
+  // "C = S^a.r op(A) S^(a.c+1+b.r) op(B) S^b.c"
+  ddot44t<N>(A, a.t, B, b.t, a.c == b.r, C, ndim);
+
+  if ( a.r ) LT4<N>(C, ndim);
+  if ( b.c ) RT4<N>(C, ndim);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void ddot42(const X *A, transposition4 a, const X *B, bool tb, X *C, size_t ndim)
+{
+  // "C = S^a.r op(A) S^(a.c+1+tb) B"
+  ddot42t<N>(A, a.t, B, a.c == tb, C, ndim);
+
+  if ( a.r ) T2<N>(C, ndim);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void ddot24(const X *A, bool ta, const X *B, transposition4 b, X *C, size_t ndim)
+{
+  // "C^t = A^t S^(ta+1+b.r) op(B) S^b.c", i.e. "C = S^b.c op(B)^t S^(ta+1+b.r) A"
+  ddot42t<N>(B, not b.t, A, ta == b.r, C, ndim);
+
+  if ( b.c ) T2<N>(C, ndim);
+}
+
+} // namespace ...
+
+// =================================================================================================
+
+} // namespace ...
+
+// =================================================================================================
+// tensor products with lazy transpositions: cppmat::cartesian (with an output argument)
+// =================================================================================================
+
+template<typename X>
+inline
+void ddot(
+  const cppmat::cartesian::lazy::tensor4<X> &A, const cppmat::cartesian::tensor4<X> &B,
+  cppmat::cartesian::tensor4<X> &C
+)
+{
+  assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
+
+  size_t ND = A.ndim();
+
+  C.resize(ND);
+
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::cartesian::lazy::Private::ddot44<decltype(
+      N)::value>(A.data(), cppmat::cartesian::lazy::Private::decompose(A), B.data(), {}, C.data(),
+      ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void ddot(
+  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::lazy::tensor4<X> &B,
+  cppmat::cartesian::tensor4<X> &C
+)
+{
+  assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
+
+  size_t ND = A.ndim();
+
+  C.resize(ND);
+
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::cartesian::lazy::Private::ddot44<decltype(
+      N)::value>(A.data(), {}, B.data(), cppmat::cartesian::lazy::Private::decompose(B), C.data(),
+      ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void ddot(
+  const cppmat::cartesian::lazy::tensor4<X> &A, const cppmat::cartesian::lazy::tensor4<X> &B,
+  cppmat::cartesian::tensor4<X> &C
+)
+{
+  assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
+
+  size_t ND = A.ndim();
+
+  C.resize(ND);
+
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::cartesian::lazy::Private::ddot44<decltype(
+      N)::value>(A.data(), cppmat::cartesian::lazy::Private::decompose(A), B.data(),
+      cppmat::cartesian::lazy::Private::decompose(B), C.data(), ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void ddot(
+  const cppmat::cartesian::lazy::tensor4<X> &A, const cppmat::cartesian::tensor2<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+)
+{
+  assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
+
+  size_t ND = A.ndim();
+
+  C.resize(ND);
+
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::cartesian::lazy::Private::ddot42<decltype(
+      N)::value>(A.data(), cppmat::cartesian::lazy::Private::decompose(A), B.data(), false,
+      C.data(), ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void ddot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::lazy::tensor4<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+)
+{
+  assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
+
+  size_t ND = A.ndim();
+
+  C.resize(ND);
+
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::cartesian::lazy::Private::ddot24<decltype(
+      N)::value>(A.data(), false, B.data(), cppmat::cartesian::lazy::Private::decompose(B),
+      C.data(), ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void ddot(
+  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::lazy::tensor2<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+)
+{
+  assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
+
+  size_t ND = A.ndim();
+
+  C.resize(ND);
+
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::cartesian::lazy::Private::ddot42<decltype(
+      N)::value>(A.data(), {}, B.data(), true, C.data(), ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void ddot(
+  const cppmat::cartesian::lazy::tensor2<X> &A, const cppmat::cartesian::tensor4<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+)
+{
+  assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
+
+  size_t ND = A.ndim();
+
+  C.resize(ND);
+
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::cartesian::lazy::Private::ddot24<decltype(
+      N)::value>(A.data(), true, B.data(), {}, C.data(), ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void dot(
+  const cppmat::cartesian::lazy::tensor2<X> &A, const cppmat::cartesian::tensor2<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+)
+{
+  assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
+
+  size_t ND = A.ndim();
+
+  C.resize(ND);
+
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::cartesian::lazy::Private::dot22t<decltype(
+      N)::value>(A.data(), true, B.data(), false, C.data(), ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void dot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::lazy::tensor2<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+)
+{
+  assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
+
+  size_t ND = A.ndim();
+
+  C.resize(ND);
+
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::cartesian::lazy::Private::dot22t<decltype(
+      N)::value>(A.data(), false, B.data(), true, C.data(), ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void dot(
+  const cppmat::cartesian::lazy::tensor2<X> &A, const cppmat::cartesian::vector<X> &B,
+  cppmat::cartesian::vector<X> &C
+)
+{
+  assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
+
+  size_t ND = A.ndim();
+
+  C.resize(ND);
+
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::Private::dot12<decltype(N)::value>(B.data(), A.data(), C.data(), ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void dot(
+  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::lazy::tensor2<X> &B,
+  cppmat::cartesian::vector<X> &C
+)
+{
+  assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
+
+  size_t ND = A.ndim();
+
+  C.resize(ND);
+
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::Private::dot21<decltype(N)::value>(B.data(), A.data(), C.data(), ND);
+  });
+}
+
+// =================================================================================================
+// tensor products with lazy transpositions: cppmat::cartesian
+// =================================================================================================
+
+template<typename X>
+inline
+cppmat::cartesian::tensor4<X> ddot(
+  const cppmat::cartesian::lazy::tensor4<X> &A, const cppmat::cartesian::tensor4<X> &B
+)
+{
+  cppmat::cartesian::tensor4<X> C;
+
+  ddot(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor4<X> ddot(
+  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::lazy::tensor4<X> &B
+)
+{
+  cppmat::cartesian::tensor4<X> C;
+
+  ddot(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor4<X> ddot(
+  const cppmat::cartesian::lazy::tensor4<X> &A, const cppmat::cartesian::lazy::tensor4<X> &B
+)
+{
+  cppmat::cartesian::tensor4<X> C;
+
+  ddot(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2<X> ddot(
+  const cppmat::cartesian::lazy::tensor4<X> &A, const cppmat::cartesian::tensor2<X> &B
+)
+{
+  cppmat::cartesian::tensor2<X> C;
+
+  ddot(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2<X> ddot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::lazy::tensor4<X> &B
+)
+{
+  cppmat::cartesian::tensor2<X> C;
+
+  ddot(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2<X> ddot(
+  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::lazy::tensor2<X> &B
+)
+{
+  cppmat::cartesian::tensor2<X> C;
+
+  ddot(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2<X> ddot(
+  const cppmat::cartesian::lazy::tensor2<X> &A, const cppmat::cartesian::tensor4<X> &B
+)
+{
+  cppmat::cartesian::tensor2<X> C;
+
+  ddot(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X ddot(
+  const cppmat::cartesian::lazy::tensor2<X> &A, const cppmat::cartesian::tensor2<X> &B
+)
+{
+  assert( A.ndim() == B.ndim() );
+
+  size_t ND = A.ndim();
+
+  // "A_ji * B_ji"
+  return std::inner_product(A.data(), A.data()+ND*ND, B.data(), static_cast<X>(0));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X ddot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::lazy::tensor2<X> &B
+)
+{
+  assert( A.ndim() == B.ndim() );
+
+  size_t ND = A.ndim();
+
+  // "A_ji * B_ji"
+  return std::inner_product(A.data(), A.data()+ND*ND, B.data(), static_cast<X>(0));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2<X> dot(
+  const cppmat::cartesian::lazy::tensor2<X> &A, const cppmat::cartesian::tensor2<X> &B
+)
+{
+  cppmat::cartesian::tensor2<X> C;
+
+  dot(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2<X> dot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::lazy::tensor2<X> &B
+)
+{
+  cppmat::cartesian::tensor2<X> C;
+
+  dot(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::vector<X> dot(
+  const cppmat::cartesian::lazy::tensor2<X> &A, const cppmat::cartesian::vector<X> &B
+)
+{
+  cppmat::cartesian::vector<X> C;
+
+  dot(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::vector<X> dot(
+  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::lazy::tensor2<X> &B
+)
+{
+  cppmat::cartesian::vector<X> C;
+
+  dot(A, B, C);
+
+  return C;
+}
+
+// =================================================================================================
+// tensor products with lazy transpositions: cppmat::tiny::cartesian
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor4<X,ND> ddot(
+  const cppmat::cartesian::lazy::tensor4<X,ND> &A, const cppmat::tiny::cartesian::tensor4<X,ND> &B
+)
+{
+  cppmat::tiny::cartesian::tensor4<X,ND> C;
+
+  cppmat::cartesian::lazy::Private::ddot44<ND>(
+    A.data(), cppmat::cartesian::lazy::Private::decompose(A), B.data(), {}, C.data(), ND);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor4<X,ND> ddot(
+  const cppmat::tiny::cartesian::tensor4<X,ND> &A, const cppmat::cartesian::lazy::tensor4<X,ND> &B
+)
+{
+  cppmat::tiny::cartesian::tensor4<X,ND> C;
+
+  cppmat::cartesian::lazy::Private::ddot44<ND>(
+    A.data(), {}, B.data(), cppmat::cartesian::lazy::Private::decompose(B), C.data(), ND);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor4<X,ND> ddot(
+  const cppmat::cartesian::lazy::tensor4<X,ND> &A, const cppmat::cartesian::lazy::tensor4<X,ND> &B
+)
+{
+  cppmat::tiny::cartesian::tensor4<X,ND> C;
+
+  cppmat::cartesian::lazy::Private::ddot44<ND>(
+    A.data(), cppmat::cartesian::lazy::Private::decompose(A), B.data(),
+    cppmat::cartesian::lazy::Private::decompose(B), C.data(), ND);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2<X,ND> ddot(
+  const cppmat::cartesian::lazy::tensor4<X,ND> &A, const cppmat::tiny::cartesian::tensor2<X,ND> &B
+)
+{
+  cppmat::tiny::cartesian::tensor2<X,ND> C;
+
+  cppmat::cartesian::lazy::Private::ddot42<ND>(
+    A.data(), cppmat::cartesian::lazy::Private::decompose(A), B.data(), false, C.data(), ND);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2<X,ND> ddot(
+  const cppmat::tiny::cartesian::tensor2<X,ND> &A, const cppmat::cartesian::lazy::tensor4<X,ND> &B
+)
+{
+  cppmat::tiny::cartesian::tensor2<X,ND> C;
+
+  cppmat::cartesian::lazy::Private::ddot24<ND>(
+    A.data(), false, B.data(), cppmat::cartesian::lazy::Private::decompose(B), C.data(), ND);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2<X,ND> ddot(
+  const cppmat::tiny::cartesian::tensor4<X,ND> &A, const cppmat::cartesian::lazy::tensor2<X,ND> &B
+)
+{
+  cppmat::tiny::cartesian::tensor2<X,ND> C;
+
+  cppmat::cartesian::lazy::Private::ddot42<ND>(A.data(), {}, B.data(), true, C.data(), ND);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2<X,ND> ddot(
+  const cppmat::cartesian::lazy::tensor2<X,ND> &A, const cppmat::tiny::cartesian::tensor4<X,ND> &B
+)
+{
+  cppmat::tiny::cartesian::tensor2<X,ND> C;
+
+  cppmat::cartesian::lazy::Private::ddot24<ND>(A.data(), true, B.data(), {}, C.data(), ND);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+X ddot(
+  const cppmat::cartesian::lazy::tensor2<X,ND> &A, const cppmat::tiny::cartesian::tensor2<X,ND> &B
+)
+{
+  // "A_ji * B_ji"
+  return std::inner_product(A.data(), A.data()+ND*ND, B.data(), static_cast<X>(0));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+X ddot(
+  const cppmat::tiny::cartesian::tensor2<X,ND> &A, const cppmat::cartesian::lazy::tensor2<X,ND> &B
+)
+{
+  // "A_ji * B_ji"
+  return std::inner_product(A.data(), A.data()+ND*ND, B.data(), static_cast<X>(0));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2<X,ND> dot(
+  const cppmat::cartesian::lazy::tensor2<X,ND> &A, const cppmat::tiny::cartesian::tensor2<X,ND> &B
+)
+{
+  cppmat::tiny::cartesian::tensor2<X,ND> C;
+
+  cppmat::cartesian::lazy::Private::dot22t<ND>(A.data(), true, B.data(), false, C.data(), ND);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2<X,ND> dot(
+  const cppmat::tiny::cartesian::tensor2<X,ND> &A, const cppmat::cartesian::lazy::tensor2<X,ND> &B
+)
+{
+  cppmat::tiny::cartesian::tensor2<X,ND> C;
+
+  cppmat::cartesian::lazy::Private::dot22t<ND>(A.data(), false, B.data(), true, C.data(), ND);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::vector<X,ND> dot(
+  const cppmat::cartesian::lazy::tensor2<X,ND> &A, const cppmat::tiny::cartesian::vector<X,ND> &B
+)
+{
+  cppmat::tiny::cartesian::vector<X,ND> C;
+
+  cppmat::Private::dot12<ND>(B.data(), A.data(), C.data(), ND);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::vector<X,ND> dot(
+  const cppmat::tiny::cartesian::vector<X,ND> &A, const cppmat::cartesian::lazy::tensor2<X,ND> &B
+)
+{
+  cppmat::tiny::cartesian::vector<X,ND> C;
+
+  cppmat::Private::dot21<ND>(B.data(), A.data(), C.data(), ND);
+
+  return C;
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
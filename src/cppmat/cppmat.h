@@ -10,18 +10,34 @@
 // =================================================================================================
 
 #include <algorithm>
+#include <atomic>
 #include <assert.h>
+#include <cctype>
 #include <cmath>
 #include <cstdlib>
+#include <cstdint>
 #include <iostream>
 #include <iomanip>
+#include <initializer_list>
+#include <limits>
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 #include <numeric>
 #include <random>
 #include <ctime>
+#include <tuple>
+#include <type_traits>
+#include <iterator>
+#include <utility>
+#include <mutex>
 #include <iso646.h> // to fix a Microsoft Visual Studio error on "and" and "or"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 // =================================================================================================
 
 #define CPPMAT_WORLD_VERSION 1
@@ -73,6 +89,24 @@ namespace diagonal {
 
 // -------------------------------------------------------------------------------------------------
 
+namespace cppmat {
+namespace sparse {
+
+  template<typename X> class matrix;
+
+}}
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace halo {
+
+  template<typename X> class array;
+
+}}
+
+// -------------------------------------------------------------------------------------------------
+
 namespace cppmat {
 namespace cartesian {
 
@@ -86,6 +120,18 @@ namespace cartesian {
 
 // -------------------------------------------------------------------------------------------------
 
+namespace cppmat {
+namespace cartesian {
+namespace soa {
+
+  template<typename X> class tensor4;
+  template<typename X> class tensor2;
+  template<typename X> class vector;
+
+}}}
+
+// -------------------------------------------------------------------------------------------------
+
 namespace cppmat {
 namespace tiny {
 
@@ -177,12 +223,25 @@ namespace cartesian {
 // =================================================================================================
 
 #include "stl.h"
+#include "small_vector.h"
+#include "multi_index.h"
+#include "simd.h"
+#include "random.h"
 #include "private.h"
 #include "histogram.h"
+#include "moments.h"
+#include "quantile.h"
+#include "assembly.h"
+#include "stencil.h"
+#include "einsum.h"
+#include "batch.h"
+#include "mask.h"
 
 #include "var_regular_array.h"
 #include "var_regular_matrix.h"
 #include "var_regular_vector.h"
+#include "var_sparse_matrix.h"
+#include "var_halo_array.h"
 #include "var_symmetric_matrix.h"
 #include "var_diagonal_matrix.h"
 #include "var_misc_matrix.h"
@@ -192,6 +251,7 @@ namespace cartesian {
 #include "var_cartesian_tensor2s.h"
 #include "var_cartesian_tensor2d.h"
 #include "var_cartesian_vector.h"
+#include "var_cartesian_soa.h"
 
 #include "fix_regular_array.h"
 #include "fix_regular_matrix.h"
@@ -205,6 +265,8 @@ namespace cartesian {
 #include "fix_cartesian_tensor2s.h"
 #include "fix_cartesian_tensor2d.h"
 #include "fix_cartesian_vector.h"
+#include "cartesian_projection.h"
+#include "cartesian_transpose.h"
 
 #include "map_regular_array.h"
 #include "map_regular_matrix.h"
@@ -218,12 +280,25 @@ namespace cartesian {
 #include "map_cartesian_vector.h"
 
 #include "stl.hpp"
+#include "small_vector.hpp"
+#include "multi_index.hpp"
+#include "simd.hpp"
+#include "random.hpp"
 #include "private.hpp"
 #include "histogram.hpp"
+#include "moments.hpp"
+#include "quantile.hpp"
+#include "assembly.hpp"
+#include "stencil.hpp"
+#include "einsum.hpp"
+#include "batch.hpp"
+#include "mask.hpp"
 
 #include "var_regular_array.hpp"
 #include "var_regular_matrix.hpp"
 #include "var_regular_vector.hpp"
+#include "var_sparse_matrix.hpp"
+#include "var_halo_array.hpp"
 #include "var_symmetric_matrix.hpp"
 #include "var_diagonal_matrix.hpp"
 #include "var_misc_matrix.hpp"
@@ -233,6 +308,7 @@ namespace cartesian {
 #include "var_cartesian_tensor2s.hpp"
 #include "var_cartesian_tensor2d.hpp"
 #include "var_cartesian_vector.hpp"
+#include "var_cartesian_soa.hpp"
 
 #include "fix_regular_array.hpp"
 #include "fix_regular_matrix.hpp"
@@ -248,6 +324,8 @@ namespace cartesian {
 #include "fix_cartesian_tensor2s.hpp"
 #include "fix_cartesian_tensor2d.hpp"
 #include "fix_cartesian_vector.hpp"
+#include "cartesian_projection.hpp"
+#include "cartesian_transpose.hpp"
 
 #include "map_regular_array.hpp"
 #include "map_regular_matrix.hpp"
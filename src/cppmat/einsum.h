@@ -0,0 +1,144 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_EINSUM_H
+#define CPPMAT_EINSUM_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+
+// =================================================================================================
+// Einstein summation, e.g. "ij,jk->ik" (matrix product) or "ijkl,lk->ij" (double contraction).
+//
+// - The labels are letters. Labels that are not in the output are summed. A label that is repeated
+//   within one operand takes the diagonal.
+// - Without "->" the output consists of the labels that occur only once, in alphabetical order.
+// - An output without labels (a full contraction) is returned as an array of shape [1].
+//
+// cppmat::array : the subscripts are parsed at runtime. Operands are contracted pairwise, in the
+//                 order that minimizes the number of operations, whereby each pair is lowered to a
+//                 (batched) matrix product.
+//
+// cppmat::tiny  : the subscripts are parsed at compile time (also the shape of the output follows),
+//                 from a type that has "static constexpr const char* value()", e.g.:
+//
+//                   C = cppmat::einsum(CPPMAT_SUBSCRIPTS("ij,jk->ik"), A, B);
+// =================================================================================================
+
+template<typename X>
+cppmat::array<X> einsum(const std::string &subscripts, const cppmat::array<X> &A);
+
+template<typename X>
+cppmat::array<X> einsum(const std::string &subscripts, const cppmat::array<X> &A,
+  const cppmat::array<X> &B);
+
+template<typename X, class... Arrays>
+cppmat::array<X> einsum(const std::string &subscripts, const cppmat::array<X> &A,
+  const cppmat::array<X> &B, const cppmat::array<X> &C, const Arrays&... operands);
+
+// -------------------------------------------------------------------------------------------------
+
+namespace Private {
+
+// operand during evaluation: labels, shape, and data (owned or borrowed)
+template<typename X>
+struct einsum_operand
+{
+  std::string         labels;
+  std::vector<size_t> shape;
+  std::vector<X>      store;
+  const X*            borrowed=nullptr;
+
+  const X* data() const { return borrowed ? borrowed : store.data(); }
+};
+
+// evaluate (runtime)
+template<typename X>
+cppmat::array<X> einsum(const std::string &subscripts, const std::vector<const cppmat::array<X>*> &A);
+
+// loop over an index space of "n" axes "dim", accumulating "C[.] += A[.] * B[.]", whereby the
+// strides of each array are specified per axis ("0" if the axis is not in the array, "B" optional)
+template<typename X>
+void einsum_loop(size_t n, const size_t *dim, const X *A, const size_t *sa, const X *B,
+  const size_t *sb, X *C, const size_t *sc);
+
+// evaluation plan, computed at compile time: the unique labels and their strides in each array
+struct einsum_plan
+{
+  size_t n;        // number of unique labels
+  size_t dim[12];  // size of each label
+  size_t sa [12];  // stride in "A"
+  size_t sb [12];  // stride in "B"
+  size_t sc [12];  // stride in the output
+  size_t rank;     // rank of the output
+  size_t odim[6];  // shape of the output
+
+  constexpr size_t out(size_t i) const { return odim[i]; }
+};
+
+// compute the evaluation plan (a compilation error results from invalid subscripts)
+constexpr einsum_plan einsum_plan_make(const char *s, size_t nop,
+  size_t RA, size_t IA, size_t JA, size_t KA, size_t LA, size_t MA, size_t NA,
+  size_t RB, size_t IB, size_t JB, size_t KB, size_t LB, size_t MB, size_t NB);
+
+// plan for given subscripts and operands
+template<class S, size_t nop,
+  size_t RA, size_t IA, size_t JA, size_t KA, size_t LA, size_t MA, size_t NA,
+  size_t RB, size_t IB, size_t JB, size_t KB, size_t LB, size_t MB, size_t NB>
+struct einsum_tiny
+{
+  static constexpr einsum_plan plan()
+  {
+    return einsum_plan_make(S::value(), nop, RA,IA,JA,KA,LA,MA,NA, RB,IB,JB,KB,LB,MB,NB);
+  }
+};
+
+// output type
+template<class E, typename X>
+struct einsum_tiny_type
+{
+  typedef cppmat::tiny::array<X, E::plan().rank,
+    E::plan().out(0), E::plan().out(1), E::plan().out(2),
+    E::plan().out(3), E::plan().out(4), E::plan().out(5)> type;
+};
+
+} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+template<class S, typename X,
+  size_t RA, size_t IA, size_t JA, size_t KA, size_t LA, size_t MA, size_t NA>
+typename std::enable_if<std::is_class<S>::value, Private::einsum_tiny_type<
+  Private::einsum_tiny<S,1, RA,IA,JA,KA,LA,MA,NA, 0,1,1,1,1,1,1>, X>>::type::type
+einsum(const S &subscripts, const cppmat::tiny::array<X,RA,IA,JA,KA,LA,MA,NA> &A);
+
+template<class S, typename X,
+  size_t RA, size_t IA, size_t JA, size_t KA, size_t LA, size_t MA, size_t NA,
+  size_t RB, size_t IB, size_t JB, size_t KB, size_t LB, size_t MB, size_t NB>
+typename std::enable_if<std::is_class<S>::value, Private::einsum_tiny_type<
+  Private::einsum_tiny<S,2, RA,IA,JA,KA,LA,MA,NA, RB,IB,JB,KB,LB,MB,NB>, X>>::type::type
+einsum(const S &subscripts, const cppmat::tiny::array<X,RA,IA,JA,KA,LA,MA,NA> &A,
+  const cppmat::tiny::array<X,RB,IB,JB,KB,LB,MB,NB> &B);
+
+// -------------------------------------------------------------------------------------------------
+
+// an object whose type holds the subscripts, for the compile-time variant
+#define CPPMAT_SUBSCRIPTS(subscripts) \
+  []() { struct S { static constexpr const char* value() { return subscripts; } }; return S(); }()
+
+// =================================================================================================
+
+} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
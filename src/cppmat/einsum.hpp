@@ -0,0 +1,567 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_EINSUM_HPP
+#define CPPMAT_EINSUM_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace Private {
+
+// =================================================================================================
+// strided loop
+// =================================================================================================
+
+template<typename X>
+inline
+void einsum_loop(size_t n, const size_t *dim, const X *A, const size_t *sa, const X *B,
+  const size_t *sb, X *C, const size_t *sc)
+{
+  // rank zero: a single product
+  if ( n == 0 ) {
+    C[0] += A[0] * ( B ? B[0] : static_cast<X>(1) );
+    return;
+  }
+
+  // check for an empty index space
+  for ( size_t i = 0 ; i < n ; ++i )
+    if ( dim[i] == 0 )
+      return;
+
+  // the last axis is the inner loop, the other axes are traversed as an odometer, whereby the
+  // offsets are updated incrementally
+  size_t idx[12] = {0};
+  size_t ia = 0, ib = 0, ic = 0;
+
+  const size_t m  = dim[n-1];
+  const size_t ja = sa[n-1];
+  const size_t jb = B ? sb[n-1] : 0;
+  const size_t jc = sc[n-1];
+
+  while ( true )
+  {
+    if ( B ) for ( size_t j = 0 ; j < m ; ++j ) C[ic+j*jc] += A[ia+j*ja] * B[ib+j*jb];
+    else     for ( size_t j = 0 ; j < m ; ++j ) C[ic+j*jc] += A[ia+j*ja];
+
+    for ( size_t i = n - 1 ; ; )
+    {
+      if ( i == 0 ) return;
+
+      --i;
+
+      ++idx[i];
+      ia += sa[i];
+      ic += sc[i];
+      if ( B ) ib += sb[i];
+
+      if ( idx[i] < dim[i] ) break;
+
+      ia -= dim[i] * sa[i];
+      ic -= dim[i] * sc[i];
+      if ( B ) ib -= dim[i] * sb[i];
+      idx[i] = 0;
+    }
+  }
+}
+
+// =================================================================================================
+// runtime: parse
+// =================================================================================================
+
+inline
+void einsum_parse(const std::string &subscripts, size_t nop, std::vector<std::string> &in,
+  std::string &out)
+{
+  std::string s;
+
+  for ( auto &c : subscripts )
+    if ( c != ' ' )
+      s.push_back(c);
+
+  size_t arrow = s.find("->");
+
+  std::string lhs = s.substr(0, arrow);
+
+  // inputs
+  in.assign(1, "");
+
+  for ( auto &c : lhs ) {
+    if      ( c == ','          ) in.push_back("");
+    else if ( std::isalpha(c)   ) in.back().push_back(c);
+    else throw std::runtime_error("cppmat::einsum: invalid character in '"+subscripts+"'");
+  }
+
+  if ( in.size() != nop )
+    throw std::runtime_error("cppmat::einsum: number of operands does not match '"+subscripts+"'");
+
+  // output: explicit
+  if ( arrow != std::string::npos )
+  {
+    out = s.substr(arrow+2);
+
+    for ( size_t i = 0 ; i < out.size() ; ++i ) {
+      if ( not std::isalpha(out[i]) or lhs.find(out[i]) == std::string::npos or
+           out.find(out[i]) != i )
+        throw std::runtime_error("cppmat::einsum: invalid output in '"+subscripts+"'");
+    }
+
+    return;
+  }
+
+  // output: implicit, the labels that occur once (in alphabetical order)
+  out.clear();
+
+  for ( char c = 'A' ; c <= 'z' ; ++c )
+    if ( std::isalpha(c) and std::count(lhs.begin(), lhs.end(), c) == 1 )
+      out.push_back(c);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// labels of "labels" (unique, in order) that are in "keep"
+inline
+std::string einsum_select(const std::string &labels, const std::string &keep)
+{
+  std::string out;
+
+  for ( auto &c : labels )
+    if ( keep.find(c) != std::string::npos and out.find(c) == std::string::npos )
+      out.push_back(c);
+
+  return out;
+}
+
+// =================================================================================================
+// runtime: operations on operands
+// =================================================================================================
+
+// size of each label
+inline
+size_t einsum_size(const std::string &labels, const std::map<char,size_t> &dim)
+{
+  size_t n = 1;
+
+  for ( auto &c : labels )
+    n *= dim.at(c);
+
+  return n;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// reduce an operand to the (unique) labels "out": sum the other labels, take diagonals, and permute
+template<typename X>
+inline
+einsum_operand<X> einsum_reduce(const einsum_operand<X> &A, const std::string &out,
+  const std::map<char,size_t> &dim)
+{
+  einsum_operand<X> C;
+
+  C.labels = out;
+
+  for ( auto &c : out )
+    C.shape.push_back(dim.at(c));
+
+  // nothing to do: borrow the data
+  if ( A.labels == out ) {
+    C.borrowed = A.data();
+    return C;
+  }
+
+  // unique labels, with their strides in "A" and "C"
+  std::string         labels = einsum_select(out + A.labels, out + A.labels);
+  std::vector<size_t> d, sa, sc;
+
+  for ( auto &c : labels )
+  {
+    size_t a = 0, s = 1, o = 0, t = 1;
+
+    for ( size_t i = A.labels.size() ; i-- > 0 ; ) {
+      if ( A.labels[i] == c ) a += s;
+      s *= A.shape[i];
+    }
+
+    for ( size_t i = out.size() ; i-- > 0 ; ) {
+      if ( out[i] == c ) o += t;
+      t *= C.shape[i];
+    }
+
+    d .push_back(dim.at(c));
+    sa.push_back(a);
+    sc.push_back(o);
+  }
+
+  assert( labels.size() <= 12 );
+
+  C.store.assign(einsum_size(out, dim), static_cast<X>(0));
+
+  einsum_loop(labels.size(), d.data(), A.data(), sa.data(), static_cast<const X*>(nullptr),
+    sa.data(), C.store.data(), sc.data());
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// contract two operands, keeping the labels in "keep": lowered to a batched matrix product
+template<typename X>
+inline
+einsum_operand<X> einsum_pair(const einsum_operand<X> &A, const einsum_operand<X> &B,
+  const std::string &keep, const std::map<char,size_t> &dim)
+{
+  // sum the labels that are only in one operand
+  einsum_operand<X> a = einsum_reduce(A, einsum_select(A.labels, keep + B.labels), dim);
+  einsum_operand<X> b = einsum_reduce(B, einsum_select(B.labels, keep + A.labels), dim);
+
+  // classify: batch, free (only in "a" or "b"), and contracted labels
+  std::string batch, fa, fb, con;
+
+  for ( auto &c : a.labels ) {
+    if      ( b.labels.find(c) == std::string::npos ) fa   .push_back(c);
+    else if ( keep    .find(c) == std::string::npos ) con  .push_back(c);
+    else                                              batch.push_back(c);
+  }
+
+  for ( auto &c : b.labels )
+    if ( a.labels.find(c) == std::string::npos )
+      fb.push_back(c);
+
+  // permute to "[batch, fa, con]" and "[batch, con, fb]" (only copies if needed)
+  einsum_operand<X> ap = einsum_reduce(a, batch + fa + con, dim);
+  einsum_operand<X> bp = einsum_reduce(b, batch + con + fb, dim);
+
+  size_t nb = einsum_size(batch, dim);
+  size_t m  = einsum_size(fa   , dim);
+  size_t k  = einsum_size(con  , dim);
+  size_t n  = einsum_size(fb   , dim);
+
+  einsum_operand<X> C;
+
+  C.labels = batch + fa + fb;
+
+  for ( auto &c : C.labels )
+    C.shape.push_back(dim.at(c));
+
+  C.store.resize(nb*m*n);
+
+  const X *pa = ap.data();
+  const X *pb = bp.data();
+  X       *pc = C.store.data();
+
+  for ( size_t i = 0 ; i < nb ; ++i )
+    cppmat::Private::gemm(pa+i*m*k, pb+i*k*n, pc+i*m*n, m, k, n);
+
+  return C;
+}
+
+// =================================================================================================
+// runtime: evaluate
+// =================================================================================================
+
+template<typename X>
+inline
+cppmat::array<X> einsum(const std::string &subscripts, const std::vector<const cppmat::array<X>*> &A)
+{
+  std::vector<std::string> in;
+  std::string              out;
+
+  einsum_parse(subscripts, A.size(), in, out);
+
+  // operands, and the size of each label
+  std::map<char,size_t>          dim;
+  std::vector<einsum_operand<X>> ops(A.size());
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+  {
+    if ( in[i].size() != A[i]->rank() )
+      throw std::runtime_error("cppmat::einsum: rank does not match '"+subscripts+"'");
+
+    ops[i].labels   = in[i];
+    ops[i].shape    = A[i]->shape();
+    ops[i].borrowed = A[i]->data();
+
+    for ( size_t j = 0 ; j < in[i].size() ; ++j ) {
+      auto it = dim.find(in[i][j]);
+      if ( it == dim.end() ) dim[in[i][j]] = ops[i].shape[j];
+      else if ( it->second != ops[i].shape[j] )
+        throw std::runtime_error("cppmat::einsum: shape does not match '"+subscripts+"'");
+    }
+  }
+
+  // labels that are needed after contracting the operands "i" and "j" (the output and others)
+  auto needed = [&](size_t i, size_t j) -> std::string
+  {
+    std::string keep = out;
+
+    for ( size_t k = 0 ; k < ops.size() ; ++k )
+      if ( k != i and k != j )
+        keep += ops[k].labels;
+
+    return keep;
+  };
+
+  // contract pairs, greedily selecting the pair with the fewest operations
+  while ( ops.size() > 1 )
+  {
+    size_t bi = 0, bj = 1, best = 0;
+
+    for ( size_t i = 0 ; i < ops.size() ; ++i ) {
+      for ( size_t j = i+1 ; j < ops.size() ; ++j ) {
+        size_t cost = einsum_size(einsum_select(ops[i].labels+ops[j].labels,
+          ops[i].labels+ops[j].labels), dim);
+        if ( ( i == 0 and j == 1 ) or cost < best ) { bi = i; bj = j; best = cost; }
+      }
+    }
+
+    einsum_operand<X> C = einsum_pair(ops[bi], ops[bj], needed(bi, bj), dim);
+
+    ops.erase(ops.begin()+bj);
+    ops.erase(ops.begin()+bi);
+    ops.push_back(std::move(C));
+  }
+
+  // final reduction and permutation to the output
+  einsum_operand<X> C = einsum_reduce(ops[0], out, dim);
+
+  std::vector<size_t> shape = C.shape;
+
+  if ( shape.size() == 0 ) shape.push_back(1);
+
+  if ( shape.size() > 6 )
+    throw std::runtime_error("cppmat::einsum: rank of the output too large '"+subscripts+"'");
+
+  return cppmat::array<X>::Copy(shape, C.data(), C.data()+einsum_size(out, dim));
+}
+
+// =================================================================================================
+// compile time: plan
+// =================================================================================================
+
+constexpr einsum_plan einsum_plan_make(const char *s, size_t nop,
+  size_t RA, size_t IA, size_t JA, size_t KA, size_t LA, size_t MA, size_t NA,
+  size_t RB, size_t IB, size_t JB, size_t KB, size_t LB, size_t MB, size_t NB)
+{
+  einsum_plan p = {};
+
+  const size_t rank [2]    = {RA, RB};
+  const size_t shape[2][6] = {{IA,JA,KA,LA,MA,NA}, {IB,JB,KB,LB,MB,NB}};
+
+  char   labels[12] = {};
+  size_t len = 0;
+  size_t arrow = 0;
+
+  while ( s[len] != '\0' ) ++len;
+
+  // locate "->" (or the end)
+  while ( arrow < len and not ( s[arrow] == '-' and s[arrow+1] == '>' ) ) ++arrow;
+
+  // inputs: unique labels, their size, and their stride
+  size_t op = 0, ax = 0;
+
+  for ( size_t i = 0 ; i <= arrow ; ++i )
+  {
+    if ( i == arrow or s[i] == ',' )
+    {
+      if ( ax != rank[op] ) throw std::runtime_error("cppmat::einsum: rank does not match");
+      ++op;
+      ax = 0;
+      if ( i < arrow and op >= nop ) throw std::runtime_error("cppmat::einsum: too many operands");
+      continue;
+    }
+
+    if ( s[i] == ' ' ) continue;
+
+    if ( not ( ( s[i] >= 'a' and s[i] <= 'z' ) or ( s[i] >= 'A' and s[i] <= 'Z' ) ) )
+      throw std::runtime_error("cppmat::einsum: invalid character");
+
+    if ( ax >= rank[op] ) throw std::runtime_error("cppmat::einsum: rank does not match");
+
+    size_t stride = 1;
+
+    for ( size_t j = ax+1 ; j < rank[op] ; ++j )
+      stride *= shape[op][j];
+
+    size_t l = 0;
+
+    while ( l < p.n and labels[l] != s[i] ) ++l;
+
+    if ( l == p.n ) {
+      labels[l] = s[i];
+      p.dim [l] = shape[op][ax];
+      ++p.n;
+    }
+    else if ( p.dim[l] != shape[op][ax] ) {
+      throw std::runtime_error("cppmat::einsum: shape does not match");
+    }
+
+    if ( op == 0 ) p.sa[l] += stride;
+    else           p.sb[l] += stride;
+
+    ++ax;
+  }
+
+  if ( op != nop ) throw std::runtime_error("cppmat::einsum: number of operands does not match");
+
+  // output
+  char out[6] = {};
+
+  if ( arrow < len )
+  {
+    for ( size_t i = arrow+2 ; i < len ; ++i ) {
+      if ( s[i] == ' ' ) continue;
+      if ( p.rank >= 6 ) throw std::runtime_error("cppmat::einsum: rank of the output too large");
+      out[p.rank] = s[i];
+      ++p.rank;
+    }
+  }
+  else
+  {
+    for ( char c = 'A' ; c <= 'z' ; ++c ) {
+      size_t count = 0;
+      for ( size_t i = 0 ; i < len ; ++i )
+        if ( s[i] == c )
+          ++count;
+      if ( count != 1 or not ( ( c >= 'a' and c <= 'z' ) or ( c >= 'A' and c <= 'Z' ) ) ) continue;
+      if ( p.rank >= 6 ) throw std::runtime_error("cppmat::einsum: rank of the output too large");
+      out[p.rank] = c;
+      ++p.rank;
+    }
+  }
+
+  // output: shape and strides
+  for ( size_t i = 0 ; i < 6 ; ++i )
+    p.odim[i] = 1;
+
+  for ( size_t i = 0 ; i < p.rank ; ++i )
+  {
+    size_t l = 0;
+
+    while ( l < p.n and labels[l] != out[i] ) ++l;
+
+    if ( l == p.n ) throw std::runtime_error("cppmat::einsum: invalid output");
+
+    for ( size_t j = 0 ; j < i ; ++j )
+      if ( out[j] == out[i] )
+        throw std::runtime_error("cppmat::einsum: invalid output");
+
+    p.odim[i] = p.dim[l];
+  }
+
+  for ( size_t i = 0 ; i < p.rank ; ++i )
+  {
+    size_t l = 0;
+
+    while ( labels[l] != out[i] ) ++l;
+
+    size_t stride = 1;
+
+    for ( size_t j = i+1 ; j < p.rank ; ++j )
+      stride *= p.odim[j];
+
+    p.sc[l] = stride;
+  }
+
+  // an output without labels is stored as an array of shape [1]
+  if ( p.rank == 0 ) p.rank = 1;
+
+  return p;
+}
+
+// =================================================================================================
+
+} // namespace ...
+
+// =================================================================================================
+// cppmat::array
+// =================================================================================================
+
+template<typename X>
+inline
+cppmat::array<X> einsum(const std::string &subscripts, const cppmat::array<X> &A)
+{
+  return Private::einsum<X>(subscripts, {&A});
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> einsum(const std::string &subscripts, const cppmat::array<X> &A,
+  const cppmat::array<X> &B)
+{
+  return Private::einsum<X>(subscripts, {&A, &B});
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class... Arrays>
+inline
+cppmat::array<X> einsum(const std::string &subscripts, const cppmat::array<X> &A,
+  const cppmat::array<X> &B, const cppmat::array<X> &C, const Arrays&... operands)
+{
+  return Private::einsum<X>(subscripts, {&A, &B, &C, static_cast<const cppmat::array<X>*>(&operands)...});
+}
+
+// =================================================================================================
+// cppmat::tiny::array
+// =================================================================================================
+
+template<class S, typename X,
+  size_t RA, size_t IA, size_t JA, size_t KA, size_t LA, size_t MA, size_t NA>
+inline
+typename std::enable_if<std::is_class<S>::value, Private::einsum_tiny_type<
+  Private::einsum_tiny<S,1, RA,IA,JA,KA,LA,MA,NA, 0,1,1,1,1,1,1>, X>>::type::type
+einsum(const S &, const cppmat::tiny::array<X,RA,IA,JA,KA,LA,MA,NA> &A)
+{
+  typedef Private::einsum_tiny<S,1, RA,IA,JA,KA,LA,MA,NA, 0,1,1,1,1,1,1> E;
+  typedef typename Private::einsum_tiny_type<E,X>::type         T;
+
+  constexpr Private::einsum_plan p = E::plan();
+
+  T C = T::Zero();
+
+  Private::einsum_loop(p.n, p.dim, A.data(), p.sa, static_cast<const X*>(nullptr), p.sb, C.data(),
+    p.sc);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class S, typename X,
+  size_t RA, size_t IA, size_t JA, size_t KA, size_t LA, size_t MA, size_t NA,
+  size_t RB, size_t IB, size_t JB, size_t KB, size_t LB, size_t MB, size_t NB>
+inline
+typename std::enable_if<std::is_class<S>::value, Private::einsum_tiny_type<
+  Private::einsum_tiny<S,2, RA,IA,JA,KA,LA,MA,NA, RB,IB,JB,KB,LB,MB,NB>, X>>::type::type
+einsum(const S &, const cppmat::tiny::array<X,RA,IA,JA,KA,LA,MA,NA> &A,
+  const cppmat::tiny::array<X,RB,IB,JB,KB,LB,MB,NB> &B)
+{
+  typedef Private::einsum_tiny<S,2, RA,IA,JA,KA,LA,MA,NA, RB,IB,JB,KB,LB,MB,NB> E;
+  typedef typename Private::einsum_tiny_type<E,X>::type         T;
+
+  constexpr Private::einsum_plan p = E::plan();
+
+  T C = T::Zero();
+
+  Private::einsum_loop(p.n, p.dim, A.data(), p.sa, B.data(), p.sb, C.data(), p.sc);
+
+  return C;
+}
+
+// =================================================================================================
+
+} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -26,15 +26,9 @@ cppmat::tiny::cartesian::tensor4<X,ND> ddot(
   const cppmat::tiny::cartesian::tensor4<X,ND> &A, const cppmat::tiny::cartesian::tensor4<X,ND> &B
 )
 {
-  cppmat::tiny::cartesian::tensor4<X,ND> C = cppmat::tiny::cartesian::tensor4<X,ND>::Zero();
+  cppmat::tiny::cartesian::tensor4<X,ND> C;
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        for ( size_t l = 0 ; l < ND ; ++l )
-          for ( size_t m = 0 ; m < ND ; ++m )
-            for ( size_t n = 0 ; n < ND ; ++n )
-              C(i,j,m,n) += A(i,j,k,l) * B(l,k,m,n);
+  cppmat::Private::ddot44<ND>(A.data(), B.data(), C.data(), ND);
 
   return C;
 }
@@ -586,13 +580,9 @@ cppmat::tiny::cartesian::tensor4<X,ND> dyadic(
   const cppmat::tiny::cartesian::tensor2<X,ND> &A, const cppmat::tiny::cartesian::tensor2<X,ND> &B
 )
 {
-  cppmat::tiny::cartesian::tensor4<X,ND> C = cppmat::tiny::cartesian::tensor4<X,ND>::Zero();
+  cppmat::tiny::cartesian::tensor4<X,ND> C;
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        for ( size_t l = 0 ; l < ND ; ++l )
-          C(i,j,k,l) += A(i,j) * B(k,l);
+  cppmat::Private::dyadic22<ND>(A.data(), B.data(), C.data(), ND);
 
   return C;
 }
@@ -787,11 +777,7 @@ cppmat::tiny::cartesian::tensor4<X,ND> T(const cppmat::tiny::cartesian::tensor4<
 {
   cppmat::tiny::cartesian::tensor4<X,ND> C;
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        for ( size_t l = 0 ; l < ND ; ++l )
-          C(l,k,j,i) = A(i,j,k,l);
+  cppmat::Private::T4<ND>(A.data(), C.data(), ND);
 
   return C;
 }
@@ -804,11 +790,7 @@ cppmat::tiny::cartesian::tensor4<X,ND> RT(const cppmat::tiny::cartesian::tensor4
 {
   cppmat::tiny::cartesian::tensor4<X,ND> C;
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        for ( size_t l = 0 ; l < ND ; ++l )
-          C(i,j,l,k) = A(i,j,k,l);
+  cppmat::Private::RT4<ND>(A.data(), C.data(), ND);
 
   return C;
 }
@@ -821,11 +803,7 @@ cppmat::tiny::cartesian::tensor4<X,ND> LT(const cppmat::tiny::cartesian::tensor4
 {
   cppmat::tiny::cartesian::tensor4<X,ND> C;
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        for ( size_t l = 0 ; l < ND ; ++l )
-          C(j,i,k,l) = A(i,j,k,l);
+  cppmat::Private::LT4<ND>(A.data(), C.data(), ND);
 
   return C;
 }
@@ -189,7 +189,10 @@ template<typename X, size_t ND>
 inline
 void tensor4<X,ND>::setIs()
 {
-  (*this) = ( tensor4<X,ND>::I() + tensor4<X,ND>::Irt() ) / static_cast<X>(2);
+  const cppmat::cartesian::tensor4<X> &P =
+    cppmat::cartesian::projection::dense<X>(cppmat::cartesian::projection::Is(), ND);
+
+  std::copy(P.begin(), P.end(), this->begin());
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -198,7 +201,10 @@ template<typename X, size_t ND>
 inline
 void tensor4<X,ND>::setId()
 {
-  (*this) = tensor4<X,ND>::I() - tensor4<X,ND>::II()/static_cast<X>(ND);
+  const cppmat::cartesian::tensor4<X> &P =
+    cppmat::cartesian::projection::dense<X>(cppmat::cartesian::projection::Id(), ND);
+
+  std::copy(P.begin(), P.end(), this->begin());
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -207,7 +213,10 @@ template<typename X, size_t ND>
 inline
 void tensor4<X,ND>::setIsd()
 {
-  (*this) = tensor4<X,ND>::Is() - tensor4<X,ND>::II()/static_cast<X>(ND);
+  const cppmat::cartesian::tensor4<X> &P =
+    cppmat::cartesian::projection::dense<X>(cppmat::cartesian::projection::Isd(), ND);
+
+  std::copy(P.begin(), P.end(), this->begin());
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -296,11 +296,11 @@ size_t matrix<X,M,N>::shape(size_t i) const
 
 template<typename X, size_t M, size_t N>
 inline
-std::vector<size_t> matrix<X,M,N>::shape() const
+cppmat::shape_t matrix<X,M,N>::shape() const
 {
-  std::vector<size_t> shape(mRank);
+  cppmat::shape_t shape;
 
-  std::fill(shape.begin(), shape.end(), N);
+  shape.resize(mRank, N);
 
   return shape;
 }
@@ -354,7 +354,7 @@ template<typename U>
 inline
 std::vector<U> matrix<X,M,N>::shape() const
 {
-  std::vector<size_t> A = shape();
+  cppmat::shape_t A = shape();
 
   std::vector<U> B(A.size());
 
@@ -702,17 +702,8 @@ template<typename X, size_t M, size_t N>
 inline
 void matrix<X,M,N>::setRandom(X lower, X upper)
 {
-  // type of random number distribution
-  std::uniform_real_distribution<X> dist(lower, upper);
-
-  // Mersenne Twister: Good quality random number generator
-  std::mt19937 rng;
-
-  // Initialize with non-deterministic seeds
-  rng.seed(std::random_device{}());
-
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] = dist(rng);
+  // library-wide counter-based generator (reproducible, see "cppmat::random::seed")
+  cppmat::random::uniform(data(), mSize, lower, upper, cppmat::random::generator());
 }
 
 // -------------------------------------------------------------------------------------------------
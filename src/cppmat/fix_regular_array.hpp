@@ -314,24 +314,18 @@ size_t array<X,RANK,I,J,K,L,M,N>::shape(size_t i) const
 
 template<typename X, size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
 inline
-std::vector<size_t> array<X,RANK,I,J,K,L,M,N>::shape() const
+cppmat::shape_t array<X,RANK,I,J,K,L,M,N>::shape() const
 {
-  std::vector<size_t> shape(mRank);
-
-  std::copy(std::begin(mShape), std::begin(mShape)+mRank, shape.begin());
-
-  return shape;
+  return cppmat::shape_t(std::begin(mShape), std::begin(mShape)+mRank);
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X, size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
 inline
-std::vector<size_t> array<X,RANK,I,J,K,L,M,N>::strides(bool bytes) const
+cppmat::shape_t array<X,RANK,I,J,K,L,M,N>::strides(bool bytes) const
 {
-  std::vector<size_t> strides(mRank);
-
-  std::copy(std::begin(mStrides), std::begin(mStrides)+mRank, strides.begin());
+  cppmat::shape_t strides(std::begin(mStrides), std::begin(mStrides)+mRank);
 
   if ( bytes )
     for ( size_t i = 0 ; i < mRank ; ++i )
@@ -389,7 +383,7 @@ template<typename U>
 inline
 std::vector<U> array<X,RANK,I,J,K,L,M,N>::shape() const
 {
-  std::vector<size_t> A = shape();
+  cppmat::shape_t A = shape();
 
   std::vector<U> B(A.size());
 
@@ -405,7 +399,7 @@ template<typename U>
 inline
 std::vector<U> array<X,RANK,I,J,K,L,M,N>::strides(bool bytes) const
 {
-  std::vector<size_t> A = strides(bytes);
+  cppmat::shape_t A = strides(bytes);
 
   std::vector<U> B(A.size());
 
@@ -1975,17 +1969,8 @@ template<typename X, size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t
 inline
 void array<X,RANK,I,J,K,L,M,N>::setRandom(X lower, X upper)
 {
-  // type of random number distribution
-  std::uniform_real_distribution<X> dist(lower, upper);
-
-  // Mersenne Twister: Good quality random number generator
-  std::mt19937 rng;
-
-  // Initialize with non-deterministic seeds
-  rng.seed(std::random_device{}());
-
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] = dist(rng);
+  // library-wide counter-based generator (reproducible, see "cppmat::random::seed")
+  cppmat::random::uniform(data(), mSize, lower, upper, cppmat::random::generator());
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -306,11 +306,11 @@ size_t matrix<X,M,N>::shape(size_t i) const
 
 template<typename X, size_t M, size_t N>
 inline
-std::vector<size_t> matrix<X,M,N>::shape() const
+cppmat::shape_t matrix<X,M,N>::shape() const
 {
-  std::vector<size_t> shape(mRank);
+  cppmat::shape_t shape;
 
-  std::fill(shape.begin(), shape.end(), N);
+  shape.resize(mRank, N);
 
   return shape;
 }
@@ -364,7 +364,7 @@ template<typename U>
 inline
 std::vector<U> matrix<X,M,N>::shape() const
 {
-  std::vector<size_t> A = shape();
+  cppmat::shape_t A = shape();
 
   std::vector<U> B(A.size());
 
@@ -413,8 +413,10 @@ X& matrix<X,M,N>::operator()(int a, int b)
   size_t A = static_cast<size_t>( (n+(a%n)) % n );
   size_t B = static_cast<size_t>( (n+(b%n)) % n );
 
-  if (A <= B) return mData[ A*N - (A-1)*A/2 + B - A ];
-  else        return mData[ B*N - (B-1)*B/2 + A - B ];
+  size_t i = std::min<size_t>(A,B);
+  size_t j = std::max<size_t>(A,B);
+
+  return mData[ i*N - (i-1)*i/2 + j - i ];
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -431,8 +433,10 @@ const X& matrix<X,M,N>::operator()(int a, int b) const
   size_t A = static_cast<size_t>( (n+(a%n)) % n );
   size_t B = static_cast<size_t>( (n+(b%n)) % n );
 
-  if (A <= B) return mData[ A*N - (A-1)*A/2 + B - A ];
-  else        return mData[ B*N - (B-1)*B/2 + A - B ];
+  size_t i = std::min<size_t>(A,B);
+  size_t j = std::max<size_t>(A,B);
+
+  return mData[ i*N - (i-1)*i/2 + j - i ];
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -445,8 +449,10 @@ X& matrix<X,M,N>::operator()(T a, T b)
   assert( a < N );
   assert( b < N );
 
-  if (a <= b) return mData[ a*N - (a-1)*a/2 + b - a ];
-  else        return mData[ b*N - (b-1)*b/2 + a - b ];
+  size_t i = std::min<size_t>(a,b);
+  size_t j = std::max<size_t>(a,b);
+
+  return mData[ i*N - (i-1)*i/2 + j - i ];
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -459,8 +465,10 @@ const X& matrix<X,M,N>::operator()(T a, T b) const
   assert( a < N );
   assert( b < N );
 
-  if (a <= b) return mData[ a*N - (a-1)*a/2 + b - a ];
-  else        return mData[ b*N - (b-1)*b/2 + a - b ];
+  size_t i = std::min<size_t>(a,b);
+  size_t j = std::max<size_t>(a,b);
+
+  return mData[ i*N - (i-1)*i/2 + j - i ];
 }
 
 // =================================================================================================
@@ -479,8 +487,10 @@ size_t matrix<X,M,N>::compress(int a, int b) const
   size_t A = static_cast<size_t>( (n+(a%n)) % n );
   size_t B = static_cast<size_t>( (n+(b%n)) % n );
 
-  if (A <= B) return A*N - (A-1)*A/2 + B - A;
-  else        return B*N - (B-1)*B/2 + A - B;
+  size_t i = std::min<size_t>(A,B);
+  size_t j = std::max<size_t>(A,B);
+
+  return i*N - (i-1)*i/2 + j - i;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -493,8 +503,10 @@ size_t matrix<X,M,N>::compress(T a, T b) const
   assert( a < N );
   assert( b < N );
 
-  if (a <= b) return a*N - (a-1)*a/2 + b - a;
-  else        return b*N - (b-1)*b/2 + a - b;
+  size_t i = std::min<size_t>(a,b);
+  size_t j = std::max<size_t>(a,b);
+
+  return i*N - (i-1)*i/2 + j - i;
 }
 
 // =================================================================================================
@@ -665,8 +677,10 @@ auto matrix<X,M,N>::item(int a, int b)
   size_t A = static_cast<size_t>( (n+(a%n)) % n );
   size_t B = static_cast<size_t>( (n+(b%n)) % n );
 
-  if (A <= B) return begin() + ( A*N - (A-1)*A/2 + B - A );
-  else        return begin() + ( B*N - (B-1)*B/2 + A - B );
+  size_t i = std::min<size_t>(A,B);
+  size_t j = std::max<size_t>(A,B);
+
+  return begin() + ( i*N - (i-1)*i/2 + j - i );
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -683,8 +697,10 @@ auto matrix<X,M,N>::item(int a, int b) const
   size_t A = static_cast<size_t>( (n+(a%n)) % n );
   size_t B = static_cast<size_t>( (n+(b%n)) % n );
 
-  if (A <= B) return begin() + ( A*N - (A-1)*A/2 + B - A );
-  else        return begin() + ( B*N - (B-1)*B/2 + A - B );
+  size_t i = std::min<size_t>(A,B);
+  size_t j = std::max<size_t>(A,B);
+
+  return begin() + ( i*N - (i-1)*i/2 + j - i );
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -697,8 +713,10 @@ auto matrix<X,M,N>::item(T a, T b)
   assert( a < N );
   assert( b < N );
 
-  if (a <= b) return begin() + ( a*N - (a-1)*a/2 + b - a );
-  else        return begin() + ( b*N - (b-1)*b/2 + a - b );
+  size_t i = std::min<size_t>(a,b);
+  size_t j = std::max<size_t>(a,b);
+
+  return begin() + ( i*N - (i-1)*i/2 + j - i );
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -711,8 +729,10 @@ auto matrix<X,M,N>::item(T a, T b) const
   assert( a < N );
   assert( b < N );
 
-  if (a <= b) return begin() + ( a*N - (a-1)*a/2 + b - a );
-  else        return begin() + ( b*N - (b-1)*b/2 + a - b );
+  size_t i = std::min<size_t>(a,b);
+  size_t j = std::max<size_t>(a,b);
+
+  return begin() + ( i*N - (i-1)*i/2 + j - i );
 }
 
 // =================================================================================================
@@ -723,17 +743,8 @@ template<typename X, size_t M, size_t N>
 inline
 void matrix<X,M,N>::setRandom(X lower, X upper)
 {
-  // type of random number distribution
-  std::uniform_real_distribution<X> dist(lower, upper);
-
-  // Mersenne Twister: Good quality random number generator
-  std::mt19937 rng;
-
-  // Initialize with non-deterministic seeds
-  rng.seed(std::random_device{}());
-
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] = dist(rng);
+  // library-wide counter-based generator (reproducible, see "cppmat::random::seed")
+  cppmat::random::uniform(data(), mSize, lower, upper, cppmat::random::generator());
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -146,11 +146,11 @@ size_t matrix<X,M,N>::shape(size_t i) const
 
 template<typename X, size_t M, size_t N>
 inline
-std::vector<size_t> matrix<X,M,N>::shape() const
+cppmat::shape_t matrix<X,M,N>::shape() const
 {
-  std::vector<size_t> shape(mRank);
+  cppmat::shape_t shape;
 
-  std::fill(shape.begin(), shape.end(), N);
+  shape.resize(mRank, N);
 
   return shape;
 }
@@ -204,7 +204,7 @@ template<typename U>
 inline
 std::vector<U> matrix<X,M,N>::shape() const
 {
-  std::vector<size_t> A = shape();
+  cppmat::shape_t A = shape();
 
   std::vector<U> B(A.size());
 
@@ -59,8 +59,8 @@ public:
   size_t rank() const;
   size_t shape(int    i) const;
   size_t shape(size_t i) const;
-  std::vector<size_t> shape() const;
-  std::vector<size_t> strides(bool bytes=false) const;
+  cppmat::shape_t shape() const;
+  cppmat::shape_t strides(bool bytes=false) const;
 
   // get using a different return type
   template<typename U> U size() const;
@@ -161,24 +161,18 @@ size_t array<X,RANK,I,J,K,L,M,N>::shape(size_t i) const
 
 template<typename X, size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
 inline
-std::vector<size_t> array<X,RANK,I,J,K,L,M,N>::shape() const
+cppmat::shape_t array<X,RANK,I,J,K,L,M,N>::shape() const
 {
-  std::vector<size_t> shape(mRank);
-
-  std::copy(std::begin(mShape), std::begin(mShape)+mRank, shape.begin());
-
-  return shape;
+  return cppmat::shape_t(std::begin(mShape), std::begin(mShape)+mRank);
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X, size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
 inline
-std::vector<size_t> array<X,RANK,I,J,K,L,M,N>::strides(bool bytes) const
+cppmat::shape_t array<X,RANK,I,J,K,L,M,N>::strides(bool bytes) const
 {
-  std::vector<size_t> strides(mRank);
-
-  std::copy(std::begin(mStrides), std::begin(mStrides)+mRank, strides.begin());
+  cppmat::shape_t strides(std::begin(mStrides), std::begin(mStrides)+mRank);
 
   if ( bytes )
     for ( size_t i = 0 ; i < mRank ; ++i )
@@ -236,7 +230,7 @@ template<typename U>
 inline
 std::vector<U> array<X,RANK,I,J,K,L,M,N>::shape() const
 {
-  std::vector<size_t> A = shape();
+  cppmat::shape_t A = shape();
 
   std::vector<U> B(A.size());
 
@@ -252,7 +246,7 @@ template<typename U>
 inline
 std::vector<U> array<X,RANK,I,J,K,L,M,N>::strides(bool bytes) const
 {
-  std::vector<size_t> A = strides(bytes);
+  cppmat::shape_t A = strides(bytes);
 
   std::vector<U> B(A.size());
 
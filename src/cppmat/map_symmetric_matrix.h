@@ -59,7 +59,7 @@ public:
   size_t rank() const;
   size_t shape(int    i) const;
   size_t shape(size_t i) const;
-  std::vector<size_t> shape() const;
+  cppmat::shape_t shape() const;
 
   // get using a different return type
   template<typename U> U size() const;
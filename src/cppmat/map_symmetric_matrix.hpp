@@ -143,11 +143,11 @@ size_t matrix<X,M,N>::shape(size_t i) const
 
 template<typename X, size_t M, size_t N>
 inline
-std::vector<size_t> matrix<X,M,N>::shape() const
+cppmat::shape_t matrix<X,M,N>::shape() const
 {
-  std::vector<size_t> shape(mRank);
+  cppmat::shape_t shape;
 
-  std::fill(shape.begin(), shape.end(), N);
+  shape.resize(mRank, N);
 
   return shape;
 }
@@ -201,7 +201,7 @@ template<typename U>
 inline
 std::vector<U> matrix<X,M,N>::shape() const
 {
-  std::vector<size_t> A = shape();
+  cppmat::shape_t A = shape();
 
   std::vector<U> B(A.size());
 
@@ -239,8 +239,10 @@ const X& matrix<X,M,N>::operator()(int a, int b) const
   size_t A = static_cast<size_t>( (n+(a%n)) % n );
   size_t B = static_cast<size_t>( (n+(b%n)) % n );
 
-  if (A <= B) return mData[ A*N - (A-1)*A/2 + B - A ];
-  else        return mData[ B*N - (B-1)*B/2 + A - B ];
+  size_t i = std::min<size_t>(A,B);
+  size_t j = std::max<size_t>(A,B);
+
+  return mData[ i*N - (i-1)*i/2 + j - i ];
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -253,8 +255,10 @@ const X& matrix<X,M,N>::operator()(T a, T b) const
   assert( a < N );
   assert( b < N );
 
-  if (a <= b) return mData[ a*N - (a-1)*a/2 + b - a ];
-  else        return mData[ b*N - (b-1)*b/2 + a - b ];
+  size_t i = std::min<size_t>(a,b);
+  size_t j = std::max<size_t>(a,b);
+
+  return mData[ i*N - (i-1)*i/2 + j - i ];
 }
 
 // =================================================================================================
@@ -273,8 +277,10 @@ size_t matrix<X,M,N>::compress(int a, int b) const
   size_t A = static_cast<size_t>( (n+(a%n)) % n );
   size_t B = static_cast<size_t>( (n+(b%n)) % n );
 
-  if (A <= B) return A*N - (A-1)*A/2 + B - A;
-  else        return B*N - (B-1)*B/2 + A - B;
+  size_t i = std::min<size_t>(A,B);
+  size_t j = std::max<size_t>(A,B);
+
+  return i*N - (i-1)*i/2 + j - i;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -287,8 +293,10 @@ size_t matrix<X,M,N>::compress(T a, T b) const
   assert( a < N );
   assert( b < N );
 
-  if (a <= b) return a*N - (a-1)*a/2 + b - a;
-  else        return b*N - (b-1)*b/2 + a - b;
+  size_t i = std::min<size_t>(a,b);
+  size_t j = std::max<size_t>(a,b);
+
+  return i*N - (i-1)*i/2 + j - i;
 }
 
 // =================================================================================================
@@ -421,8 +429,10 @@ auto matrix<X,M,N>::item(int a, int b) const
   size_t A = static_cast<size_t>( (n+(a%n)) % n );
   size_t B = static_cast<size_t>( (n+(b%n)) % n );
 
-  if (A <= B) return begin() + ( A*N - (A-1)*A/2 + B - A );
-  else        return begin() + ( B*N - (B-1)*B/2 + A - B );
+  size_t i = std::min<size_t>(A,B);
+  size_t j = std::max<size_t>(A,B);
+
+  return begin() + ( i*N - (i-1)*i/2 + j - i );
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -435,8 +445,10 @@ auto matrix<X,M,N>::item(T a, T b) const
   assert( a < N );
   assert( b < N );
 
-  if (a <= b) return begin() + ( a*N - (a-1)*a/2 + b - a );
-  else        return begin() + ( b*N - (b-1)*b/2 + a - b );
+  size_t i = std::min<size_t>(a,b);
+  size_t j = std::max<size_t>(a,b);
+
+  return begin() + ( i*N - (i-1)*i/2 + j - i );
 }
 
 // =================================================================================================
@@ -0,0 +1,153 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_MASK_H
+#define CPPMAT_MASK_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+
+// =================================================================================================
+// cppmat::mask : array of booleans, stored as bits (64 entries per word). Entry "i" is bit "i % 64"
+// of word "i / 64". The bits beyond "size()" (in the last word) are always zero, such that counting
+// is a population count of the words.
+// =================================================================================================
+
+class mask
+{
+private:
+
+  std::vector<uint64_t> mData;    // bits
+  cppmat::shape_t       mShape;   // number of entries along each axis
+  size_t                mSize=0;  // total number of entries
+
+  // zero the bits beyond "mSize"
+  void clearTail();
+
+public:
+
+  // constructor: empty
+  mask() = default;
+
+  // constructor: allocate, initialize to "value"
+  mask(const cppmat::shape_t &shape, bool value=false);
+
+  // constructor: the non-zero entries of an array
+  template<typename X> explicit mask(const cppmat::array<X> &A);
+
+  // named constructors: entry-wise comparison with a scalar, or with an array of the same shape
+  template<typename X> static mask Equal       (const cppmat::array<X> &A, const X &D);
+  template<typename X> static mask NotEqual    (const cppmat::array<X> &A, const X &D);
+  template<typename X> static mask Greater     (const cppmat::array<X> &A, const X &D);
+  template<typename X> static mask GreaterEqual(const cppmat::array<X> &A, const X &D);
+  template<typename X> static mask Less        (const cppmat::array<X> &A, const X &D);
+  template<typename X> static mask LessEqual   (const cppmat::array<X> &A, const X &D);
+  template<typename X> static mask Equal       (const cppmat::array<X> &A, const cppmat::array<X> &D);
+  template<typename X> static mask NotEqual    (const cppmat::array<X> &A, const cppmat::array<X> &D);
+  template<typename X> static mask Greater     (const cppmat::array<X> &A, const cppmat::array<X> &D);
+  template<typename X> static mask GreaterEqual(const cppmat::array<X> &A, const cppmat::array<X> &D);
+  template<typename X> static mask Less        (const cppmat::array<X> &A, const cppmat::array<X> &D);
+  template<typename X> static mask LessEqual   (const cppmat::array<X> &A, const cppmat::array<X> &D);
+
+  // get dimensions
+  size_t size() const;
+  size_t rank() const;
+  size_t shape(size_t i) const;
+  const cppmat::shape_t& shape() const;
+
+  // number of words, and access to the words
+  size_t          words() const;
+  const uint64_t* data() const;
+  uint64_t*       data();
+
+  // get/set entry
+  bool operator[](size_t i) const;
+  void set(size_t i, bool value=true);
+
+  // initialize
+  void setZero();
+  void setOnes();
+
+  // number of "true" entries; check if any/all entries are "true"
+  size_t count() const;
+  bool   any() const;
+  bool   all() const;
+
+  // plain storage indices of the "true" entries
+  std::vector<size_t> where() const;
+
+  // call "f(i)" for the plain storage index "i" of each "true" entry (in order)
+  template<class F> void for_each(F f) const;
+
+  // logical operations (the shapes must be the same)
+  mask  operator~ () const;
+  mask& operator&=(const mask &B);
+  mask& operator|=(const mask &B);
+  mask& operator^=(const mask &B);
+
+  // convert to an array (with entries 0 and 1)
+  template<typename X> cppmat::array<X> as() const;
+
+};
+
+// logical operations
+mask operator&(const mask &A, const mask &B);
+mask operator|(const mask &A, const mask &B);
+mask operator^(const mask &A, const mask &B);
+
+// equality
+bool operator==(const mask &A, const mask &B);
+
+// =================================================================================================
+// masked operations (the shapes of the array and the mask must be the same)
+// =================================================================================================
+
+// "C[i] = m[i] ? A[i] : B[i]"
+template<typename X>
+cppmat::array<X> select(const mask &m, const cppmat::array<X> &A, const cppmat::array<X> &B);
+
+template<typename X>
+cppmat::array<X> select(const mask &m, const cppmat::array<X> &A, const X &B);
+
+// "A[i] = value" (or "values[i]") if "m[i]"
+template<typename X> void putmask(cppmat::array<X> &A, const mask &m, const X &value);
+template<typename X> void putmask(cppmat::array<X> &A, const mask &m, const cppmat::array<X> &values);
+
+// reductions over the entries "A[i]" for which "m[i]" (min/max throw if there are no such entries)
+template<typename X> X      masked_sum (const cppmat::array<X> &A, const mask &m);
+template<typename X> double masked_mean(const cppmat::array<X> &A, const mask &m);
+template<typename X> X      masked_min (const cppmat::array<X> &A, const mask &m);
+template<typename X> X      masked_max (const cppmat::array<X> &A, const mask &m);
+
+// =================================================================================================
+
+namespace Private {
+
+// number of set bits
+size_t popcount(uint64_t w);
+
+// index of the lowest set bit ("w != 0")
+size_t ctz(uint64_t w);
+
+// "words[k]" holds the comparison "c(A[i], B)" (or "c(A[i], B[i])") of entries "i = 64*k+j"
+template<typename X, class C> void mask_compare(const X *A, const X &B, size_t n, uint64_t *words, C c);
+template<typename X, class C> void mask_compare(const X *A, const X *B, size_t n, uint64_t *words, C c);
+
+} // namespace ...
+
+// =================================================================================================
+
+} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
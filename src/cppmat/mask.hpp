@@ -0,0 +1,764 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_MASK_HPP
+#define CPPMAT_MASK_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+
+// =================================================================================================
+// support functions
+// =================================================================================================
+
+namespace Private {
+
+inline
+size_t popcount(uint64_t w)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<size_t>(__builtin_popcountll(w));
+#else
+  w = w - ( ( w >> 1 ) & 0x5555555555555555ULL );
+  w = ( w & 0x3333333333333333ULL ) + ( ( w >> 2 ) & 0x3333333333333333ULL );
+  w = ( w + ( w >> 4 ) ) & 0x0F0F0F0F0F0F0F0FULL;
+  return static_cast<size_t>( ( w * 0x0101010101010101ULL ) >> 56 );
+#endif
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+size_t ctz(uint64_t w)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<size_t>(__builtin_ctzll(w));
+#else
+  return popcount( ( w & (~w+1) ) - 1 );
+#endif
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// the comparison of 64 entries is packed in one word without branching, such that the compiler can
+// vectorize the inner loop; the words are distributed over threads
+template<typename X, class C>
+inline
+void mask_compare(const X *A, const X &B, size_t n, uint64_t *words, C c)
+{
+  size_t nw = ( n + 63 ) / 64;
+
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for ( size_t k = 0 ; k < nw ; ++k )
+  {
+    const X *a = A + 64*k;
+    size_t   m = std::min(static_cast<size_t>(64), n-64*k);
+    uint64_t w = 0;
+
+    for ( size_t j = 0 ; j < m ; ++j )
+      w |= static_cast<uint64_t>(c(a[j], B)) << j;
+
+    words[k] = w;
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class C>
+inline
+void mask_compare(const X *A, const X *B, size_t n, uint64_t *words, C c)
+{
+  size_t nw = ( n + 63 ) / 64;
+
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for ( size_t k = 0 ; k < nw ; ++k )
+  {
+    const X *a = A + 64*k;
+    const X *b = B + 64*k;
+    size_t   m = std::min(static_cast<size_t>(64), n-64*k);
+    uint64_t w = 0;
+
+    for ( size_t j = 0 ; j < m ; ++j )
+      w |= static_cast<uint64_t>(c(a[j], b[j])) << j;
+
+    words[k] = w;
+  }
+}
+
+} // namespace ...
+
+// =================================================================================================
+// constructors
+// =================================================================================================
+
+inline
+mask::mask(const cppmat::shape_t &shape, bool value)
+{
+  mShape = shape;
+  mSize  = std::accumulate(shape.begin(), shape.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+
+  mData.resize(( mSize + 63 ) / 64);
+
+  if ( value ) setOnes();
+  else         setZero();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+mask::mask(const cppmat::array<X> &A) : mask(A.shape())
+{
+  Private::mask_compare(A.data(), X(0), mSize, mData.data(),
+    [](const X &a, const X &b) { return a != b; });
+}
+
+// =================================================================================================
+// named constructors
+// =================================================================================================
+
+template<typename X>
+inline
+mask mask::Equal(const cppmat::array<X> &A, const X &D)
+{
+  mask out(A.shape());
+
+  Private::mask_compare(A.data(), D, out.mSize, out.mData.data(),
+    [](const X &a, const X &b) { return a == b; });
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+mask mask::NotEqual(const cppmat::array<X> &A, const X &D)
+{
+  mask out(A.shape());
+
+  Private::mask_compare(A.data(), D, out.mSize, out.mData.data(),
+    [](const X &a, const X &b) { return a != b; });
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+mask mask::Greater(const cppmat::array<X> &A, const X &D)
+{
+  mask out(A.shape());
+
+  Private::mask_compare(A.data(), D, out.mSize, out.mData.data(),
+    [](const X &a, const X &b) { return a > b; });
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+mask mask::GreaterEqual(const cppmat::array<X> &A, const X &D)
+{
+  mask out(A.shape());
+
+  Private::mask_compare(A.data(), D, out.mSize, out.mData.data(),
+    [](const X &a, const X &b) { return a >= b; });
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+mask mask::Less(const cppmat::array<X> &A, const X &D)
+{
+  mask out(A.shape());
+
+  Private::mask_compare(A.data(), D, out.mSize, out.mData.data(),
+    [](const X &a, const X &b) { return a < b; });
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+mask mask::LessEqual(const cppmat::array<X> &A, const X &D)
+{
+  mask out(A.shape());
+
+  Private::mask_compare(A.data(), D, out.mSize, out.mData.data(),
+    [](const X &a, const X &b) { return a <= b; });
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+mask mask::Equal(const cppmat::array<X> &A, const cppmat::array<X> &D)
+{
+  assert( A.shape() == D.shape() );
+
+  mask out(A.shape());
+
+  Private::mask_compare(A.data(), D.data(), out.mSize, out.mData.data(),
+    [](const X &a, const X &b) { return a == b; });
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+mask mask::NotEqual(const cppmat::array<X> &A, const cppmat::array<X> &D)
+{
+  assert( A.shape() == D.shape() );
+
+  mask out(A.shape());
+
+  Private::mask_compare(A.data(), D.data(), out.mSize, out.mData.data(),
+    [](const X &a, const X &b) { return a != b; });
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+mask mask::Greater(const cppmat::array<X> &A, const cppmat::array<X> &D)
+{
+  assert( A.shape() == D.shape() );
+
+  mask out(A.shape());
+
+  Private::mask_compare(A.data(), D.data(), out.mSize, out.mData.data(),
+    [](const X &a, const X &b) { return a > b; });
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+mask mask::GreaterEqual(const cppmat::array<X> &A, const cppmat::array<X> &D)
+{
+  assert( A.shape() == D.shape() );
+
+  mask out(A.shape());
+
+  Private::mask_compare(A.data(), D.data(), out.mSize, out.mData.data(),
+    [](const X &a, const X &b) { return a >= b; });
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+mask mask::Less(const cppmat::array<X> &A, const cppmat::array<X> &D)
+{
+  assert( A.shape() == D.shape() );
+
+  mask out(A.shape());
+
+  Private::mask_compare(A.data(), D.data(), out.mSize, out.mData.data(),
+    [](const X &a, const X &b) { return a < b; });
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+mask mask::LessEqual(const cppmat::array<X> &A, const cppmat::array<X> &D)
+{
+  assert( A.shape() == D.shape() );
+
+  mask out(A.shape());
+
+  Private::mask_compare(A.data(), D.data(), out.mSize, out.mData.data(),
+    [](const X &a, const X &b) { return a <= b; });
+
+  return out;
+}
+
+// =================================================================================================
+// get dimensions
+// =================================================================================================
+
+inline
+size_t mask::size() const
+{
+  return mSize;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+size_t mask::rank() const
+{
+  return mShape.size();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+size_t mask::shape(size_t i) const
+{
+  assert( i < mShape.size() );
+
+  return mShape[i];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+const cppmat::shape_t& mask::shape() const
+{
+  return mShape;
+}
+
+// =================================================================================================
+// access to the words
+// =================================================================================================
+
+inline
+size_t mask::words() const
+{
+  return mData.size();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+const uint64_t* mask::data() const
+{
+  return mData.data();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+uint64_t* mask::data()
+{
+  return mData.data();
+}
+
+// =================================================================================================
+// get/set entry
+// =================================================================================================
+
+inline
+bool mask::operator[](size_t i) const
+{
+  assert( i < mSize );
+
+  return ( mData[i/64] >> (i%64) ) & 1;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void mask::set(size_t i, bool value)
+{
+  assert( i < mSize );
+
+  uint64_t bit = static_cast<uint64_t>(1) << (i%64);
+
+  if ( value ) mData[i/64] |=  bit;
+  else         mData[i/64] &= ~bit;
+}
+
+// =================================================================================================
+// initialize
+// =================================================================================================
+
+inline
+void mask::clearTail()
+{
+  if ( mSize % 64 == 0 ) return;
+
+  mData.back() &= ( static_cast<uint64_t>(1) << (mSize%64) ) - 1;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void mask::setZero()
+{
+  std::fill(mData.begin(), mData.end(), static_cast<uint64_t>(0));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void mask::setOnes()
+{
+  std::fill(mData.begin(), mData.end(), ~static_cast<uint64_t>(0));
+
+  clearTail();
+}
+
+// =================================================================================================
+// queries
+// =================================================================================================
+
+inline
+size_t mask::count() const
+{
+  size_t out = 0;
+
+  for ( auto &w : mData )
+    out += Private::popcount(w);
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+bool mask::any() const
+{
+  for ( auto &w : mData )
+    if ( w )
+      return true;
+
+  return false;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+bool mask::all() const
+{
+  return count() == mSize;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class F>
+inline
+void mask::for_each(F f) const
+{
+  for ( size_t k = 0 ; k < mData.size() ; ++k )
+  {
+    uint64_t w = mData[k];
+
+    while ( w )
+    {
+      f(64*k + Private::ctz(w));
+
+      w &= w - 1;
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+std::vector<size_t> mask::where() const
+{
+  std::vector<size_t> out(count());
+
+  size_t j = 0;
+
+  for_each([&](size_t i) { out[j++] = i; });
+
+  return out;
+}
+
+// =================================================================================================
+// logical operations
+// =================================================================================================
+
+inline
+mask mask::operator~ () const
+{
+  mask out = *this;
+
+  for ( auto &w : out.mData )
+    w = ~w;
+
+  out.clearTail();
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+mask& mask::operator&= (const mask &B)
+{
+  assert( mShape == B.mShape );
+
+  for ( size_t k = 0 ; k < mData.size() ; ++k )
+    mData[k] &= B.mData[k];
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+mask& mask::operator|= (const mask &B)
+{
+  assert( mShape == B.mShape );
+
+  for ( size_t k = 0 ; k < mData.size() ; ++k )
+    mData[k] |= B.mData[k];
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+mask& mask::operator^= (const mask &B)
+{
+  assert( mShape == B.mShape );
+
+  for ( size_t k = 0 ; k < mData.size() ; ++k )
+    mData[k] ^= B.mData[k];
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+mask operator& (const mask &A, const mask &B)
+{
+  mask C = A;
+
+  C &= B;
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+mask operator| (const mask &A, const mask &B)
+{
+  mask C = A;
+
+  C |= B;
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+mask operator^ (const mask &A, const mask &B)
+{
+  mask C = A;
+
+  C ^= B;
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+bool operator== (const mask &A, const mask &B)
+{
+  if ( A.shape() != B.shape() ) return false;
+
+  return std::equal(A.data(), A.data()+A.words(), B.data());
+}
+
+// =================================================================================================
+// conversion
+// =================================================================================================
+
+template<typename X>
+inline
+cppmat::array<X> mask::as() const
+{
+  cppmat::array<X> out(mShape);
+
+  X *o = out.data();
+
+  for ( size_t i = 0 ; i < mSize ; ++i )
+    o[i] = static_cast<X>( ( mData[i/64] >> (i%64) ) & 1 );
+
+  return out;
+}
+
+// =================================================================================================
+// masked operations
+// =================================================================================================
+
+template<typename X>
+inline
+cppmat::array<X> select(const mask &m, const cppmat::array<X> &A, const cppmat::array<X> &B)
+{
+  assert( m.shape() == A.shape() );
+  assert( m.shape() == B.shape() );
+
+  cppmat::array<X> C(A.shape());
+
+  const uint64_t *w = m.data();
+  const X        *a = A.data();
+  const X        *b = B.data();
+  X              *c = C.data();
+  size_t          n = C.size();
+
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for ( size_t i = 0 ; i < n ; ++i )
+    c[i] = ( ( w[i/64] >> (i%64) ) & 1 ) ? a[i] : b[i];
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> select(const mask &m, const cppmat::array<X> &A, const X &B)
+{
+  assert( m.shape() == A.shape() );
+
+  cppmat::array<X> C(A.shape());
+
+  const uint64_t *w = m.data();
+  const X        *a = A.data();
+  X              *c = C.data();
+  size_t          n = C.size();
+
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for ( size_t i = 0 ; i < n ; ++i )
+    c[i] = ( ( w[i/64] >> (i%64) ) & 1 ) ? a[i] : B;
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void putmask(cppmat::array<X> &A, const mask &m, const X &value)
+{
+  assert( m.shape() == A.shape() );
+
+  X *a = A.data();
+
+  m.for_each([&](size_t i) { a[i] = value; });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void putmask(cppmat::array<X> &A, const mask &m, const cppmat::array<X> &values)
+{
+  assert( m.shape() == A.shape() );
+  assert( m.shape() == values.shape() );
+
+  X       *a = A.data();
+  const X *v = values.data();
+
+  m.for_each([&](size_t i) { a[i] = v[i]; });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X masked_sum(const cppmat::array<X> &A, const mask &m)
+{
+  assert( m.shape() == A.shape() );
+
+  const X *a   = A.data();
+  X        out = static_cast<X>(0);
+
+  m.for_each([&](size_t i) { out += a[i]; });
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+double masked_mean(const cppmat::array<X> &A, const mask &m)
+{
+  return static_cast<double>(masked_sum(A, m)) / static_cast<double>(m.count());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X masked_min(const cppmat::array<X> &A, const mask &m)
+{
+  assert( m.shape() == A.shape() );
+
+  if ( not m.any() )
+    throw std::runtime_error("cppmat::masked_min: empty mask");
+
+  const X *a   = A.data();
+  X        out = std::numeric_limits<X>::max();
+
+  m.for_each([&](size_t i) { out = std::min(out, a[i]); });
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X masked_max(const cppmat::array<X> &A, const mask &m)
+{
+  assert( m.shape() == A.shape() );
+
+  if ( not m.any() )
+    throw std::runtime_error("cppmat::masked_max: empty mask");
+
+  const X *a   = A.data();
+  X        out = std::numeric_limits<X>::lowest();
+
+  m.for_each([&](size_t i) { out = std::max(out, a[i]); });
+
+  return out;
+}
+
+// =================================================================================================
+
+} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,93 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_MOMENTS_H
+#define CPPMAT_MOMENTS_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+
+// =================================================================================================
+// cppmat::moments : (weighted) number of values, mean, and central moments (up to fourth order) of
+// a stream of values, updated in a single pass (Welford). Two accumulators can be merged (Chan et
+// al., and Pebay for the higher moments), such that partial results can be computed in parallel or
+// over chunks of data. The weights act like frequency weights (the mean is that of "average").
+// =================================================================================================
+
+class moments
+{
+private:
+
+  double mW=0;    // total weight (the number of values, if unweighted)
+  double mMean=0; // (weighted) mean
+  double mM2=0;   // sum of "w * (x - mean)^2"
+  double mM3=0;   // sum of "w * (x - mean)^3"
+  double mM4=0;   // sum of "w * (x - mean)^4"
+
+public:
+
+  // constructor: empty
+  moments() = default;
+
+  // add a value, optionally with a weight
+  void push(double x);
+  void push(double x, double w);
+
+  // add a range of values
+  template<class It> void push(It first, It last);
+
+  // merge with the moments of other values
+  moments& operator+=(const moments &B);
+
+  // total weight (the number of values, if unweighted)
+  double weight() const;
+
+  // statistics: mean, variance (divided by "weight - ddof"), standard deviation, skewness, and
+  // excess kurtosis (the latter are biased: as "scipy.stats" with "bias=True")
+  double mean() const;
+  double var(double ddof=0) const;
+  double stddev(double ddof=0) const;
+  double skewness() const;
+  double kurtosis() const;
+
+};
+
+// merge
+moments operator+(const moments &A, const moments &B);
+
+// =================================================================================================
+
+namespace Private {
+
+// moments of the array "data" of a certain "shape" along (sorted) "axes", optionally weighted
+// ("weights" may be "nullptr"): the output has the shape of the input without these axes
+template<typename X>
+cppmat::array<cppmat::moments> moments_along(
+  const X *data, const X *weights, const cppmat::shape_t &shape, const std::vector<int> &axes);
+
+// moments of all "n" values in "data" (optionally weighted, "weights" may be "nullptr")
+template<typename X>
+cppmat::moments moments_all(const X *data, const X *weights, size_t n);
+
+// apply "f" to the moments of each lane
+template<typename X, class F>
+cppmat::array<X> moments_map(const cppmat::array<cppmat::moments> &M, F f);
+
+} // namespace ...
+
+// =================================================================================================
+
+} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
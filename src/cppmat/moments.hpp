@@ -0,0 +1,281 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_MOMENTS_HPP
+#define CPPMAT_MOMENTS_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+
+// =================================================================================================
+// add values
+// =================================================================================================
+
+// Welford's update, extended to the third and fourth moment (Terriberry); the old "mM2" and "mM3"
+// enter the update of the higher moments, which are therefore updated first
+inline
+void moments::push(double x)
+{
+  double n1 = mW;
+
+  mW += 1.;
+
+  double d  = x - mMean;
+  double dn = d / mW;
+  double t  = d * dn * n1;
+
+  mMean += dn;
+  mM4   += t * dn * dn * ( mW * mW - 3. * mW + 3. ) + 6. * dn * dn * mM2 - 4. * dn * mM3;
+  mM3   += t * dn * ( mW - 2. ) - 3. * dn * mM2;
+  mM2   += t;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// merge with a single value of weight "w" (see "operator+=")
+inline
+void moments::push(double x, double w)
+{
+  if ( w == 0. ) return;
+
+  double a = mW;
+  double W = mW + w;
+  double d = x - mMean;
+  double e = d * w / W;
+
+  mMean += e;
+  mM4   += e * d * d * d * a * ( a * a - a * w + w * w ) / ( W * W )
+         + 6. * e * e * mM2 - 4. * e * mM3;
+  mM3   += e * d * d * a * ( a - w ) / W - 3. * e * mM2;
+  mM2   += e * d * a;
+  mW     = W;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class It>
+inline
+void moments::push(It first, It last)
+{
+  for ( auto it = first ; it != last ; ++it )
+    push(static_cast<double>(*it));
+}
+
+// =================================================================================================
+// merge
+// =================================================================================================
+
+inline
+moments& moments::operator+=(const moments &B)
+{
+  if ( B.mW == 0. ) return *this;
+  if (   mW == 0. ) return *this = B;
+
+  double a  = mW;
+  double b  = B.mW;
+  double W  = a + b;
+  double d  = B.mMean - mMean;
+  double d2 = d * d;
+
+  mM4 += B.mM4 + d2 * d2 * a * b * ( a * a - a * b + b * b ) / ( W * W * W )
+       + 6. * d2 * ( a * a * B.mM2 + b * b * mM2 ) / ( W * W )
+       + 4. * d  * ( a * B.mM3 - b * mM3 ) / W;
+
+  mM3 += B.mM3 + d2 * d * a * b * ( a - b ) / ( W * W )
+       + 3. * d  * ( a * B.mM2 - b * mM2 ) / W;
+
+  mM2 += B.mM2 + d2 * a * b / W;
+
+  mMean += d * b / W;
+  mW     = W;
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+moments operator+(const moments &A, const moments &B)
+{
+  moments C = A;
+
+  C += B;
+
+  return C;
+}
+
+// =================================================================================================
+// statistics
+// =================================================================================================
+
+inline
+double moments::weight() const
+{
+  return mW;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+double moments::mean() const
+{
+  return mMean;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+double moments::var(double ddof) const
+{
+  return mM2 / ( mW - ddof );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+double moments::stddev(double ddof) const
+{
+  return std::sqrt(var(ddof));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+double moments::skewness() const
+{
+  return std::sqrt(mW) * mM3 / std::pow(mM2, 1.5);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+double moments::kurtosis() const
+{
+  return mW * mM4 / ( mM2 * mM2 ) - 3.;
+}
+
+// =================================================================================================
+// support functions
+// =================================================================================================
+
+namespace Private {
+
+// the values are read in storage order (in a single pass), and are added to the moments of the lane
+// that follows from the multi-index (with zero strides along the reduced axes)
+template<typename X>
+inline
+cppmat::array<cppmat::moments> moments_along(
+  const X *data, const X *weights, const cppmat::shape_t &shape, const std::vector<int> &axes)
+{
+  size_t rank = shape.size();
+
+  // flag the reduced axes
+  std::vector<int> reduce(rank, 0);
+
+  for ( auto &i : axes ) {
+    assert( i >= 0 and static_cast<size_t>(i) < rank );
+    reduce[i] = 1;
+  }
+
+  // shape of the output
+  cppmat::shape_t oshape;
+
+  for ( size_t i = 0 ; i < rank ; ++i )
+    if ( not reduce[i] )
+      oshape.push_back(shape[i]);
+
+  // allocate output (zero-initialized)
+  cppmat::array<cppmat::moments> out(oshape);
+
+  // strides of the output, per axis of the input
+  cppmat::shape_t ostrides = out.strides();
+  cppmat::shape_t strides;
+
+  for ( size_t i = 0, j = 0 ; i < rank ; ++i )
+    strides.push_back( reduce[i] ? 0 : ostrides[j++] );
+
+  // single pass over the input
+  cppmat::multi_index<1> idx(shape, {strides});
+
+  size_t n = idx.size();
+
+  if ( weights )
+    for ( size_t i = 0 ; i < n ; ++i, ++idx )
+      out[idx.offset()].push(static_cast<double>(data[i]), static_cast<double>(weights[i]));
+  else
+    for ( size_t i = 0 ; i < n ; ++i, ++idx )
+      out[idx.offset()].push(static_cast<double>(data[i]));
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// the values are divided in blocks of fixed size, that are distributed over threads; the moments of
+// the blocks are merged in order, such that the result does not depend on the number of threads
+template<typename X>
+inline
+cppmat::moments moments_all(const X *data, const X *weights, size_t n)
+{
+  const size_t bs = 4096;
+
+  size_t nb = ( n + bs - 1 ) / bs;
+
+  std::vector<cppmat::moments> part(nb);
+
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for ( size_t b = 0 ; b < nb ; ++b )
+  {
+    size_t i0 = b * bs;
+    size_t i1 = std::min(i0+bs, n);
+
+    if ( weights )
+      for ( size_t i = i0 ; i < i1 ; ++i )
+        part[b].push(static_cast<double>(data[i]), static_cast<double>(weights[i]));
+    else
+      for ( size_t i = i0 ; i < i1 ; ++i )
+        part[b].push(static_cast<double>(data[i]));
+  }
+
+  cppmat::moments out;
+
+  for ( auto &p : part )
+    out += p;
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class F>
+inline
+cppmat::array<X> moments_map(const cppmat::array<cppmat::moments> &M, F f)
+{
+  cppmat::array<X> out(M.shape());
+
+  for ( size_t i = 0 ; i < M.size() ; ++i )
+    out[i] = static_cast<X>(f(M[i]));
+
+  return out;
+}
+
+} // namespace ...
+
+// =================================================================================================
+
+} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -0,0 +1,89 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_MULTI_INDEX_H
+#define CPPMAT_MULTI_INDEX_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+
+// =================================================================================================
+// cppmat::multi_index : visit all multi-indices (a,b,c,...) of a shape, in row-major order. The
+// multi-index is advanced incrementally (only carrying to the next axis when the last one wraps),
+// which avoids the division and modulo per axis of "decompress". Along the way the flat offset of
+// "N" operands is kept up-to-date, whereby each operand has its own (arbitrary) strides and start,
+// e.g. for a strided view, or for the output of a reduction (with a zero stride along the axis).
+// =================================================================================================
+
+template<size_t N=1>
+class multi_index
+{
+private:
+
+  cppmat::shape_t mShape;       // number of entries along each axis
+  cppmat::shape_t mIndex;       // current multi-index
+  cppmat::shape_t mStrides[N];  // strides of each operand
+  cppmat::shape_t mBack[N];     // "(shape[i]-1)*strides[i]" : offset to undo when axis "i" wraps
+  size_t          mStart[N];    // offset of each operand at the multi-index (0,0,...)
+  size_t          mOffset[N];   // current offset of each operand
+  size_t          mRank=0;      // number of axes
+  size_t          mSize=0;      // total number of multi-indices
+  size_t          mFlat=0;      // number of multi-indices visited so far
+
+  // compute the derived sizes, and reset
+  void init();
+
+public:
+
+  // constructor: all operands contiguous (row-major)
+  multi_index(const cppmat::shape_t &shape);
+
+  // constructor: strides (and start) of each operand
+  multi_index(
+    const cppmat::shape_t &shape,
+    std::initializer_list<cppmat::shape_t> strides,
+    std::initializer_list<size_t> start={}
+  );
+
+  // get dimensions
+  size_t size() const;
+  size_t rank() const;
+  const cppmat::shape_t& shape() const;
+
+  // current multi-index
+  const cppmat::shape_t& index() const;
+  size_t index(size_t axis) const;
+
+  // current flat index (in row-major order of "shape")
+  size_t flat() const;
+
+  // current offset of operand "i"
+  size_t offset(size_t i=0) const;
+
+  // check if all multi-indices have been visited
+  bool end() const;
+
+  // advance to the next multi-index
+  multi_index& operator++();
+
+  // return to the multi-index (0,0,...)
+  void reset();
+
+};
+
+// =================================================================================================
+
+} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -0,0 +1,223 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_MULTI_INDEX_HPP
+#define CPPMAT_MULTI_INDEX_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+
+// =================================================================================================
+// constructors
+// =================================================================================================
+
+template<size_t N>
+inline
+multi_index<N>::multi_index(const cppmat::shape_t &shape) : mShape(shape)
+{
+  mRank = mShape.size();
+
+  // row-major strides
+  cppmat::shape_t strides;
+
+  strides.resize(mRank, 1);
+
+  for ( size_t i = mRank ; i-- > 1 ; )
+    strides[i-1] = strides[i] * mShape[i];
+
+  for ( size_t i = 0 ; i < N ; ++i ) {
+    mStrides[i] = strides;
+    mStart  [i] = 0;
+  }
+
+  init();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N>
+inline
+multi_index<N>::multi_index(
+  const cppmat::shape_t &shape,
+  std::initializer_list<cppmat::shape_t> strides,
+  std::initializer_list<size_t> start
+) : mShape(shape)
+{
+  assert( strides.size() == N );
+  assert( start.size() == N or start.size() == 0 );
+
+  mRank = mShape.size();
+
+  std::copy(strides.begin(), strides.end(), std::begin(mStrides));
+
+  if ( start.size() == 0 ) std::fill(std::begin(mStart), std::end(mStart), 0);
+  else                     std::copy(start.begin(), start.end(), std::begin(mStart));
+
+  #ifndef NDEBUG
+    for ( size_t i = 0 ; i < N ; ++i ) assert( mStrides[i].size() == mRank );
+  #endif
+
+  init();
+}
+
+// =================================================================================================
+// compute the derived sizes, and reset
+// =================================================================================================
+
+template<size_t N>
+inline
+void multi_index<N>::init()
+{
+  mSize = 1;
+
+  for ( size_t i = 0 ; i < mRank ; ++i )
+    mSize *= mShape[i];
+
+  for ( size_t j = 0 ; j < N ; ++j )
+  {
+    mBack[j].resize(mRank);
+
+    for ( size_t i = 0 ; i < mRank ; ++i )
+      mBack[j][i] = mShape[i] > 0 ? ( mShape[i] - 1 ) * mStrides[j][i] : 0;
+  }
+
+  reset();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N>
+inline
+void multi_index<N>::reset()
+{
+  mFlat = 0;
+
+  mIndex.clear();
+  mIndex.resize(mRank, 0);
+
+  std::copy(std::begin(mStart), std::end(mStart), std::begin(mOffset));
+}
+
+// =================================================================================================
+// get dimensions
+// =================================================================================================
+
+template<size_t N>
+inline
+size_t multi_index<N>::size() const
+{
+  return mSize;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N>
+inline
+size_t multi_index<N>::rank() const
+{
+  return mRank;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N>
+inline
+const cppmat::shape_t& multi_index<N>::shape() const
+{
+  return mShape;
+}
+
+// =================================================================================================
+// current position
+// =================================================================================================
+
+template<size_t N>
+inline
+const cppmat::shape_t& multi_index<N>::index() const
+{
+  return mIndex;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N>
+inline
+size_t multi_index<N>::index(size_t axis) const
+{
+  assert( axis < mRank );
+
+  return mIndex[axis];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N>
+inline
+size_t multi_index<N>::flat() const
+{
+  return mFlat;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N>
+inline
+size_t multi_index<N>::offset(size_t i) const
+{
+  assert( i < N );
+
+  return mOffset[i];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N>
+inline
+bool multi_index<N>::end() const
+{
+  return mFlat >= mSize;
+}
+
+// =================================================================================================
+// advance to the next multi-index
+// =================================================================================================
+
+// the last axis is incremented; if it wraps it is reset to zero, and the carry moves to the previous
+// axis (the offsets are corrected by the same amount); after the last multi-index all axes wrap
+template<size_t N>
+inline
+multi_index<N>& multi_index<N>::operator++()
+{
+  ++mFlat;
+
+  for ( size_t i = mRank ; i-- > 0 ; )
+  {
+    if ( ++mIndex[i] < mShape[i] ) {
+      for ( size_t j = 0 ; j < N ; ++j ) mOffset[j] += mStrides[j][i];
+      return *this;
+    }
+
+    mIndex[i] = 0;
+
+    for ( size_t j = 0 ; j < N ; ++j ) mOffset[j] -= mBack[j][i];
+  }
+
+  return *this;
+}
+
+// =================================================================================================
+
+} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -22,8 +22,83 @@ template<typename X> std::vector<X> sort_axes(const std::vector<X> &A, X n, bool
 
 // -------------------------------------------------------------------------------------------------
 
+// array-index along an axis with "n" entries: signed indices are periodic ("-1" is the last entry)
+template<typename T, typename=typename std::enable_if<std::is_signed<T>::value,void>::type>
+size_t index(T a, size_t n, bool periodic);
+
+template<typename T, typename=typename std::enable_if<std::is_unsigned<T>::value,void>::type,
+  typename=void>
+size_t index(T a, size_t n, bool periodic);
+
+// -------------------------------------------------------------------------------------------------
+
+// strides of the output of a reduction along "axis", per axis of the input: zero along "axis"
+cppmat::shape_t reduce_strides(const cppmat::shape_t &strides, size_t axis);
+
+// -------------------------------------------------------------------------------------------------
+
 bool equal(double a, double b);
 
+// -------------------------------------------------------------------------------------------------
+
+// transpose a row-major "n x m" matrix (e.g. array-of-structures <-> structure-of-arrays)
+template<typename X> void transpose(const X *in, X *out, size_t n, size_t m);
+
+// -------------------------------------------------------------------------------------------------
+
+// matrix product of row-major matrices, "C = A * B", with "A: m x k", "B: k x n", "C: m x n"
+template<typename X> void gemm(const X *A, const X *B, X *C, size_t m, size_t k, size_t n);
+
+// -------------------------------------------------------------------------------------------------
+
+// Kernels for cartesian tensors, operating on the (row-major) storage. The number of dimensions is
+// the template parameter "N", or (for "N == 0") the runtime argument "ndim". "nd_dispatch" calls
+// "f(std::integral_constant<size_t,N>())" with "N = ndim" for "ndim <= 3" and "N = 0" otherwise,
+// such that the loops of the common cases have compile-time bounds.
+template<class F> auto nd_dispatch(size_t ndim, F f) -> decltype(f(std::integral_constant<size_t,0>()));
+
+// fourth-order tensors stored as "nd^2 x nd^2" row-major matrices ("out" may not alias the input)
+// - double contraction: C_ijmn = A_ijkl * B_lkmn
+// - dyadic product    : C_ijkl = A_ij * B_kl
+// - transpositions    : C_lkji = A_ijkl (T), C_ijlk = A_ijkl (RT), C_jikl = A_ijkl (LT)
+template<size_t N=0, typename X> void ddot44  (const X *A, const X *B, X *C, size_t ndim);
+template<size_t N=0, typename X> void dyadic22(const X *A, const X *B, X *C, size_t ndim);
+template<size_t N=0, typename X> void T4      (const X *A, X *C, size_t ndim);
+template<size_t N=0, typename X> void RT4     (const X *A, X *C, size_t ndim);
+template<size_t N=0, typename X> void LT4     (const X *A, X *C, size_t ndim);
+
+// products of fourth-order tensors, second-order tensors, and vectors ("C" may not alias the input)
+// - double contraction: C_ij = A_ijkl * B_lk (42), C_kl = A_ij * B_jikl (24), C = A_ij * B_ji (22)
+// - dot product       : C_ik = A_ij * B_jk (22), C_i = A_ij * B_j (21), C_j = A_i * B_ij (12),
+//                       C = A_i * B_i (11)
+// - dyadic product    : C_ij = A_i * B_j
+// - transpose, trace  : C_ji = A_ij, C = A_ii
+template<size_t N=0, typename X> void ddot42  (const X *A, const X *B, X *C, size_t ndim);
+template<size_t N=0, typename X> void ddot24  (const X *A, const X *B, X *C, size_t ndim);
+template<size_t N=0, typename X> X    ddot22  (const X *A, const X *B, size_t ndim);
+template<size_t N=0, typename X> void dot22   (const X *A, const X *B, X *C, size_t ndim);
+template<size_t N=0, typename X> void dot21   (const X *A, const X *B, X *C, size_t ndim);
+template<size_t N=0, typename X> void dot12   (const X *A, const X *B, X *C, size_t ndim);
+template<size_t N=0, typename X> X    dot11   (const X *A, const X *B, size_t ndim);
+template<size_t N=0, typename X> void dyadic11(const X *A, const X *B, X *C, size_t ndim);
+template<size_t N=0, typename X> void T2      (const X *A, X *C, size_t ndim);
+template<size_t N=0, typename X> X    trace2  (const X *A, size_t ndim);
+
+// second-order tensors ("C" may not alias the input; 1-3 dimensions in closed form, otherwise by
+// Gaussian elimination with partial pivoting; a singular tensor is not detected)
+// - determinant, inverse
+// - deviator          : C_ij = A_ij - A_kk / nd * delta_ij
+// - eigen-decomposition of the symmetric part (cyclic Jacobi rotations): the eigenvalues "val" in
+//   ascending order, with the corresponding eigenvectors as columns of "vec"
+template<size_t N=0, typename X> X    det2    (const X *A, size_t ndim);
+template<size_t N=0, typename X> void inv2    (const X *A, X *C, size_t ndim);
+template<size_t N=0, typename X> void dev2    (const X *A, X *C, size_t ndim);
+template<size_t N=0, typename X> void eigs2   (const X *A, X *vec, X *val, size_t ndim);
+
+// check that an output "C" does not share its storage with the input "A" (and "B")
+template<class C, class A>          bool noalias(const C &c, const A &a);
+template<class C, class A, class B> bool noalias(const C &c, const A &a, const B &b);
+
 // =================================================================================================
 
 }} // namespace ...
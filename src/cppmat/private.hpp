@@ -39,6 +39,52 @@ std::vector<X> sort_axes(const std::vector<X> &in, X n, bool reverse)
 
 // =================================================================================================
 
+template<typename T, typename S>
+inline
+size_t index(T a, size_t n, bool periodic)
+{
+  T m = static_cast<T>(n);
+
+  assert( ( a < m && a >= -m ) or periodic );
+
+  (void)periodic;
+
+  return static_cast<size_t>( (m+(a%m)) % m );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, typename S, typename U>
+inline
+size_t index(T a, size_t n, bool periodic)
+{
+  assert( a < n );
+
+  (void)n;
+  (void)periodic;
+
+  return static_cast<size_t>(a);
+}
+
+// =================================================================================================
+
+inline
+cppmat::shape_t reduce_strides(const cppmat::shape_t &strides, size_t axis)
+{
+  assert( axis <= strides.size() );
+
+  cppmat::shape_t out(strides.begin(), strides.begin()+axis);
+
+  out.push_back(0);
+
+  for ( size_t i = axis ; i < strides.size() ; ++i )
+    out.push_back(strides[i]);
+
+  return out;
+}
+
+// =================================================================================================
+
 inline bool equal(double a, double b)
 {
   return std::fabs(a - b) <= std::numeric_limits<double>::epsilon();
@@ -46,6 +92,651 @@ inline bool equal(double a, double b)
 
 // =================================================================================================
 
+template<typename X>
+inline
+void transpose(const X *in, X *out, size_t n, size_t m)
+{
+  // block size: for small "m" a block of rows (input) and a block of columns (output) are read and
+  // written contiguously, and both fit in the L1 cache
+  const size_t bs = 64;
+
+  for ( size_t i0 = 0 ; i0 < n ; i0 += bs )
+  {
+    size_t i1 = std::min(i0+bs, n);
+
+    for ( size_t j0 = 0 ; j0 < m ; j0 += bs )
+    {
+      size_t j1 = std::min(j0+bs, m);
+
+      for ( size_t j = j0 ; j < j1 ; ++j )
+        for ( size_t i = i0 ; i < i1 ; ++i )
+          out[j*n+i] = in[i*m+j];
+    }
+  }
+}
+
+// =================================================================================================
+
+template<class F>
+inline
+auto nd_dispatch(size_t ndim, F f) -> decltype(f(std::integral_constant<size_t,0>()))
+{
+  switch ( ndim )
+  {
+    case 1 : return f(std::integral_constant<size_t,1>());
+    case 2 : return f(std::integral_constant<size_t,2>());
+    case 3 : return f(std::integral_constant<size_t,3>());
+    default: return f(std::integral_constant<size_t,0>());
+  }
+}
+
+// =================================================================================================
+
+template<typename X>
+inline
+void gemm(const X *A, const X *B, X *C, size_t m, size_t k, size_t n)
+{
+  // "i-p-j" loop order (unit stride for "B" and "C"), blocked over the columns of "B" and "C" and
+  // over the inner dimension, such that the block of "B" stays in cache
+  const size_t bn = 256;
+  const size_t bk = 64;
+
+  std::fill(C, C+m*n, static_cast<X>(0));
+
+  for ( size_t j0 = 0 ; j0 < n ; j0 += bn )
+  {
+    size_t j1 = std::min(j0+bn, n);
+
+    for ( size_t p0 = 0 ; p0 < k ; p0 += bk )
+    {
+      size_t p1 = std::min(p0+bk, k);
+
+      for ( size_t i = 0 ; i < m ; ++i )
+      {
+        const X *a = A + i*k;
+        X       *c = C + i*n;
+
+        for ( size_t p = p0 ; p < p1 ; ++p )
+        {
+          const X  aip = a[p];
+          const X *b   = B + p*n;
+
+          for ( size_t j = j0 ; j < j1 ; ++j )
+            c[j] += aip * b[j];
+        }
+      }
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void ddot44(const X *A, const X *B, X *C, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+
+  // as matrices: "C = A * LT(B)", whereby row "(k,l)" of "LT(B)" is row "(l,k)" of "B"; the
+  // columns of "C" and "B" are processed in blocks, such that the block of "B" stays in cache
+  const size_t n  = nd*nd;
+  const size_t bs = 64;
+
+  std::fill(C, C+n*n, static_cast<X>(0));
+
+  for ( size_t j0 = 0 ; j0 < n ; j0 += bs )
+  {
+    size_t j1 = std::min(j0+bs, n);
+
+    for ( size_t r = 0 ; r < n ; ++r )
+    {
+      const X *a = A + r*n;
+      X       *c = C + r*n;
+
+      for ( size_t k = 0 ; k < nd ; ++k )
+      {
+        for ( size_t l = 0 ; l < nd ; ++l )
+        {
+          const X  alk = a[k*nd+l];
+          const X *b   = B + (l*nd+k)*n;
+
+          for ( size_t j = j0 ; j < j1 ; ++j )
+            c[j] += alk * b[j];
+        }
+      }
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void dyadic22(const X *A, const X *B, X *C, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+
+  // as matrices: the outer product of the (flattened) second-order tensors
+  const size_t n = nd*nd;
+
+  for ( size_t r = 0 ; r < n ; ++r )
+  {
+    const X  ar = A[r];
+    X       *c  = C + r*n;
+
+    for ( size_t j = 0 ; j < n ; ++j )
+      c[j] = ar * B[j];
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void T4(const X *A, X *C, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+
+  // as matrices: "C(s(q),s(r)) = A(r,q)", with "s" swapping the indices of a pair
+  const size_t n = nd*nd;
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+  {
+    for ( size_t j = 0 ; j < nd ; ++j )
+    {
+      const X *a = A + (i*nd+j)*n;
+      X       *c = C + (j*nd+i);
+
+      for ( size_t k = 0 ; k < nd ; ++k )
+        for ( size_t l = 0 ; l < nd ; ++l )
+          c[(l*nd+k)*n] = a[k*nd+l];
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void RT4(const X *A, X *C, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+
+  // as matrices: each row is an "nd x nd" matrix, which is transposed
+  const size_t n = nd*nd;
+
+  for ( size_t r = 0 ; r < n ; ++r )
+    for ( size_t k = 0 ; k < nd ; ++k )
+      for ( size_t l = 0 ; l < nd ; ++l )
+        C[r*n+l*nd+k] = A[r*n+k*nd+l];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void LT4(const X *A, X *C, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+
+  // as matrices: row "(i,j)" is copied to row "(j,i)"
+  const size_t n = nd*nd;
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    for ( size_t j = 0 ; j < nd ; ++j )
+      std::copy(A+(i*nd+j)*n, A+(i*nd+j+1)*n, C+(j*nd+i)*n);
+}
+
+// =================================================================================================
+
+template<size_t N, typename X>
+inline
+void ddot42(const X *A, const X *B, X *C, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+  const size_t n  = nd*nd;
+
+  for ( size_t r = 0 ; r < n ; ++r )
+  {
+    const X *a = A + r*n;
+    X        c = static_cast<X>(0);
+
+    for ( size_t k = 0 ; k < nd ; ++k )
+      for ( size_t l = 0 ; l < nd ; ++l )
+        c += a[k*nd+l] * B[l*nd+k];
+
+    C[r] = c;
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void ddot24(const X *A, const X *B, X *C, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+  const size_t n  = nd*nd;
+
+  std::fill(C, C+n, static_cast<X>(0));
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+  {
+    for ( size_t j = 0 ; j < nd ; ++j )
+    {
+      const X  aij = A[i*nd+j];
+      const X *b   = B + (j*nd+i)*n;
+
+      for ( size_t c = 0 ; c < n ; ++c )
+        C[c] += aij * b[c];
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+X ddot22(const X *A, const X *B, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+
+  X C = static_cast<X>(0);
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    for ( size_t j = 0 ; j < nd ; ++j )
+      C += A[i*nd+j] * B[j*nd+i];
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void dot22(const X *A, const X *B, X *C, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+
+  std::fill(C, C+nd*nd, static_cast<X>(0));
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    for ( size_t j = 0 ; j < nd ; ++j )
+      for ( size_t k = 0 ; k < nd ; ++k )
+        C[i*nd+k] += A[i*nd+j] * B[j*nd+k];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void dot21(const X *A, const X *B, X *C, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+  {
+    X c = static_cast<X>(0);
+
+    for ( size_t j = 0 ; j < nd ; ++j )
+      c += A[i*nd+j] * B[j];
+
+    C[i] = c;
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void dot12(const X *A, const X *B, X *C, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+
+  std::fill(C, C+nd, static_cast<X>(0));
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    for ( size_t j = 0 ; j < nd ; ++j )
+      C[j] += A[i] * B[i*nd+j];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+X dot11(const X *A, const X *B, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+
+  X C = static_cast<X>(0);
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    C += A[i] * B[i];
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void dyadic11(const X *A, const X *B, X *C, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    for ( size_t j = 0 ; j < nd ; ++j )
+      C[i*nd+j] = A[i] * B[j];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void T2(const X *A, X *C, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    for ( size_t j = 0 ; j < nd ; ++j )
+      C[j*nd+i] = A[i*nd+j];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+X trace2(const X *A, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+
+  X C = static_cast<X>(0);
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    C += A[i*nd+i];
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+X det2(const X *A, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+
+  if ( nd == 1 )
+    return A[0];
+
+  if ( nd == 2 )
+    return A[0] * A[3] - A[1] * A[2];
+
+  if ( nd == 3 )
+    return ( A[0] * A[4] * A[8] +
+             A[1] * A[5] * A[6] +
+             A[2] * A[3] * A[7] ) -
+           ( A[2] * A[4] * A[6] +
+             A[1] * A[3] * A[8] +
+             A[0] * A[5] * A[7] );
+
+  // LU-decomposition with partial pivoting: the product of the pivots
+  std::vector<X> a(A, A+nd*nd);
+
+  X D = static_cast<X>(1);
+
+  for ( size_t k = 0 ; k < nd ; ++k )
+  {
+    size_t p = k;
+
+    for ( size_t i = k+1 ; i < nd ; ++i )
+      if ( std::abs(a[i*nd+k]) > std::abs(a[p*nd+k]) )
+        p = i;
+
+    if ( a[p*nd+k] == static_cast<X>(0) )
+      return static_cast<X>(0);
+
+    if ( p != k ) {
+      std::swap_ranges(a.begin()+k*nd, a.begin()+(k+1)*nd, a.begin()+p*nd);
+      D = -D;
+    }
+
+    D *= a[k*nd+k];
+
+    for ( size_t i = k+1 ; i < nd ; ++i )
+    {
+      X f = a[i*nd+k] / a[k*nd+k];
+
+      for ( size_t j = k+1 ; j < nd ; ++j )
+        a[i*nd+j] -= f * a[k*nd+j];
+    }
+  }
+
+  return D;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void inv2(const X *A, X *C, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+
+  if ( nd == 1 )
+  {
+    C[0] = static_cast<X>(1) / A[0];
+    return;
+  }
+
+  if ( nd == 2 )
+  {
+    X D = det2<N>(A, nd);
+
+    C[0] =                      A[3] / D;
+    C[1] = static_cast<X>(-1) * A[1] / D;
+    C[2] = static_cast<X>(-1) * A[2] / D;
+    C[3] =                      A[0] / D;
+    return;
+  }
+
+  if ( nd == 3 )
+  {
+    X D = det2<N>(A, nd);
+
+    C[0] = (A[4]*A[8]-A[5]*A[7]) / D;
+    C[1] = (A[2]*A[7]-A[1]*A[8]) / D;
+    C[2] = (A[1]*A[5]-A[2]*A[4]) / D;
+    C[3] = (A[5]*A[6]-A[3]*A[8]) / D;
+    C[4] = (A[0]*A[8]-A[2]*A[6]) / D;
+    C[5] = (A[2]*A[3]-A[0]*A[5]) / D;
+    C[6] = (A[3]*A[7]-A[4]*A[6]) / D;
+    C[7] = (A[1]*A[6]-A[0]*A[7]) / D;
+    C[8] = (A[0]*A[4]-A[1]*A[3]) / D;
+    return;
+  }
+
+  // Gauss-Jordan elimination with partial pivoting, "C" starts as the identity
+  std::vector<X> a(A, A+nd*nd);
+
+  std::fill(C, C+nd*nd, static_cast<X>(0));
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    C[i*nd+i] = static_cast<X>(1);
+
+  for ( size_t k = 0 ; k < nd ; ++k )
+  {
+    size_t p = k;
+
+    for ( size_t i = k+1 ; i < nd ; ++i )
+      if ( std::abs(a[i*nd+k]) > std::abs(a[p*nd+k]) )
+        p = i;
+
+    if ( p != k ) {
+      std::swap_ranges(a.begin()+k*nd, a.begin()+(k+1)*nd, a.begin()+p*nd);
+      std::swap_ranges(C+k*nd, C+(k+1)*nd, C+p*nd);
+    }
+
+    X f = static_cast<X>(1) / a[k*nd+k];
+
+    for ( size_t j = 0 ; j < nd ; ++j ) {
+      a[k*nd+j] *= f;
+      C[k*nd+j] *= f;
+    }
+
+    for ( size_t i = 0 ; i < nd ; ++i )
+    {
+      if ( i == k ) continue;
+
+      X g = a[i*nd+k];
+
+      if ( g == static_cast<X>(0) ) continue;
+
+      for ( size_t j = 0 ; j < nd ; ++j ) {
+        a[i*nd+j] -= g * a[k*nd+j];
+        C[i*nd+j] -= g * C[k*nd+j];
+      }
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void dev2(const X *A, X *C, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+
+  X m = trace2<N>(A, nd) / static_cast<X>(nd);
+
+  std::copy(A, A+nd*nd, C);
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    C[i*nd+i] -= m;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N, typename X>
+inline
+void eigs2(const X *A, X *vec, X *val, size_t ndim)
+{
+  const size_t nd = N ? N : ndim;
+
+  // work storage: on the stack for a compile-time number of dimensions
+  X              fixed[N ? N*N : 1];
+  std::vector<X> store(N ? 0 : nd*nd);
+  X             *a = N ? fixed : store.data();
+
+  // symmetric part, the eigenvectors start as the identity
+  X norm = static_cast<X>(0);
+
+  for ( size_t i = 0 ; i < nd ; ++i ) {
+    for ( size_t j = 0 ; j < nd ; ++j ) {
+      a  [i*nd+j] = ( A[i*nd+j] + A[j*nd+i] ) / static_cast<X>(2);
+      vec[i*nd+j] = static_cast<X>( i == j );
+      norm       += a[i*nd+j] * a[i*nd+j];
+    }
+  }
+
+  // sweeps of rotations that each annihilate one off-diagonal pair (converges quadratically)
+  const X eps = std::numeric_limits<X>::epsilon();
+
+  for ( size_t sweep = 0 ; sweep < 50 ; ++sweep )
+  {
+    X off = static_cast<X>(0);
+
+    for ( size_t p = 0 ; p < nd ; ++p )
+      for ( size_t q = p+1 ; q < nd ; ++q )
+        off += a[p*nd+q] * a[p*nd+q];
+
+    if ( off <= eps * eps * norm ) break;
+
+    for ( size_t p = 0 ; p < nd ; ++p )
+    {
+      for ( size_t q = p+1 ; q < nd ; ++q )
+      {
+        X apq = a[p*nd+q];
+
+        if ( apq == static_cast<X>(0) ) continue;
+
+        X theta = ( a[q*nd+q] - a[p*nd+p] ) / ( static_cast<X>(2) * apq );
+        X t     = static_cast<X>(1) / ( std::abs(theta) + std::sqrt(theta*theta + static_cast<X>(1)) );
+
+        if ( theta < static_cast<X>(0) ) t = -t;
+
+        X c = static_cast<X>(1) / std::sqrt(t*t + static_cast<X>(1));
+        X s = t * c;
+
+        // "a = P^T * a * P", "vec = vec * P"
+        for ( size_t k = 0 ; k < nd ; ++k ) {
+          X akp = a[k*nd+p];
+          X akq = a[k*nd+q];
+          a[k*nd+p] = c * akp - s * akq;
+          a[k*nd+q] = s * akp + c * akq;
+        }
+
+        for ( size_t k = 0 ; k < nd ; ++k ) {
+          X apk = a[p*nd+k];
+          X aqk = a[q*nd+k];
+          a[p*nd+k] = c * apk - s * aqk;
+          a[q*nd+k] = s * apk + c * aqk;
+        }
+
+        for ( size_t k = 0 ; k < nd ; ++k ) {
+          X vkp = vec[k*nd+p];
+          X vkq = vec[k*nd+q];
+          vec[k*nd+p] = c * vkp - s * vkq;
+          vec[k*nd+q] = s * vkp + c * vkq;
+        }
+      }
+    }
+  }
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    val[i] = a[i*nd+i];
+
+  // sort in ascending order
+  for ( size_t i = 0 ; i < nd ; ++i )
+  {
+    size_t m = i;
+
+    for ( size_t j = i+1 ; j < nd ; ++j )
+      if ( val[j] < val[m] )
+        m = j;
+
+    if ( m == i ) continue;
+
+    std::swap(val[i], val[m]);
+
+    for ( size_t k = 0 ; k < nd ; ++k )
+      std::swap(vec[k*nd+i], vec[k*nd+m]);
+  }
+}
+
+// =================================================================================================
+// check aliasing of an output
+// =================================================================================================
+
+template<class C, class A>
+inline
+bool noalias(const C &c, const A &a)
+{
+  return static_cast<const void*>(c.data()) != static_cast<const void*>(a.data());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class C, class A, class B>
+inline
+bool noalias(const C &c, const A &a, const B &b)
+{
+  return noalias(c, a) and noalias(c, b);
+}
+
+// =================================================================================================
+
 }} // namespace ...
 
 // -------------------------------------------------------------------------------------------------
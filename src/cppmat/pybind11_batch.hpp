@@ -0,0 +1,229 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_BATCH_PYBIND11_HPP
+#define CPPMAT_BATCH_PYBIND11_HPP
+
+#include "pybind11.h"
+
+namespace py = pybind11;
+
+namespace cppmat {
+namespace batch {
+
+// =================================================================================================
+// Python bindings of "cppmat::batch", operating directly on NumPy-arrays (of type "double"). The
+// computation is done without the GIL, and is distributed over threads (with OpenMP). A scalar per
+// item has the batch shape as shape (i.e. a 0-d array for a single item).
+// =================================================================================================
+
+namespace Private {
+
+typedef py::array_t<double, py::array::c_style | py::array::forcecast> pyarray;
+
+typedef void (*unary_kernel )(const double*, double*, size_t, size_t);
+typedef void (*binary_kernel)(const double*, const double*, double*, size_t, size_t);
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+std::vector<size_t> pybind11_shape(const pyarray &A)
+{
+  std::vector<size_t> out(static_cast<size_t>(A.ndim()));
+
+  for ( size_t i = 0 ; i < out.size() ; ++i )
+    out[i] = static_cast<size_t>(A.shape(i));
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+pyarray pybind11_empty(const std::vector<size_t> &items, size_t rank, size_t nd)
+{
+  std::vector<py::ssize_t> shape(items.begin(), items.end());
+
+  for ( size_t i = 0 ; i < rank ; ++i )
+    shape.push_back(static_cast<py::ssize_t>(nd));
+
+  return pyarray(shape);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+pyarray pybind11_unary(const pyarray &A, size_t rc, unary_kernel f)
+{
+  size_t nd = ndim(pybind11_shape(A));
+
+  std::vector<size_t> items = Private::items(pybind11_shape(A), 2, nd);
+
+  pyarray C = pybind11_empty(items, rc, nd);
+
+  const double *a = A.data();
+  double       *c = C.mutable_data();
+  size_t        n = size(items);
+
+  {
+    py::gil_scoped_release release;
+
+    f(a, c, n, nd);
+  }
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+pyarray pybind11_binary(const pyarray &A, const pyarray &B, size_t ra, size_t rb, size_t rc,
+  binary_kernel f)
+{
+  size_t nd = ndim(pybind11_shape(A));
+
+  std::vector<size_t> items = Private::items(pybind11_shape(A), ra, nd);
+
+  if ( Private::items(pybind11_shape(B), rb, nd) != items )
+    throw std::runtime_error("cppmat::batch: batch shapes do not match");
+
+  pyarray C = pybind11_empty(items, rc, nd);
+
+  const double *a = A.data();
+  const double *b = B.data();
+  double       *c = C.mutable_data();
+  size_t        n = size(items);
+
+  {
+    py::gil_scoped_release release;
+
+    f(a, b, c, n, nd);
+  }
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+py::tuple pybind11_eigs(const pyarray &A)
+{
+  size_t nd = ndim(pybind11_shape(A));
+
+  std::vector<size_t> items = Private::items(pybind11_shape(A), 2, nd);
+
+  pyarray val = pybind11_empty(items, 1, nd);
+  pyarray vec = pybind11_empty(items, 2, nd);
+
+  const double *a = A.data();
+  double       *w = val.mutable_data();
+  double       *v = vec.mutable_data();
+  size_t        n = size(items);
+
+  {
+    py::gil_scoped_release release;
+
+    eigs(a, v, w, n, nd);
+  }
+
+  return py::make_tuple(val, vec);
+}
+
+} // namespace ...
+
+// =================================================================================================
+// add the functions to a Python module
+// =================================================================================================
+
+inline
+void bind(py::module &m)
+{
+  using namespace Private;
+
+  m.def("ddot44", [](const pyarray &A, const pyarray &B) {
+    return pybind11_binary(A, B, 4, 4, 4, &ddot44<double>); },
+    "Double tensor contraction: C_ijmn = A_ijkl * B_lkmn, of shape [..., nd, nd, nd, nd]",
+    py::arg("A"), py::arg("B"));
+
+  m.def("ddot42", [](const pyarray &A, const pyarray &B) {
+    return pybind11_binary(A, B, 4, 2, 2, &ddot42<double>); },
+    "Double tensor contraction: C_ij = A_ijkl * B_lk, of shape [..., nd, nd]",
+    py::arg("A"), py::arg("B"));
+
+  m.def("ddot24", [](const pyarray &A, const pyarray &B) {
+    return pybind11_binary(A, B, 2, 4, 2, &ddot24<double>); },
+    "Double tensor contraction: C_kl = A_ij * B_jikl, of shape [..., nd, nd]",
+    py::arg("A"), py::arg("B"));
+
+  m.def("ddot22", [](const pyarray &A, const pyarray &B) {
+    return pybind11_binary(A, B, 2, 2, 0, &ddot22<double>); },
+    "Double tensor contraction: C = A_ij * B_ji, of shape [...]",
+    py::arg("A"), py::arg("B"));
+
+  m.def("dot22", [](const pyarray &A, const pyarray &B) {
+    return pybind11_binary(A, B, 2, 2, 2, &dot22<double>); },
+    "Dot product: C_ik = A_ij * B_jk, of shape [..., nd, nd]",
+    py::arg("A"), py::arg("B"));
+
+  m.def("dot21", [](const pyarray &A, const pyarray &B) {
+    return pybind11_binary(A, B, 2, 1, 1, &dot21<double>); },
+    "Dot product: C_i = A_ij * B_j, of shape [..., nd]",
+    py::arg("A"), py::arg("B"));
+
+  m.def("dot12", [](const pyarray &A, const pyarray &B) {
+    return pybind11_binary(A, B, 1, 2, 1, &dot12<double>); },
+    "Dot product: C_j = A_i * B_ij, of shape [..., nd]",
+    py::arg("A"), py::arg("B"));
+
+  m.def("dot11", [](const pyarray &A, const pyarray &B) {
+    return pybind11_binary(A, B, 1, 1, 0, &dot11<double>); },
+    "Dot product: C = A_i * B_i, of shape [...]",
+    py::arg("A"), py::arg("B"));
+
+  m.def("dyadic22", [](const pyarray &A, const pyarray &B) {
+    return pybind11_binary(A, B, 2, 2, 4, &dyadic22<double>); },
+    "Dyadic product: C_ijkl = A_ij * B_kl, of shape [..., nd, nd, nd, nd]",
+    py::arg("A"), py::arg("B"));
+
+  m.def("dyadic11", [](const pyarray &A, const pyarray &B) {
+    return pybind11_binary(A, B, 1, 1, 2, &dyadic11<double>); },
+    "Dyadic product: C_ij = A_i * B_j, of shape [..., nd, nd]",
+    py::arg("A"), py::arg("B"));
+
+  m.def("inv", [](const pyarray &A) {
+    return pybind11_unary(A, 2, &inv<double>); },
+    "Inverse of second-order tensors, of shape [..., nd, nd]",
+    py::arg("A"));
+
+  m.def("det", [](const pyarray &A) {
+    return pybind11_unary(A, 0, &det<double>); },
+    "Determinant of second-order tensors, of shape [...]",
+    py::arg("A"));
+
+  m.def("trace", [](const pyarray &A) {
+    return pybind11_unary(A, 0, &trace<double>); },
+    "Trace of second-order tensors, of shape [...]",
+    py::arg("A"));
+
+  m.def("deviator", [](const pyarray &A) {
+    return pybind11_unary(A, 2, &deviator<double>); },
+    "Deviator of second-order tensors, of shape [..., nd, nd]",
+    py::arg("A"));
+
+  m.def("eigs", [](const pyarray &A) {
+    return pybind11_eigs(A); },
+    "Eigen-decomposition of the symmetric part of second-order tensors. Returns the eigenvalues in "
+    "ascending order [..., nd] and the eigenvectors as columns [..., nd, nd]",
+    py::arg("A"));
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
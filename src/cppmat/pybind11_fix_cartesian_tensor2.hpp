@@ -31,29 +31,13 @@ public:
 
   bool load(py::handle src, bool convert)
   {
-    // - basic pybind11 check
-    if ( !convert && !py::array_t<X>::check_(src) ) return false;
+    // - compile-time shape
+    static const size_t shape[] = {ND,ND};
 
-    // - storage requirements : contiguous and row-major storage from NumPy
-    auto buf = py::array_t<X, py::array::c_style | py::array::forcecast>::ensure(src);
-    // - check
-    if ( !buf ) return false;
-
-    // - rank of the input array (number of indices)
-    auto rank = buf.ndim();
-    // - check
-    if ( rank != 2 ) return false;
-
-    // - check shape in each direction
-    for ( ssize_t i = 0 ; i < rank ; ++i )
-      if ( static_cast<size_t>(buf.shape()[i]) != ND )
-        return false;
-
-    // - all checks passed : create the proper C++ variable
-    value = cppmat::tiny::cartesian::tensor2<X,ND>::Copy(buf.data(), buf.data()+buf.size());
-
-    // - signal successful variable creation
-    return true;
+    // - check the rank and shape, copy directly from the (NumPy) buffer to the fixed storage
+    return cppmat::Private::pybind11_load<X>(src, convert, 2, shape, [this](const X *data) {
+      std::memcpy(value.data(), data, Arr::Size()*sizeof(X));
+    });
   }
 
   // C++ -> Python
@@ -63,11 +47,11 @@ public:
     const cppmat::tiny::cartesian::tensor2<X,ND>& src, py::return_value_policy policy, py::handle parent
   )
   {
-    // - create Python variable (all variables are copied)
-    py::array a(std::move(src.shape()), std::move(src.strides(true)), src.data());
+    // - compile-time shape
+    static const py::ssize_t shape[] = {ND,ND};
 
-    // - release variable to Python
-    return a.release();
+    // - create Python variable (all variables are copied)
+    return cppmat::Private::pybind11_cast(src.data(), 2, shape);
   }
 };
 
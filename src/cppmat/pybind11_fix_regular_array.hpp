@@ -31,30 +31,13 @@ public:
 
   bool load(py::handle src, bool convert)
   {
-    // - basic pybind11 check
-    if ( !convert && !py::array_t<X>::check_(src) ) return false;
-
-    // - storage requirements : contiguous and row-major storage from NumPy
-    auto buf = py::array_t<X, py::array::c_style | py::array::forcecast>::ensure(src);
-    // - check
-    if ( !buf ) return false;
-
-    // - check rank of the input array (number of indices)
-    if ( static_cast<size_t>(buf.ndim()) != RANK ) return false;
-
-    // - check shape in each direction
-    if ( static_cast<size_t>(buf.shape()[0]) != I and RANK > 0 ) return false;
-    if ( static_cast<size_t>(buf.shape()[1]) != J and RANK > 1 ) return false;
-    if ( static_cast<size_t>(buf.shape()[2]) != K and RANK > 2 ) return false;
-    if ( static_cast<size_t>(buf.shape()[3]) != L and RANK > 3 ) return false;
-    if ( static_cast<size_t>(buf.shape()[4]) != M and RANK > 4 ) return false;
-    if ( static_cast<size_t>(buf.shape()[5]) != N and RANK > 5 ) return false;
-
-    // - all checks passed : create the proper C++ variable
-    value = cppmat::tiny::array<X,RANK,I,J,K,L,M,N>::Copy(buf.data(), buf.data()+buf.size());
-
-    // - signal successful variable creation
-    return true;
+    // - compile-time shape
+    static const size_t shape[] = {I,J,K,L,M,N};
+
+    // - check the rank and shape, copy directly from the (NumPy) buffer to the fixed storage
+    return cppmat::Private::pybind11_load<X>(src, convert, RANK, shape, [this](const X *data) {
+      std::memcpy(value.data(), data, Arr::Size()*sizeof(X));
+    });
   }
 
   // C++ -> Python
@@ -64,11 +47,11 @@ public:
     const cppmat::tiny::array<X,RANK,I,J,K,L,M,N>& src, py::return_value_policy policy, py::handle parent
   )
   {
-    // - create Python variable (all variables are copied)
-    py::array a(std::move(src.shape()), std::move(src.strides(true)), src.data());
+    // - compile-time shape
+    static const py::ssize_t shape[] = {I,J,K,L,M,N};
 
-    // - release variable to Python
-    return a.release();
+    // - create Python variable (all variables are copied)
+    return cppmat::Private::pybind11_cast(src.data(), RANK, shape);
   }
 };
 
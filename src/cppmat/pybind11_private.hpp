@@ -0,0 +1,183 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_PRIVATE_PYBIND11_HPP
+#define CPPMAT_PRIVATE_PYBIND11_HPP
+
+#include "pybind11.h"
+
+#include <cstring>
+
+namespace py = pybind11;
+
+namespace cppmat {
+namespace Private {
+
+// =================================================================================================
+// support functions for the type casters
+// =================================================================================================
+
+// size (in bytes) from which copies are made without holding the GIL, distributed over threads
+#ifndef CPPMAT_PYBIND11_BULK
+#define CPPMAT_PYBIND11_BULK static_cast<size_t>(1048576)
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
+// run "f()" without holding the GIL if it processes at least CPPMAT_PYBIND11_BULK bytes
+template<class F>
+inline
+void pybind11_nogil(size_t bytes, F f)
+{
+  if ( bytes < CPPMAT_PYBIND11_BULK )
+  {
+    f();
+    return;
+  }
+
+  py::gil_scoped_release release;
+
+  f();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// copy "n" entries; large buffers are copied without the GIL, in chunks distributed over threads
+template<typename X>
+inline
+void pybind11_copy(const X *src, X *dst, size_t n)
+{
+  pybind11_nogil(n*sizeof(X), [&]()
+  {
+    const size_t chunk  = std::max(CPPMAT_PYBIND11_BULK/sizeof(X), static_cast<size_t>(1));
+    const size_t nchunk = ( n + chunk - 1 ) / chunk;
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(static) if ( nchunk > 1 )
+    #endif
+    for ( size_t c = 0 ; c < nchunk ; ++c )
+    {
+      size_t i = c * chunk;
+      size_t m = std::min(chunk, n-i);
+
+      std::memcpy(dst+i, src+i, m*sizeof(X));
+    }
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// NumPy-array with contiguous, row-major, storage of type "X" (a null-object if not possible)
+// - NumPy-array of the correct type and storage : referenced (no conversion, no copy)
+// - any other input                             : converted by NumPy (if allowed)
+template<typename X>
+inline
+py::object pybind11_buffer(py::handle src, bool convert)
+{
+  // - fast path : no conversion needed
+  if ( py::array_t<X, py::array::c_style>::check_(src) )
+    return py::reinterpret_borrow<py::object>(src);
+
+  // - basic pybind11 check
+  if ( !convert && !py::array_t<X>::check_(src) ) return py::object();
+
+  // - storage requirements : contiguous and row-major storage from NumPy
+  return py::array_t<X, py::array::c_style | py::array::forcecast>::ensure(src);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// shape of a NumPy-array
+inline
+std::vector<size_t> pybind11_shape(const py::array &buf)
+{
+  std::vector<size_t> shape(static_cast<size_t>(buf.ndim()));
+
+  for ( size_t i = 0 ; i < shape.size() ; ++i )
+    shape[i] = static_cast<size_t>(buf.shape(i));
+
+  return shape;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// check the rank and shape of a NumPy-array against a (compile-time) shape
+inline
+bool pybind11_check(const py::array &buf, size_t rank, const size_t *shape)
+{
+  if ( static_cast<size_t>(buf.ndim()) != rank ) return false;
+
+  for ( size_t i = 0 ; i < rank ; ++i )
+    if ( static_cast<size_t>(buf.shape(i)) != shape[i] )
+      return false;
+
+  return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// Python -> C++: check the shape and pass a pointer to contiguous, row-major, data to "copy"
+template<typename X, class F>
+inline
+bool pybind11_load(py::handle src, bool convert, size_t rank, const size_t *shape, F copy)
+{
+  py::object obj = pybind11_buffer<X>(src, convert);
+
+  if ( !obj ) return false;
+
+  auto buf = py::reinterpret_borrow<py::array>(obj);
+
+  if ( !pybind11_check(buf, rank, shape) ) return false;
+
+  copy(static_cast<const X*>(buf.data()));
+
+  return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// C++ -> Python: allocate a (C-contiguous) NumPy-array of a given shape and copy the data to it
+// (with the GIL for the allocation, without the GIL for the copy of a large buffer)
+template<typename X>
+inline
+py::handle pybind11_cast(const X *data, py::array::ShapeContainer shape)
+{
+  py::array_t<X, py::array::c_style> out(std::move(shape));
+
+  pybind11_copy(data, out.mutable_data(), static_cast<size_t>(out.size()));
+
+  return out.release();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// C++ -> Python: compile-time shape, read directly from the static array of the caster (no
+// intermediate "shape_t"). Note that pybind11 stores the shape and the strides of any new array in
+// its own "std::vector"; avoiding that would take the NumPy C-API.
+template<typename X>
+inline
+py::handle pybind11_cast(const X *data, size_t rank, const py::ssize_t *shape)
+{
+  return pybind11_cast(data, py::array::ShapeContainer(shape, shape+rank));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// C++ -> Python: shape known at runtime
+template<typename X>
+inline
+py::handle pybind11_cast(const X *data, const cppmat::shape_t &shape)
+{
+  return pybind11_cast(data, py::array::ShapeContainer(shape.begin(), shape.end()));
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
@@ -29,13 +29,13 @@ public:
 
   bool load(py::handle src, bool convert)
   {
-    // - basic pybind11 check
-    if ( !convert && !py::array_t<X>::check_(src) ) return false;
-
     // - storage requirements : contiguous and row-major storage from NumPy
-    auto buf = py::array_t<X, py::array::c_style | py::array::forcecast>::ensure(src);
+    //   (a NumPy-array of the correct type and storage is used directly, without conversion)
+    py::object obj = cppmat::Private::pybind11_buffer<X>(src, convert);
     // - check
-    if ( !buf ) return false;
+    if ( !obj ) return false;
+
+    auto buf = py::reinterpret_borrow<py::array_t<X, py::array::c_style>>(obj);
 
     // - rank of the input array (number of indices)
     auto rank = buf.ndim();
@@ -49,8 +49,9 @@ public:
       if ( static_cast<size_t>(buf.shape()[i]) != nd )
         return false;
 
-    // - all checks passed : create the proper C++ variable
-    value = cppmat::cartesian::tensor2<X>::Copy(nd, buf.data(), buf.data()+buf.size());
+    // - all checks passed : create the proper C++ variable (large buffers copied without the GIL)
+    value.resize(nd);
+    cppmat::Private::pybind11_copy(buf.data(), value.data(), value.size());
 
     // - signal successful variable creation
     return true;
@@ -63,11 +64,8 @@ public:
     const cppmat::cartesian::tensor2<X>& src, py::return_value_policy policy, py::handle parent
   )
   {
-    // - create Python variable (all variables are copied)
-    py::array a(std::move(src.shape()), std::move(src.strides(true)), src.data());
-
-    // - release variable to Python
-    return a.release();
+    // - create Python variable (all variables are copied, large buffers without the GIL)
+    return cppmat::Private::pybind11_cast(src.data(), src.shape());
   }
 };
 
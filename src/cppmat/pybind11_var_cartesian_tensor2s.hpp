@@ -29,13 +29,13 @@ public:
 
   bool load(py::handle src, bool convert)
   {
-    // - basic pybind11 check
-    if ( !convert && !py::array_t<X>::check_(src) ) return false;
-
     // - storage requirements : contiguous and row-major storage from NumPy
-    auto buf = py::array_t<X, py::array::c_style | py::array::forcecast>::ensure(src);
+    //   (a NumPy-array of the correct type and storage is used directly, without conversion)
+    py::object obj = cppmat::Private::pybind11_buffer<X>(src, convert);
     // - check
-    if ( !buf ) return false;
+    if ( !obj ) return false;
+
+    auto buf = py::reinterpret_borrow<py::array_t<X, py::array::c_style>>(obj);
 
     // - rank of the input array (number of indices)
     auto rank = buf.ndim();
@@ -49,8 +49,13 @@ public:
       if ( static_cast<size_t>(buf.shape()[i]) != nd )
         return false;
 
-    // - all checks passed : create the proper C++ variable
-    value = cppmat::cartesian::tensor2s<X>::CopyDense(nd, buf.data(), buf.data()+buf.size());
+    // - all checks passed : create the proper C++ variable (large buffers copied without the GIL)
+    const X *data = buf.data();
+    size_t   size = static_cast<size_t>(buf.size());
+
+    cppmat::Private::pybind11_nogil(size*sizeof(X), [&]() {
+      value = cppmat::cartesian::tensor2s<X>::CopyDense(nd, data, data+size);
+    });
 
     // - signal successful variable creation
     return true;
@@ -66,11 +71,8 @@ public:
     // - convert to dense tensor
     cppmat::cartesian::tensor2<X> tmp = src;
 
-    // - create Python variable (all variables are copied)
-    py::array a(std::move(tmp.shape()), std::move(tmp.strides(true)), tmp.data());
-
-    // - release variable to Python
-    return a.release();
+    // - create Python variable (all variables are copied, large buffers without the GIL)
+    return cppmat::Private::pybind11_cast(tmp.data(), tmp.shape());
   }
 };
 
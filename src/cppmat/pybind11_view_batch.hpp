@@ -0,0 +1,206 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_VIEW_BATCH_PYBIND11_HPP
+#define CPPMAT_VIEW_BATCH_PYBIND11_HPP
+
+#include "pybind11.h"
+
+namespace py = pybind11;
+
+namespace cppmat {
+namespace view {
+
+// =================================================================================================
+// cppmat::view::batch : a NumPy-array of shape [N, shape of "T"] (e.g. [N,3,3]) read as a sequence
+// of "N" views "T" (e.g. cppmat::view::cartesian::tensor2<double,3>), without copying the data
+// =================================================================================================
+
+template<class T>
+class batch
+{
+public:
+
+  // scalar type
+  typedef typename std::decay<decltype(std::declval<const T&>()[0])>::type value_type;
+
+private:
+
+  py::array_t<value_type, py::array::c_style> mArray; // reference to the NumPy-array (kept alive)
+  size_t                                      mSize;  // number of items "N"
+
+public:
+
+  // constructor: empty batch
+  batch();
+
+  // constructor: map a NumPy-array (the rank and the shape of each item are checked)
+  batch(const py::array_t<value_type, py::array::c_style> &A);
+
+  // check if a NumPy-array can be mapped
+  static bool check(const py::array &A);
+
+  // allocate a NumPy-array of shape [n, shape of "T"] (e.g. to store the output)
+  static py::array_t<value_type, py::array::c_style> Empty(size_t n);
+
+  // number of items "N"
+  size_t size() const;
+
+  // view of item "i" (maps the NumPy buffer)
+  T operator[](size_t i) const;
+
+  // the underlying NumPy-array
+  const py::array_t<value_type, py::array::c_style>& array() const;
+
+};
+
+// =================================================================================================
+// implementation
+// =================================================================================================
+
+template<class T>
+inline
+batch<T>::batch() : mSize(0)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+batch<T>::batch(const py::array_t<value_type, py::array::c_style> &A) : mArray(A)
+{
+  if ( !check(A) )
+    throw std::runtime_error("cppmat::view::batch: shape mismatch");
+
+  mSize = static_cast<size_t>(A.shape(0));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+bool batch<T>::check(const py::array &A)
+{
+  T item;
+
+  if ( static_cast<size_t>(A.ndim()) != item.rank()+1 ) return false;
+
+  for ( size_t i = 0 ; i < item.rank() ; ++i )
+    if ( static_cast<size_t>(A.shape(i+1)) != item.shape(i) )
+      return false;
+
+  return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+py::array_t<typename batch<T>::value_type, py::array::c_style> batch<T>::Empty(size_t n)
+{
+  T item;
+
+  std::vector<size_t> shape = item.shape();
+
+  shape.insert(shape.begin(), n);
+
+  return py::array_t<value_type, py::array::c_style>(shape);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+size_t batch<T>::size() const
+{
+  return mSize;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+T batch<T>::operator[](size_t i) const
+{
+  assert( i < mSize );
+
+  // the data pointer is read from the (shared) NumPy-array, such that copies are always valid
+  return T(mArray.data() + i * T::Size());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+const py::array_t<typename batch<T>::value_type, py::array::c_style>& batch<T>::array() const
+{
+  return mArray;
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// =================================================================================================
+// type caster: NumPy-array -> cppmat::view::batch
+// =================================================================================================
+
+namespace pybind11 {
+namespace detail {
+
+template<class T> struct type_caster<cppmat::view::batch<T>>
+{
+public:
+
+  using Arr = cppmat::view::batch<T>;
+  using X   = typename Arr::value_type;
+
+  PYBIND11_TYPE_CASTER(Arr, _("cppmat::view::batch<T>"));
+
+  // Python -> C++
+  // -------------
+
+  bool load(py::handle src, bool convert)
+  {
+    // - basic pybind11 check
+    if ( !convert && !py::array_t<X, py::array::c_style>::check_(src) ) return false;
+
+    // - storage requirements : contiguous and row-major storage from NumPy
+    //   (a NumPy-array of the correct type and storage is referenced, not copied)
+    auto buf = py::array_t<X, py::array::c_style | py::array::forcecast>::ensure(src);
+    // - check
+    if ( !buf ) return false;
+
+    // - check rank and shape
+    if ( !Arr::check(buf) ) return false;
+
+    // - all checks passed : map the NumPy-array
+    value = Arr(py::reinterpret_borrow<py::array_t<X, py::array::c_style>>(buf));
+
+    // - signal successful variable creation
+    return true;
+  }
+
+  // C++ -> Python
+  // -------------
+
+  static py::handle cast(
+    const cppmat::view::batch<T>& src, py::return_value_policy policy, py::handle parent
+  )
+  {
+    // - return the NumPy-array that is mapped
+    return src.array().inc_ref();
+  }
+};
+
+// =================================================================================================
+
+}} // namespace pybind11::detail
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,82 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_QUANTILE_H
+#define CPPMAT_QUANTILE_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+
+// =================================================================================================
+// cppmat::streaming_quantile : approximate quantile of a stream of values, using constant memory
+// (the P-square algorithm of Jain and Chlamtac). Five markers are kept: the minimum, the maximum,
+// the estimate of the quantile, and estimates half-way between; they are adjusted (by a parabolic
+// prediction) as values are added. Up to five values the quantile is exact.
+// =================================================================================================
+
+class streaming_quantile
+{
+private:
+
+  double mP=.5;      // requested quantile, in [0,1]
+  size_t mN=0;       // number of values
+  double mQ[5];      // marker heights
+  double mPos[5];    // marker positions (zero-based)
+  double mWant[5];   // desired marker positions
+  double mDWant[5];  // increment of the desired marker positions for each value
+
+  // parabolic and linear prediction of the height of marker "i", when moved by "d" (-1 or +1)
+  double parabolic(size_t i, double d) const;
+  double linear   (size_t i, double d) const;
+
+public:
+
+  // constructor: quantile "p" in [0,1] (e.g. 0.5 for the median)
+  streaming_quantile(double p=.5);
+
+  // add a value
+  void push(double x);
+
+  // add a range of values
+  template<class It> void push(It first, It last);
+
+  // number of values
+  size_t size() const;
+
+  // current estimate of the quantile
+  double value() const;
+
+};
+
+// =================================================================================================
+
+namespace Private {
+
+// quantile "q" of the "n" values in "data", with linear interpolation between the closest values;
+// "data" is partially reordered (O(n) selection)
+template<typename X> double quantile_inplace(X *data, size_t n, double q);
+
+// quantile "q" of the array "data" of a certain "shape" along (sorted) "axes": the output has the
+// shape of the input without these axes (interpolated values: "double", also for an integer "X")
+template<typename X>
+cppmat::array<double> quantile_along(
+  const X *data, const cppmat::shape_t &shape, const std::vector<int> &axes, double q);
+
+} // namespace ...
+
+// =================================================================================================
+
+} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
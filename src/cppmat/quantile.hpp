@@ -0,0 +1,271 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_QUANTILE_HPP
+#define CPPMAT_QUANTILE_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+
+// =================================================================================================
+// constructor
+// =================================================================================================
+
+inline
+streaming_quantile::streaming_quantile(double p) : mP(p)
+{
+  assert( p >= 0. and p <= 1. );
+
+  mDWant[0] = 0.;
+  mDWant[1] = p / 2.;
+  mDWant[2] = p;
+  mDWant[3] = ( 1. + p ) / 2.;
+  mDWant[4] = 1.;
+}
+
+// =================================================================================================
+// prediction of the height of a marker
+// =================================================================================================
+
+inline
+double streaming_quantile::parabolic(size_t i, double d) const
+{
+  return mQ[i] + d / ( mPos[i+1] - mPos[i-1] ) * (
+    ( mPos[i] - mPos[i-1] + d ) * ( mQ[i+1] - mQ[i] ) / ( mPos[i+1] - mPos[i] ) +
+    ( mPos[i+1] - mPos[i] - d ) * ( mQ[i] - mQ[i-1] ) / ( mPos[i] - mPos[i-1] )
+  );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+double streaming_quantile::linear(size_t i, double d) const
+{
+  size_t j = d > 0. ? i+1 : i-1;
+
+  return mQ[i] + d * ( mQ[j] - mQ[i] ) / ( mPos[j] - mPos[i] );
+}
+
+// =================================================================================================
+// add values
+// =================================================================================================
+
+inline
+void streaming_quantile::push(double x)
+{
+  // the first five values initialize the markers
+  if ( mN < 5 )
+  {
+    mQ[mN] = x;
+
+    ++mN;
+
+    if ( mN == 5 )
+    {
+      std::sort(std::begin(mQ), std::end(mQ));
+
+      for ( size_t i = 0 ; i < 5 ; ++i )
+        mPos[i] = static_cast<double>(i);
+
+      mWant[0] = 0.;
+      mWant[1] = 2. * mP;
+      mWant[2] = 4. * mP;
+      mWant[3] = 2. + 2. * mP;
+      mWant[4] = 4.;
+    }
+
+    return;
+  }
+
+  // find the cell "k" such that "mQ[k] <= x < mQ[k+1]" (extending the extremes if needed)
+  size_t k = 0;
+
+  if      ( x <  mQ[0] ) { mQ[0] = x; k = 0; }
+  else if ( x >= mQ[4] ) { mQ[4] = x; k = 3; }
+  else                   { while ( x >= mQ[k+1] ) ++k; }
+
+  ++mN;
+
+  // shift the positions of the markers above the cell, and the desired positions of all markers
+  for ( size_t i = k+1 ; i < 5 ; ++i )
+    mPos[i] += 1.;
+
+  for ( size_t i = 0 ; i < 5 ; ++i )
+    mWant[i] += mDWant[i];
+
+  // move the middle markers by one position if they are off from their desired position
+  for ( size_t i = 1 ; i < 4 ; ++i )
+  {
+    double d = mWant[i] - mPos[i];
+
+    if ( ( d >= 1. and mPos[i+1] - mPos[i] > 1. ) or ( d <= -1. and mPos[i-1] - mPos[i] < -1. ) )
+    {
+      double s = d >= 0. ? 1. : -1.;
+      double q = parabolic(i, s);
+
+      if ( mQ[i-1] < q and q < mQ[i+1] ) mQ[i] = q;
+      else                               mQ[i] = linear(i, s);
+
+      mPos[i] += s;
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class It>
+inline
+void streaming_quantile::push(It first, It last)
+{
+  for ( auto it = first ; it != last ; ++it )
+    push(static_cast<double>(*it));
+}
+
+// =================================================================================================
+// get
+// =================================================================================================
+
+inline
+size_t streaming_quantile::size() const
+{
+  return mN;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+double streaming_quantile::value() const
+{
+  if ( mN == 0 ) return std::numeric_limits<double>::quiet_NaN();
+
+  if ( mN <= 5 ) {
+    double q[5];
+    std::copy(std::begin(mQ), std::begin(mQ)+mN, std::begin(q));
+    return Private::quantile_inplace(q, mN, mP);
+  }
+
+  return mQ[2];
+}
+
+// =================================================================================================
+// support functions
+// =================================================================================================
+
+namespace Private {
+
+// the value at the floor of the (fractional) position "q * (n-1)" is selected, after which all
+// larger values are behind it: the next value is their minimum
+template<typename X>
+inline
+double quantile_inplace(X *data, size_t n, double q)
+{
+  assert( n > 0 );
+  assert( q >= 0. and q <= 1. );
+
+  double h = q * static_cast<double>(n-1);
+  size_t k = std::min(static_cast<size_t>(std::floor(h)), n-1);
+
+  std::nth_element(data, data+k, data+n);
+
+  double lo = static_cast<double>(data[k]);
+
+  if ( k+1 >= n ) return lo;
+
+  double hi = static_cast<double>(*std::min_element(data+k+1, data+n));
+
+  return lo + ( h - static_cast<double>(k) ) * ( hi - lo );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// the entries of each lane are gathered in a scratch buffer (one per thread), using the offsets of
+// the first entry of each lane and of the entries within a lane (both computed once)
+template<typename X>
+inline
+cppmat::array<double> quantile_along(
+  const X *data, const cppmat::shape_t &shape, const std::vector<int> &axes, double q)
+{
+  size_t rank = shape.size();
+
+  // flag the reduced axes
+  std::vector<int> reduce(rank, 0);
+
+  for ( auto &i : axes ) {
+    assert( i >= 0 and static_cast<size_t>(i) < rank );
+    reduce[i] = 1;
+  }
+
+  // strides of the input
+  cppmat::shape_t strides(rank, 1);
+
+  for ( size_t i = rank ; i-- > 1 ; )
+    strides[i-1] = strides[i] * shape[i];
+
+  // shape and strides of the lanes (the remaining axes) and within a lane (the reduced axes)
+  cppmat::shape_t lshape, lstrides, rshape, rstrides;
+
+  for ( size_t i = 0 ; i < rank ; ++i ) {
+    if ( reduce[i] ) { rshape.push_back(shape[i]); rstrides.push_back(strides[i]); }
+    else             { lshape.push_back(shape[i]); lstrides.push_back(strides[i]); }
+  }
+
+  // allocate output
+  cppmat::array<double> out(lshape);
+
+  // offset of the first entry of each lane
+  std::vector<size_t> start;
+
+  for ( cppmat::multi_index<1> i(lshape, {lstrides}) ; not i.end() ; ++i )
+    start.push_back(i.offset());
+
+  // offset of each entry of a lane, relative to its first entry
+  std::vector<size_t> rel;
+
+  for ( cppmat::multi_index<1> i(rshape, {rstrides}) ; not i.end() ; ++i )
+    rel.push_back(i.offset());
+
+  // number of lanes, number of entries per lane
+  size_t nl = start.size();
+  size_t m  = rel.size();
+
+  #ifdef _OPENMP
+  #pragma omp parallel
+  #endif
+  {
+    std::vector<X> buf(m);
+
+    #ifdef _OPENMP
+    #pragma omp for schedule(static)
+    #endif
+    for ( size_t l = 0 ; l < nl ; ++l )
+    {
+      const X *lane = data + start[l];
+
+      for ( size_t k = 0 ; k < m ; ++k )
+        buf[k] = lane[rel[k]];
+
+      out[l] = quantile_inplace(buf.data(), m, q);
+    }
+  }
+
+  return out;
+}
+
+} // namespace ...
+
+// =================================================================================================
+
+} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
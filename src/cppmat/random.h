@@ -0,0 +1,121 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_RANDOM_H
+#define CPPMAT_RANDOM_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace random {
+
+// =================================================================================================
+// Philox-4x32-10 block function (Salmon et al., 2011): the random output is a pure function of a
+// 128-bit counter and a 64-bit key
+// =================================================================================================
+
+void philox4x32(const uint32_t ctr[4], const uint32_t key[2], uint32_t out[4]);
+
+// =================================================================================================
+// Counter-based random number generator. The sequence is fully determined by (seed, stream): the
+// i-th 64-bit value is computed directly from (seed, stream, i). Consequently:
+// - (re)seeding is free and reproducible,
+// - independent streams are obtained by "split" (e.g. one per thread or per realization),
+// - any part of a stream can be generated independently, which allows a parallel fill with output
+//   that does not depend on the number of threads.
+// Satisfies "UniformRandomBitGenerator", i.e. it can be used with the std:: distributions.
+// =================================================================================================
+
+class Philox
+{
+private:
+
+  uint64_t mSeed=0;     // seed (key)
+  uint64_t mStream=0;   // stream (upper half of the counter)
+  uint64_t mPos=0;      // position in the stream (index of the next 64-bit value)
+  uint64_t mBlock=0;    // index of the cached block
+  uint64_t mBuf[2];     // cached block
+  bool     mCached=false;
+
+public:
+
+  using result_type = uint64_t;
+
+  // constructor
+  Philox(uint64_t seed=0, uint64_t stream=0);
+
+  // reset
+  void seed(uint64_t seed, uint64_t stream=0);
+
+  // independent generator, derived deterministically from (seed, stream, i)
+  Philox split(uint64_t i) const;
+
+  // parameters
+  uint64_t getSeed() const;
+  uint64_t getStream() const;
+  uint64_t position() const;
+
+  // UniformRandomBitGenerator
+  static constexpr uint64_t min() { return 0; }
+  static constexpr uint64_t max() { return ~uint64_t(0); }
+  uint64_t operator()();
+
+  // skip "n" values
+  void discard(uint64_t n);
+
+  // value number "i" of the stream, and the block of values "2*b" and "2*b+1" (no change of state)
+  uint64_t at(uint64_t i) const;
+  void block(uint64_t b, uint64_t out[2]) const;
+
+};
+
+// =================================================================================================
+// library-wide generator: used by "setRandom" and "Random" of all classes. There is one generator
+// per thread, derived from the OpenMP thread number "t" (zero outside parallel regions):
+// "Philox(seed,stream)" for t == 0, and "Philox(seed,stream).split(t)" otherwise. The output of a
+// parallel region is thus reproducible for a fixed number of threads and a static schedule. Other
+// threads (e.g. std::thread) have t == 0: pass them an explicit generator, e.g. "rng.split(i)".
+// =================================================================================================
+
+Philox& generator();
+
+// reset the library-wide generator (of all threads), to be called outside parallel regions
+void seed(uint64_t seed, uint64_t stream=0);
+
+// =================================================================================================
+// fill "n" entries starting at "data" (advances "rng" by "n"); entry "i" depends only on
+// "rng.position()+i" such that the output is independent of the number of (OpenMP) threads
+// =================================================================================================
+
+// uniform distribution on [lower, upper)
+template<typename X> void uniform(X *data, size_t n, double lower, double upper, Philox &rng);
+
+// normal distribution (Box-Muller transform)
+template<typename X> void normal(X *data, size_t n, double mean, double stddev, Philox &rng);
+
+// Weibull distribution: P(x) = 1 - exp(-(x/scale)^shape) (inverse transform)
+template<typename X> void weibull(X *data, size_t n, double shape, double scale, Philox &rng);
+
+// =================================================================================================
+// fill a container (any cppmat class): only the independent entries are set
+// =================================================================================================
+
+template<class C> void uniform(C &A, double lower=0., double upper=1., Philox &rng=generator());
+template<class C> void normal (C &A, double mean =0., double stddev=1., Philox &rng=generator());
+template<class C> void weibull(C &A, double shape=1., double scale =1., Philox &rng=generator());
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -0,0 +1,401 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_RANDOM_HPP
+#define CPPMAT_RANDOM_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace random {
+
+// =================================================================================================
+// Philox-4x32-10
+// =================================================================================================
+
+inline
+void philox4x32(const uint32_t ctr[4], const uint32_t key[2], uint32_t out[4])
+{
+  const uint64_t M0 = 0xD2511F53, M1 = 0xCD9E8D57;
+  const uint32_t W0 = 0x9E3779B9, W1 = 0xBB67AE85;
+
+  uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+  uint32_t k0 = key[0], k1 = key[1];
+
+  for ( size_t r = 0 ; r < 10 ; ++r )
+  {
+    uint64_t p0 = M0 * static_cast<uint64_t>(c0);
+    uint64_t p1 = M1 * static_cast<uint64_t>(c2);
+
+    uint32_t n0 = static_cast<uint32_t>(p1 >> 32) ^ c1 ^ k0;
+    uint32_t n1 = static_cast<uint32_t>(p1);
+    uint32_t n2 = static_cast<uint32_t>(p0 >> 32) ^ c3 ^ k1;
+    uint32_t n3 = static_cast<uint32_t>(p0);
+
+    c0 = n0; c1 = n1; c2 = n2; c3 = n3;
+
+    k0 += W0;
+    k1 += W1;
+  }
+
+  out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+}
+
+// =================================================================================================
+// Philox - constructor / reset
+// =================================================================================================
+
+inline
+Philox::Philox(uint64_t seed, uint64_t stream)
+{
+  this->seed(seed, stream);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void Philox::seed(uint64_t seed, uint64_t stream)
+{
+  mSeed   = seed;
+  mStream = stream;
+  mPos    = 0;
+  mCached = false;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+Philox Philox::split(uint64_t i) const
+{
+  // the new stream is a hash of (stream, i), using the same seed: the 128-bit Philox output is
+  // truncated to 64 bits, such that different "i" give the same stream with negligible probability
+  uint32_t ctr[4] = {
+    static_cast<uint32_t>(i), static_cast<uint32_t>(i >> 32),
+    static_cast<uint32_t>(mStream), static_cast<uint32_t>(mStream >> 32)
+  };
+
+  uint32_t key[2] = { 0x243F6A88, 0x85A308D3 };
+
+  uint32_t out[4];
+
+  philox4x32(ctr, key, out);
+
+  return Philox(mSeed, static_cast<uint64_t>(out[0]) | ( static_cast<uint64_t>(out[1]) << 32 ));
+}
+
+// =================================================================================================
+// Philox - parameters
+// =================================================================================================
+
+inline
+uint64_t Philox::getSeed() const
+{
+  return mSeed;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+uint64_t Philox::getStream() const
+{
+  return mStream;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+uint64_t Philox::position() const
+{
+  return mPos;
+}
+
+// =================================================================================================
+// Philox - generate
+// =================================================================================================
+
+inline
+void Philox::block(uint64_t b, uint64_t out[2]) const
+{
+  uint32_t ctr[4] = {
+    static_cast<uint32_t>(b), static_cast<uint32_t>(b >> 32),
+    static_cast<uint32_t>(mStream), static_cast<uint32_t>(mStream >> 32)
+  };
+
+  uint32_t key[2] = { static_cast<uint32_t>(mSeed), static_cast<uint32_t>(mSeed >> 32) };
+
+  uint32_t tmp[4];
+
+  philox4x32(ctr, key, tmp);
+
+  out[0] = static_cast<uint64_t>(tmp[0]) | ( static_cast<uint64_t>(tmp[1]) << 32 );
+  out[1] = static_cast<uint64_t>(tmp[2]) | ( static_cast<uint64_t>(tmp[3]) << 32 );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+uint64_t Philox::at(uint64_t i) const
+{
+  uint64_t out[2];
+
+  block(i/2, out);
+
+  return out[i%2];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+uint64_t Philox::operator()()
+{
+  uint64_t b = mPos / 2;
+
+  if ( not mCached or mBlock != b ) {
+    block(b, mBuf);
+    mBlock  = b;
+    mCached = true;
+  }
+
+  return mBuf[mPos++ % 2];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void Philox::discard(uint64_t n)
+{
+  mPos += n;
+}
+
+// =================================================================================================
+// library-wide generator
+// =================================================================================================
+
+namespace Private {
+
+// seed of the library-wide generator, "epoch" is incremented by every "seed(...)"
+struct GeneratorState
+{
+  std::mutex            mutex;
+  uint64_t              seed=0;
+  uint64_t              stream=0;
+  std::atomic<uint64_t> epoch{1};
+};
+
+inline
+GeneratorState& generatorState()
+{
+  static GeneratorState state;
+
+  return state;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// number of the calling thread in the (innermost) OpenMP team (zero outside parallel regions)
+inline
+uint64_t threadNumber()
+{
+#ifdef _OPENMP
+  return static_cast<uint64_t>(omp_get_thread_num());
+#else
+  return 0;
+#endif
+}
+
+} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+Philox& generator()
+{
+  static thread_local Philox   rng;
+  static thread_local uint64_t epoch  = 0;
+  static thread_local uint64_t number = 0;
+
+  auto &state = Private::generatorState();
+
+  uint64_t e = state.epoch.load(std::memory_order_acquire);
+  uint64_t t = Private::threadNumber();
+
+  // (re)derive the generator of this thread: after "seed(...)", or for another thread number
+  if ( e != epoch or t != number )
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    Philox base(state.seed, state.stream);
+
+    rng    = ( t == 0 ) ? base : base.split(t);
+    epoch  = e;
+    number = t;
+  }
+
+  return rng;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void seed(uint64_t seed, uint64_t stream)
+{
+  auto &state = Private::generatorState();
+
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  state.seed   = seed;
+  state.stream = stream;
+
+  state.epoch.fetch_add(1, std::memory_order_release);
+}
+
+// =================================================================================================
+// conversion of random bits to a floating-point number on [0,1), using the top bits
+// =================================================================================================
+
+namespace Private {
+
+template<typename X>
+inline
+X unit(uint64_t r)
+{
+  return static_cast<X>( static_cast<double>(r >> 11) / 9007199254740992.0 );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<>
+inline
+float unit<float>(uint64_t r)
+{
+  return static_cast<float>(r >> 40) / 16777216.0f;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// fill "data[i] = func(rng.at(rng.position()+i))", walking the stream in blocks of two values
+template<typename X, class F>
+inline
+void fill(X *data, size_t n, Philox &rng, F func)
+{
+  if ( n == 0 ) return;
+
+  uint64_t pos = rng.position();
+  size_t   i0  = 0;
+
+  // align to a block
+  if ( pos % 2 ) {
+    data[0] = func(rng.at(pos));
+    i0 = 1;
+  }
+
+  size_t   nb = ( n - i0 ) / 2;
+  uint64_t b0 = ( pos + i0 ) / 2;
+
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for ( size_t b = 0 ; b < nb ; ++b )
+  {
+    uint64_t r[2];
+    rng.block(b0+b, r);
+    data[i0+2*b  ] = func(r[0]);
+    data[i0+2*b+1] = func(r[1]);
+  }
+
+  if ( ( n - i0 ) % 2 )
+    data[n-1] = func(rng.at(pos+n-1));
+
+  rng.discard(n);
+}
+
+} // namespace ...
+
+// =================================================================================================
+// fill: raw pointer
+// =================================================================================================
+
+template<typename X>
+inline
+void uniform(X *data, size_t n, double lower, double upper, Philox &rng)
+{
+  X a = static_cast<X>(lower);
+  X d = static_cast<X>(upper-lower);
+
+  Private::fill(data, n, rng, [a,d](uint64_t r) { return a + d * Private::unit<X>(r); });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void normal(X *data, size_t n, double mean, double stddev, Philox &rng)
+{
+  // Box-Muller: the upper 32 bits set the radius, the lower 32 bits the angle
+  const double pi = std::acos(-1.0);
+
+  Private::fill(data, n, rng, [mean,stddev,pi](uint64_t r) {
+    double u = ( static_cast<double>(r >> 32) + 1.0 ) / 4294967296.0;      // (0,1]
+    double v = static_cast<double>(r & 0xFFFFFFFF) / 4294967296.0;         // [0,1)
+    return static_cast<X>( mean + stddev * std::sqrt(-2.0*std::log(u)) * std::cos(2.0*pi*v) );
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void weibull(X *data, size_t n, double shape, double scale, Philox &rng)
+{
+  double k = 1.0 / shape;
+
+  Private::fill(data, n, rng, [k,scale](uint64_t r) {
+    double u = static_cast<double>( ( r >> 11 ) + 1 ) / 9007199254740992.0; // (0,1]
+    return static_cast<X>( scale * std::pow(-std::log(u), k) );
+  });
+}
+
+// =================================================================================================
+// fill: container
+// =================================================================================================
+
+template<class C>
+inline
+void uniform(C &A, double lower, double upper, Philox &rng)
+{
+  uniform(A.data(), A.size(), lower, upper, rng);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class C>
+inline
+void normal(C &A, double mean, double stddev, Philox &rng)
+{
+  normal(A.data(), A.size(), mean, stddev, rng);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class C>
+inline
+void weibull(C &A, double shape, double scale, Philox &rng)
+{
+  weibull(A.data(), A.size(), shape, scale, rng);
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -0,0 +1,101 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_SIMD_H
+#define CPPMAT_SIMD_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+// Runtime dispatch: the "float" and "double" kernels below are compiled for several instruction sets
+// (using function attributes, i.e. without changing the compiler flags). The widest instruction set
+// that is supported by the CPU is selected at runtime (detected once). Define "CPPMAT_NO_DISPATCH"
+// to compile only the baseline version.
+
+#if !defined(CPPMAT_NO_DISPATCH) && ( defined(__GNUC__) || defined(__clang__) ) && \
+    ( defined(__x86_64__) || defined(__i386__) )
+#define CPPMAT_DISPATCH
+#endif
+
+// Number of entries from which the dispatched kernels are used. Shorter arrays (e.g. a tensor) are
+// processed by the inlined generic kernel, without the overhead of the dispatch.
+#ifndef CPPMAT_SIMD_MIN
+#define CPPMAT_SIMD_MIN 64
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace simd {
+
+// =================================================================================================
+// instruction set
+// =================================================================================================
+
+enum class ISA { generic, avx2, avx512 };
+
+// widest instruction set supported by the CPU
+ISA detect();
+
+// instruction set used by the kernels (default: "detect()")
+ISA isa();
+
+// restrict the instruction set used by the kernels (e.g. for testing), limited to "detect()";
+// may be called while other threads use the kernels
+void setISA(ISA level);
+
+// name of the instruction set
+std::string to_string(ISA level);
+
+// =================================================================================================
+// batch kernels: operate on "n" consecutive entries, "c" may alias "a" or "b". The kernels are
+// compiled without contraction to fused multiply-add instructions, such that the result is the
+// same for all instruction sets (bit for bit).
+// =================================================================================================
+
+// c[i] = a[i] + b[i]
+template<typename X> void add(const X *a, const X *b, X *c, size_t n);
+
+// c[i] = a[i] - b[i]
+template<typename X> void sub(const X *a, const X *b, X *c, size_t n);
+
+// c[i] = a[i] * b[i]
+template<typename X> void mul(const X *a, const X *b, X *c, size_t n);
+
+// c[i] = a[i] / b[i]
+template<typename X> void div(const X *a, const X *b, X *c, size_t n);
+
+// c[i] += a[i] * b[i]
+template<typename X> void fmadd(const X *a, const X *b, X *c, size_t n);
+
+// sum of a[i] (using independent partial sums, which changes the order of summation)
+template<typename X> X sum(const X *a, size_t n);
+
+// dispatched versions (if "n >= CPPMAT_SIMD_MIN")
+void   add  (const float  *a, const float  *b, float  *c, size_t n);
+void   add  (const double *a, const double *b, double *c, size_t n);
+void   sub  (const float  *a, const float  *b, float  *c, size_t n);
+void   sub  (const double *a, const double *b, double *c, size_t n);
+void   mul  (const float  *a, const float  *b, float  *c, size_t n);
+void   mul  (const double *a, const double *b, double *c, size_t n);
+void   div  (const float  *a, const float  *b, float  *c, size_t n);
+void   div  (const double *a, const double *b, double *c, size_t n);
+void   fmadd(const float  *a, const float  *b, float  *c, size_t n);
+void   fmadd(const double *a, const double *b, double *c, size_t n);
+float  sum  (const float  *a, size_t n);
+double sum  (const double *a, size_t n);
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
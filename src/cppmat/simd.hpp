@@ -0,0 +1,260 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_SIMD_HPP
+#define CPPMAT_SIMD_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+// The generic kernels are inlined in the instruction set specific versions, such that they are
+// compiled (and vectorized) for that instruction set.
+#ifdef CPPMAT_DISPATCH
+#define CPPMAT_SIMD_INLINE __attribute__((always_inline)) inline
+#else
+#define CPPMAT_SIMD_INLINE inline
+#endif
+
+// No contraction of "a*b+c" to a fused multiply-add: it would only be done in the versions compiled
+// for an instruction set with FMA, and thus change the result depending on the CPU.
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace simd {
+
+// =================================================================================================
+// instruction set
+// =================================================================================================
+
+inline
+ISA detect()
+{
+#ifdef CPPMAT_DISPATCH
+  static const ISA level = []() {
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx512f") and __builtin_cpu_supports("fma") ) return ISA::avx512;
+    if ( __builtin_cpu_supports("avx2"   ) and __builtin_cpu_supports("fma") ) return ISA::avx2;
+    return ISA::generic;
+  }();
+
+  return level;
+#else
+  return ISA::generic;
+#endif
+}
+
+// -------------------------------------------------------------------------------------------------
+
+namespace Private {
+
+inline
+std::atomic<ISA>& isa()
+{
+  static std::atomic<ISA> level(detect());
+
+  return level;
+}
+
+} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+ISA isa()
+{
+  return Private::isa().load(std::memory_order_relaxed);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void setISA(ISA level)
+{
+  Private::isa().store(std::min(level, detect()), std::memory_order_relaxed);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+std::string to_string(ISA level)
+{
+  switch ( level ) {
+    case ISA::avx512: return "avx512";
+    case ISA::avx2  : return "avx2";
+    default         : return "generic";
+  }
+}
+
+// =================================================================================================
+// generic kernels
+// =================================================================================================
+
+template<typename X>
+CPPMAT_SIMD_INLINE
+void add(const X *a, const X *b, X *c, size_t n)
+{
+  for ( size_t i = 0 ; i < n ; ++i )
+    c[i] = a[i] + b[i];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+CPPMAT_SIMD_INLINE
+void sub(const X *a, const X *b, X *c, size_t n)
+{
+  for ( size_t i = 0 ; i < n ; ++i )
+    c[i] = a[i] - b[i];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+CPPMAT_SIMD_INLINE
+void mul(const X *a, const X *b, X *c, size_t n)
+{
+  for ( size_t i = 0 ; i < n ; ++i )
+    c[i] = a[i] * b[i];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+CPPMAT_SIMD_INLINE
+void div(const X *a, const X *b, X *c, size_t n)
+{
+  for ( size_t i = 0 ; i < n ; ++i )
+    c[i] = a[i] / b[i];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+CPPMAT_SIMD_INLINE
+void fmadd(const X *a, const X *b, X *c, size_t n)
+{
+  for ( size_t i = 0 ; i < n ; ++i )
+    c[i] += a[i] * b[i];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+CPPMAT_SIMD_INLINE
+X sum(const X *a, size_t n)
+{
+  // independent partial sums: allows vectorization without reordering by the compiler
+  const size_t m = 16;
+
+  X s[m];
+
+  for ( size_t k = 0 ; k < m ; ++k ) s[k] = static_cast<X>(0);
+
+  size_t i = 0;
+
+  for ( ; i+m <= n ; i += m )
+    for ( size_t k = 0 ; k < m ; ++k )
+      s[k] += a[i+k];
+
+  for ( ; i < n ; ++i )
+    s[0] += a[i];
+
+  X out = static_cast<X>(0);
+
+  for ( size_t k = 0 ; k < m ; ++k ) out += s[k];
+
+  return out;
+}
+
+// =================================================================================================
+// dispatched kernels
+// =================================================================================================
+
+#ifdef CPPMAT_DISPATCH
+
+#define CPPMAT_SIMD_DISPATCH(RET, NAME, X, PARAMS, ARGS)                                           \
+                                                                                                   \
+  namespace Private {                                                                              \
+                                                                                                   \
+  __attribute__((target("avx512f,avx2,fma")))                                                      \
+  inline RET NAME##_avx512 PARAMS { return cppmat::simd::NAME<X> ARGS; }                           \
+                                                                                                   \
+  __attribute__((target("avx2,fma")))                                                              \
+  inline RET NAME##_avx2 PARAMS { return cppmat::simd::NAME<X> ARGS; }                             \
+                                                                                                   \
+  __attribute__((noinline))                                                                        \
+  inline RET NAME##_dispatch PARAMS                                                                \
+  {                                                                                                \
+    switch ( isa() ) {                                                                             \
+      case ISA::avx512: return Private::NAME##_avx512 ARGS;                                        \
+      case ISA::avx2  : return Private::NAME##_avx2   ARGS;                                        \
+      default         : return cppmat::simd::NAME<X>  ARGS;                                        \
+    }                                                                                              \
+  }                                                                                                \
+                                                                                                   \
+  }                                                                                                \
+                                                                                                   \
+  inline RET NAME PARAMS                                                                           \
+  {                                                                                                \
+    if ( n < CPPMAT_SIMD_MIN ) return cppmat::simd::NAME<X> ARGS;                                  \
+                                                                                                   \
+    return Private::NAME##_dispatch ARGS;                                                          \
+  }
+
+#else
+
+#define CPPMAT_SIMD_DISPATCH(RET, NAME, X, PARAMS, ARGS)                                           \
+                                                                                                   \
+  inline RET NAME PARAMS { return cppmat::simd::NAME<X> ARGS; }
+
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
+CPPMAT_SIMD_DISPATCH(void, add, float , (const float  *a, const float  *b, float  *c, size_t n), (a,b,c,n))
+CPPMAT_SIMD_DISPATCH(void, add, double, (const double *a, const double *b, double *c, size_t n), (a,b,c,n))
+
+CPPMAT_SIMD_DISPATCH(void, sub, float , (const float  *a, const float  *b, float  *c, size_t n), (a,b,c,n))
+CPPMAT_SIMD_DISPATCH(void, sub, double, (const double *a, const double *b, double *c, size_t n), (a,b,c,n))
+
+CPPMAT_SIMD_DISPATCH(void, mul, float , (const float  *a, const float  *b, float  *c, size_t n), (a,b,c,n))
+CPPMAT_SIMD_DISPATCH(void, mul, double, (const double *a, const double *b, double *c, size_t n), (a,b,c,n))
+
+CPPMAT_SIMD_DISPATCH(void, div, float , (const float  *a, const float  *b, float  *c, size_t n), (a,b,c,n))
+CPPMAT_SIMD_DISPATCH(void, div, double, (const double *a, const double *b, double *c, size_t n), (a,b,c,n))
+
+CPPMAT_SIMD_DISPATCH(void, fmadd, float , (const float  *a, const float  *b, float  *c, size_t n), (a,b,c,n))
+CPPMAT_SIMD_DISPATCH(void, fmadd, double, (const double *a, const double *b, double *c, size_t n), (a,b,c,n))
+
+CPPMAT_SIMD_DISPATCH(float , sum, float , (const float  *a, size_t n), (a,n))
+CPPMAT_SIMD_DISPATCH(double, sum, double, (const double *a, size_t n), (a,n))
+
+// -------------------------------------------------------------------------------------------------
+
+#undef CPPMAT_SIMD_DISPATCH
+
+#if !defined(__clang__) && defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -0,0 +1,162 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_SMALL_VECTOR_H
+#define CPPMAT_SMALL_VECTOR_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+
+// =================================================================================================
+// cppmat::small_vector : vector that stores up to "N" entries inline (without allocation), e.g. for
+// the shape and the strides of an array, or for the data of a small array. Longer vectors are stored
+// on the heap. The inline storage is uninitialised: only the entries in use are constructed.
+// =================================================================================================
+
+template<typename T, size_t N>
+class small_vector
+{
+  static_assert(N > 0, "small_vector: the inline storage must have at least one entry");
+
+private:
+
+  typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type Storage;
+
+  size_t         mSize=0;    // number of entries
+  Storage        mInline[N]; // inline storage (entries constructed if "mSize <= N")
+  std::vector<T> mHeap;      // heap storage (used if "mSize > N")
+  T*             mPtr;       // pointer to the storage in use
+
+  // pointer to the inline storage
+  T*       inlineData();
+  const T* inlineData() const;
+
+  // point "mPtr" to the storage in use
+  void setPointer();
+
+  // remove the last entries, such that "n <= size()" remain
+  void shrink(size_t n);
+
+public:
+
+  // constructor: empty
+  small_vector();
+
+  // constructor: "n" entries equal to "D"
+  small_vector(size_t n, const T &D);
+
+  // constructor: copy from list, from vector, or from iterators
+  small_vector(std::initializer_list<T> D);
+  small_vector(const std::vector<T> &D);
+
+  template<typename It, typename=typename std::enable_if<!std::is_integral<It>::value>::type>
+  small_vector(It first, It last);
+
+  // copy/move (only the entries in use are copied)
+  small_vector(const small_vector &D);
+  small_vector(small_vector &&D) noexcept;
+  small_vector& operator=(const small_vector &D);
+  small_vector& operator=(small_vector &&D) noexcept;
+
+  // destructor (destroys the inline entries)
+  ~small_vector();
+
+  // return as vector
+  operator std::vector<T> () const;
+
+  // get dimensions
+  size_t size() const;
+  bool   empty() const;
+
+  // resize (new entries are set to "D"), reserve, add/remove the last entry, clear
+  void resize(size_t n, const T &D=T());
+  void reserve(size_t n);
+  void push_back(const T &D);
+  void pop_back();
+  void clear();
+
+  // index operators
+  T&       operator[](size_t i);
+  const T& operator[](size_t i) const;
+
+  // pointer to data
+  T*       data();
+  const T* data() const;
+
+  // iterators
+  T*       begin();
+  const T* begin() const;
+  T*       end();
+  const T* end() const;
+
+  // first/last entry
+  T&       front();
+  const T& front() const;
+  T&       back();
+  const T& back() const;
+
+  // equality (also against a "std::vector", which is converted)
+  friend bool operator==(const small_vector &A, const small_vector &B)
+  {
+    return A.size() == B.size() && std::equal(A.begin(), A.end(), B.begin());
+  }
+
+  friend bool operator!=(const small_vector &A, const small_vector &B)
+  {
+    return !( A == B );
+  }
+
+};
+
+// =================================================================================================
+// shape and strides of an array
+// =================================================================================================
+
+typedef small_vector<size_t,6> shape_t;
+
+// =================================================================================================
+// size (in bytes) of the data of "cppmat::array", "cppmat::symmetric::matrix", and
+// "cppmat::diagonal::matrix" (and the derived classes) that is stored inline (without allocation);
+// the default fits a fourth-order tensor of doubles in 3-d
+// =================================================================================================
+
+#ifndef CPPMAT_INLINE_BYTES
+#define CPPMAT_INLINE_BYTES static_cast<size_t>(648)
+#endif
+
+// corresponding number of entries of type "X" (at least one)
+template<typename X>
+struct inline_size
+{
+  static const size_t value = CPPMAT_INLINE_BYTES >= sizeof(X) ? CPPMAT_INLINE_BYTES / sizeof(X) : 1;
+};
+
+// =================================================================================================
+
+// delete a specific item from a vector
+template<typename T, size_t N> small_vector<T,N> del(const small_vector<T,N> &A, int    idx);
+template<typename T, size_t N> small_vector<T,N> del(const small_vector<T,N> &A, size_t idx);
+
+// =================================================================================================
+
+} // namespace ...
+
+// =================================================================================================
+
+// print operator
+#ifndef CPPMAT_NOSTD
+template<typename T, size_t N>
+std::ostream& operator<<(std::ostream& out, const cppmat::small_vector<T,N>& src);
+#endif
+
+// =================================================================================================
+
+#endif
@@ -0,0 +1,540 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_SMALL_VECTOR_HPP
+#define CPPMAT_SMALL_VECTOR_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+
+// =================================================================================================
+// number of entries stored inline (definition of the static member)
+// =================================================================================================
+
+template<typename X>
+const size_t inline_size<X>::value;
+
+// =================================================================================================
+// pointer to the inline storage
+// =================================================================================================
+
+template<typename T, size_t N>
+inline
+T* small_vector<T,N>::inlineData()
+{
+  return reinterpret_cast<T*>(std::begin(mInline));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+const T* small_vector<T,N>::inlineData() const
+{
+  return reinterpret_cast<const T*>(std::begin(mInline));
+}
+
+// =================================================================================================
+// pointer to the storage in use
+// =================================================================================================
+
+template<typename T, size_t N>
+inline
+void small_vector<T,N>::setPointer()
+{
+  mPtr = mSize <= N ? inlineData() : mHeap.data();
+}
+
+// =================================================================================================
+// remove the last entries
+// =================================================================================================
+
+template<typename T, size_t N>
+inline
+void small_vector<T,N>::shrink(size_t n)
+{
+  assert( n <= mSize );
+
+  // inline -> inline
+  if ( mSize <= N )
+  {
+    for ( size_t i = n ; i < mSize ; ++i ) inlineData()[i].~T();
+  }
+  // heap -> heap
+  else if ( n > N )
+  {
+    mHeap.erase(mHeap.begin()+n, mHeap.end());
+  }
+  // heap -> inline
+  else
+  {
+    std::uninitialized_copy(
+      std::make_move_iterator(mHeap.begin()), std::make_move_iterator(mHeap.begin()+n), inlineData()
+    );
+    mHeap.clear();
+  }
+
+  mSize = n;
+
+  setPointer();
+}
+
+// =================================================================================================
+// constructors
+// =================================================================================================
+
+template<typename T, size_t N>
+inline
+small_vector<T,N>::small_vector() : mPtr(inlineData())
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+small_vector<T,N>::small_vector(size_t n, const T &D) : mSize(n)
+{
+  if ( mSize <= N ) std::uninitialized_fill_n(inlineData(), mSize, D);
+  else              mHeap.assign(mSize, D);
+
+  setPointer();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+small_vector<T,N>::small_vector(std::initializer_list<T> D) : small_vector(D.begin(), D.end())
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+small_vector<T,N>::small_vector(const std::vector<T> &D) : small_vector(D.begin(), D.end())
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+template<typename It, typename V>
+inline
+small_vector<T,N>::small_vector(It first, It last)
+{
+  mSize = static_cast<size_t>(std::distance(first, last));
+
+  if ( mSize <= N ) std::uninitialized_copy(first, last, inlineData());
+  else              mHeap.assign(first, last);
+
+  setPointer();
+}
+
+// =================================================================================================
+// copy/move
+// =================================================================================================
+
+template<typename T, size_t N>
+inline
+small_vector<T,N>::small_vector(const small_vector &D) : mSize(D.mSize)
+{
+  if ( mSize <= N ) std::uninitialized_copy(D.begin(), D.end(), inlineData());
+  else              mHeap = D.mHeap;
+
+  setPointer();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+small_vector<T,N>::small_vector(small_vector &&D) noexcept : mSize(D.mSize)
+{
+  if ( mSize <= N )
+    std::uninitialized_copy(std::make_move_iterator(D.begin()), std::make_move_iterator(D.end()),
+      inlineData());
+  else
+    mHeap = std::move(D.mHeap);
+
+  setPointer();
+
+  if ( D.mSize <= N ) D.shrink(0);
+
+  D.mSize = 0;
+  D.mHeap.clear();
+  D.setPointer();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+small_vector<T,N>& small_vector<T,N>::operator=(const small_vector &D)
+{
+  if ( this == &D ) return *this;
+
+  if ( mSize <= N ) shrink(0);
+  else             mHeap.clear();
+
+  if ( D.mSize <= N ) std::uninitialized_copy(D.begin(), D.end(), inlineData());
+  else                mHeap.assign(D.begin(), D.end());
+
+  mSize = D.mSize;
+
+  setPointer();
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+small_vector<T,N>& small_vector<T,N>::operator=(small_vector &&D) noexcept
+{
+  if ( this == &D ) return *this;
+
+  if ( mSize <= N ) shrink(0);
+  else             mHeap.clear();
+
+  if ( D.mSize <= N )
+    std::uninitialized_copy(std::make_move_iterator(D.begin()), std::make_move_iterator(D.end()),
+      inlineData());
+  else
+    mHeap = std::move(D.mHeap);
+
+  mSize = D.mSize;
+
+  setPointer();
+
+  if ( D.mSize <= N ) D.shrink(0);
+
+  D.mSize = 0;
+  D.mHeap.clear();
+  D.setPointer();
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+small_vector<T,N>::~small_vector()
+{
+  if ( mSize <= N ) shrink(0);
+}
+
+// =================================================================================================
+// return as vector
+// =================================================================================================
+
+template<typename T, size_t N>
+inline
+small_vector<T,N>::operator std::vector<T> () const
+{
+  return std::vector<T>(begin(), end());
+}
+
+// =================================================================================================
+// get dimensions
+// =================================================================================================
+
+template<typename T, size_t N>
+inline
+size_t small_vector<T,N>::size() const
+{
+  return mSize;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+bool small_vector<T,N>::empty() const
+{
+  return mSize == 0;
+}
+
+// =================================================================================================
+// resize
+// =================================================================================================
+
+template<typename T, size_t N>
+inline
+void small_vector<T,N>::resize(size_t n, const T &D)
+{
+  if ( n <= mSize )
+  {
+    shrink(n);
+    return;
+  }
+
+  // inline -> inline
+  if ( n <= N )
+  {
+    std::uninitialized_fill(inlineData()+mSize, inlineData()+n, D);
+  }
+  // heap -> heap
+  else if ( mSize > N )
+  {
+    mHeap.resize(n, D);
+  }
+  // inline -> heap (the inline entries are destroyed last, as "D" may refer to one of them)
+  else
+  {
+    mHeap.clear();
+    mHeap.reserve(n);
+    mHeap.insert(mHeap.end(), inlineData(), inlineData()+mSize);
+    mHeap.resize(n, D);
+    shrink(0);
+  }
+
+  mSize = n;
+
+  setPointer();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+void small_vector<T,N>::reserve(size_t n)
+{
+  if ( n <= N ) return;
+
+  mHeap.reserve(n);
+
+  setPointer();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+void small_vector<T,N>::push_back(const T &D)
+{
+  resize(mSize+1, D);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+void small_vector<T,N>::pop_back()
+{
+  assert( mSize > 0 );
+
+  shrink(mSize-1);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+void small_vector<T,N>::clear()
+{
+  shrink(0);
+}
+
+// =================================================================================================
+// index operators
+// =================================================================================================
+
+template<typename T, size_t N>
+inline
+T& small_vector<T,N>::operator[](size_t i)
+{
+  assert( i < mSize );
+
+  return mPtr[i];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+const T& small_vector<T,N>::operator[](size_t i) const
+{
+  assert( i < mSize );
+
+  return mPtr[i];
+}
+
+// =================================================================================================
+// pointer to data
+// =================================================================================================
+
+template<typename T, size_t N>
+inline
+T* small_vector<T,N>::data()
+{
+  return mPtr;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+const T* small_vector<T,N>::data() const
+{
+  return mPtr;
+}
+
+// =================================================================================================
+// iterators
+// =================================================================================================
+
+template<typename T, size_t N>
+inline
+T* small_vector<T,N>::begin()
+{
+  return data();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+const T* small_vector<T,N>::begin() const
+{
+  return data();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+T* small_vector<T,N>::end()
+{
+  return data() + mSize;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+const T* small_vector<T,N>::end() const
+{
+  return data() + mSize;
+}
+
+// =================================================================================================
+// first/last entry
+// =================================================================================================
+
+template<typename T, size_t N>
+inline
+T& small_vector<T,N>::front()
+{
+  assert( mSize > 0 );
+
+  return data()[0];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+const T& small_vector<T,N>::front() const
+{
+  assert( mSize > 0 );
+
+  return data()[0];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+T& small_vector<T,N>::back()
+{
+  assert( mSize > 0 );
+
+  return data()[mSize-1];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+const T& small_vector<T,N>::back() const
+{
+  assert( mSize > 0 );
+
+  return data()[mSize-1];
+}
+
+// =================================================================================================
+// delete a specific item from a vector
+// =================================================================================================
+
+template<typename T, size_t N>
+inline
+small_vector<T,N> del(const small_vector<T,N> &A, int idx)
+{
+  int n = static_cast<int>(A.size());
+
+  idx = ( idx < 0 ) ? idx + n : ( idx >= n ) ? idx - n : idx ;
+
+  assert( idx >= 0 );
+  assert( idx  < n );
+
+  return del(A, static_cast<size_t>(idx));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, size_t N>
+inline
+small_vector<T,N> del(const small_vector<T,N> &A, size_t idx)
+{
+  assert( idx < A.size() );
+
+  small_vector<T,N> B = A;
+
+  std::copy(B.begin()+idx+1, B.end(), B.begin()+idx);
+
+  B.pop_back();
+
+  return B;
+}
+
+// =================================================================================================
+
+} // namespace ...
+
+// =================================================================================================
+// print operator
+// =================================================================================================
+
+#ifndef CPPMAT_NOSTD
+template<typename T, size_t N>
+inline
+std::ostream& operator<<(std::ostream& out, const cppmat::small_vector<T,N>& src)
+{
+  auto w = out.width();
+  auto p = out.precision();
+
+  for ( size_t j = 0 ; j < src.size() ; ++j ) {
+    out << std::setw(w) << std::setprecision(p) << src[j];
+    if ( j != src.size()-1 ) out << ", ";
+  }
+
+  return out;
+}
+#endif
+
+// =================================================================================================
+
+#endif
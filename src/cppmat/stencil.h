@@ -0,0 +1,67 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_STENCIL_H
+#define CPPMAT_STENCIL_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace stencil {
+
+// =================================================================================================
+// Stencil operations on a field "f" (rank 1-6). The weights are given as a mask of the same rank
+// as the field, with an odd number of entries along each axis, centred at the point of evaluation:
+//
+//    out(i,j,...) = sum_{a,b,...} mask(a,b,...) * f(i+a-ra, j+b-rb, ...)
+//
+// with "ra = (mask.shape(0)-1)/2", etc. Only the non-zero weights are used.
+//
+// Entries outside the field follow from the boundary condition:
+// - periodic : f(i) = f(i mod n)
+// - clamp    : f(i) = f(min(max(i,0),n-1))
+// - constant : f(i) = value
+// =================================================================================================
+
+enum class Boundary { periodic, clamp, constant };
+
+// -------------------------------------------------------------------------------------------------
+
+// apply the stencil, allocating the output
+template<typename X>
+cppmat::array<X> apply(const cppmat::array<X> &f, const cppmat::array<X> &mask,
+  Boundary bc=Boundary::periodic, X value=static_cast<X>(0));
+
+// apply the stencil, using a fixed size mask
+template<typename X, size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
+cppmat::array<X> apply(const cppmat::array<X> &f, const cppmat::tiny::array<X,RANK,I,J,K,L,M,N> &mask,
+  Boundary bc=Boundary::periodic, X value=static_cast<X>(0));
+
+// apply the stencil, writing to an existing output (of the same shape as "f", not aliasing "f")
+template<typename X>
+void apply(const cppmat::array<X> &f, const cppmat::array<X> &mask, cppmat::array<X> &out,
+  Boundary bc=Boundary::periodic, X value=static_cast<X>(0));
+
+// -------------------------------------------------------------------------------------------------
+
+// mask of the (second-order) finite difference Laplacian, for a unit grid spacing
+template<typename X> cppmat::array<X> laplacian(size_t rank);
+
+// mask of the average over a box of "2*radius+1" entries along each axis
+template<typename X> cppmat::array<X> box(size_t rank, size_t radius=1);
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
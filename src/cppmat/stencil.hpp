@@ -0,0 +1,249 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_STENCIL_HPP
+#define CPPMAT_STENCIL_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace stencil {
+
+// =================================================================================================
+// apply stencil
+// =================================================================================================
+
+template<typename X>
+inline
+void apply(const cppmat::array<X> &f, const cppmat::array<X> &mask, cppmat::array<X> &out,
+  Boundary bc, X value)
+{
+  assert( f.rank() == mask.rank() );
+  assert( f.rank() >= 1 );
+  assert( f.rank() <= 6 );
+  assert( out.shape() == f.shape() );
+  assert( out.data() != f.data() );
+
+  size_t rank = f.rank();
+
+  if ( f.size() == 0 ) return;
+
+  // shape, strides, and radius of the mask (padded to 6 axes)
+  size_t n[6], s[6], r[6];
+
+  for ( size_t i = 0 ; i < 6 ; ++i ) {
+    n[i] = 1;
+    s[i] = 0;
+    r[i] = 0;
+  }
+
+  std::vector<size_t> fs = f.strides();
+
+  for ( size_t i = 0 ; i < rank ; ++i ) {
+    assert( mask.shape(i) % 2 == 1 );
+    n[i] = f.shape(i);
+    s[i] = fs[i];
+    r[i] = ( mask.shape(i) - 1 ) / 2;
+  }
+
+  // extract the non-zero taps: weight, offset per axis, and flat offset (valid in the interior)
+  std::vector<X>    w;
+  std::vector<int>  off;
+  std::vector<long> flat;
+
+  {
+    std::vector<size_t> ms = mask.strides();
+
+    for ( size_t t = 0 ; t < mask.size() ; ++t )
+    {
+      if ( mask[t] == static_cast<X>(0) ) continue;
+
+      w.push_back(mask[t]);
+
+      long o = 0;
+
+      for ( size_t i = 0 ; i < 6 ; ++i ) {
+        int d = 0;
+        if ( i < rank ) d = static_cast<int>( ( t / ms[i] ) % mask.shape(i) ) - static_cast<int>(r[i]);
+        off.push_back(d);
+        o += d * static_cast<long>(s[i]);
+      }
+
+      flat.push_back(o);
+    }
+  }
+
+  size_t ntap = w.size();
+
+  // map an index along an axis to the field, returns "false" if the value is outside (constant)
+  auto map = [bc](int k, size_t m, size_t &j) -> bool
+  {
+    int mi = static_cast<int>(m);
+
+    if ( k >= 0 and k < mi ) { j = static_cast<size_t>(k); return true; }
+
+    if      ( bc == Boundary::periodic ) j = static_cast<size_t>( ( k % mi + mi ) % mi );
+    else if ( bc == Boundary::clamp    ) j = k < 0 ? 0 : m - 1;
+    else                                 return false;
+
+    return true;
+  };
+
+  // the field as rows along the last (contiguous) axis
+  size_t ncol = n[rank-1];
+  size_t nrow = f.size() / ncol;
+  size_t rc   = r[rank-1];
+
+  const X *in = f.data();
+  X       *o  = out.data();
+
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for ( size_t row = 0 ; row < nrow ; ++row )
+  {
+    // multi-index of the row
+    size_t idx[6] = {0};
+
+    for ( size_t i = 0, q = row ; i + 1 < rank ; ++i ) {
+      idx[i] = q / ( s[i] / ncol );
+      q      = q % ( s[i] / ncol );
+    }
+
+    // check if all taps are within the field, along the leading axes
+    bool interior = ( ncol > 2*rc );
+
+    for ( size_t i = 0 ; i + 1 < rank ; ++i )
+      if ( idx[i] < r[i] or idx[i] + r[i] >= n[i] )
+        interior = false;
+
+    // entries that can be evaluated without boundary treatment: [j0, j1)
+    size_t j0 = interior ? rc        : ncol;
+    size_t j1 = interior ? ncol - rc : ncol;
+
+    X *orow = o + row*ncol;
+
+    // interior: tap-by-tap over contiguous entries (vectorizes)
+    if ( interior )
+    {
+      const X *irow = in + row*ncol;
+
+      std::fill(orow+j0, orow+j1, static_cast<X>(0));
+
+      for ( size_t t = 0 ; t < ntap ; ++t ) {
+        const X *src = irow + flat[t];
+        X        wt  = w[t];
+        for ( size_t j = j0 ; j < j1 ; ++j )
+          orow[j] += wt * src[j];
+      }
+    }
+
+    // boundary: map each tap, for the entries [0, j0) and [j1, ncol)
+    for ( size_t jj = 0 ; jj < j0 + ncol - j1 ; ++jj )
+    {
+      size_t j = jj < j0 ? jj : j1 + ( jj - j0 );
+
+      idx[rank-1] = j;
+
+      X sum = static_cast<X>(0);
+
+      for ( size_t t = 0 ; t < ntap ; ++t )
+      {
+        size_t k = 0;
+        bool   in_field = true;
+
+        for ( size_t i = 0 ; i < rank ; ++i ) {
+          size_t ki;
+          if ( not map(static_cast<int>(idx[i]) + off[6*t+i], n[i], ki) ) { in_field = false; break; }
+          k += ki * s[i];
+        }
+
+        sum += w[t] * ( in_field ? in[k] : value );
+      }
+
+      orow[j] = sum;
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> apply(const cppmat::array<X> &f, const cppmat::array<X> &mask, Boundary bc,
+  X value)
+{
+  cppmat::array<X> out(f.shape());
+
+  apply(f, mask, out, bc, value);
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
+inline
+cppmat::array<X> apply(const cppmat::array<X> &f, const cppmat::tiny::array<X,RANK,I,J,K,L,M,N> &mask,
+  Boundary bc, X value)
+{
+  return apply(f, cppmat::array<X>(mask), bc, value);
+}
+
+// =================================================================================================
+// masks
+// =================================================================================================
+
+template<typename X>
+inline
+cppmat::array<X> laplacian(size_t rank)
+{
+  cppmat::array<X> out = cppmat::array<X>::Zero(std::vector<size_t>(rank, 3));
+
+  std::vector<size_t> s = out.strides();
+
+  // centre
+  size_t c = 0;
+
+  for ( size_t i = 0 ; i < rank ; ++i )
+    c += s[i];
+
+  out[c] = -2 * static_cast<X>(rank);
+
+  // neighbours
+  for ( size_t i = 0 ; i < rank ; ++i ) {
+    out[c-s[i]] = static_cast<X>(1);
+    out[c+s[i]] = static_cast<X>(1);
+  }
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> box(size_t rank, size_t radius)
+{
+  cppmat::array<X> out(std::vector<size_t>(rank, 2*radius+1));
+
+  out.setConstant( static_cast<X>(1) / static_cast<X>(out.size()) );
+
+  return out;
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
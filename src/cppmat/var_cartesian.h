@@ -16,10 +16,23 @@
 namespace cppmat {
 namespace cartesian {
 
+// N.B. each function that returns a tensor (or vector) has an overload that writes the result to
+// an output argument "C" instead (the last argument). "C" is resized if needed, i.e. it does not
+// allocate if it already has the right shape, such that it can be reused in loops. It may not share
+// its storage with the input (checked in debug builds).
+
 // =================================================================================================
 // tensor products: ddot
 // =================================================================================================
 
+template<typename X>
+void ddot(
+  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::tensor4<X> &B,
+  cppmat::cartesian::tensor4<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor4<X> ddot(
   const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::tensor4<X> &B
@@ -27,6 +40,14 @@ cppmat::cartesian::tensor4<X> ddot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void ddot(
+  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::tensor2<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor2<X> ddot(
   const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::tensor2<X> &B
@@ -34,6 +55,14 @@ cppmat::cartesian::tensor2<X> ddot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void ddot(
+  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::tensor2s<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor2<X> ddot(
   const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::tensor2s<X> &B
@@ -41,6 +70,14 @@ cppmat::cartesian::tensor2<X> ddot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void ddot(
+  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::tensor2d<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor2<X> ddot(
   const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::tensor2d<X> &B
@@ -48,6 +85,14 @@ cppmat::cartesian::tensor2<X> ddot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void ddot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor4<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor2<X> ddot(
   const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor4<X> &B
@@ -55,6 +100,14 @@ cppmat::cartesian::tensor2<X> ddot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void ddot(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor4<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor2<X> ddot(
   const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor4<X> &B
@@ -62,6 +115,14 @@ cppmat::cartesian::tensor2<X> ddot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void ddot(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor4<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor2<X> ddot(
   const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor4<X> &B
@@ -134,6 +195,14 @@ X ddot(
 // tensor products: dot
 // =================================================================================================
 
+template<typename X>
+void dot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor2<X> dot(
   const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2<X> &B
@@ -141,6 +210,14 @@ cppmat::cartesian::tensor2<X> dot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2s<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor2<X> dot(
   const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2s<X> &B
@@ -148,6 +225,14 @@ cppmat::cartesian::tensor2<X> dot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2d<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor2<X> dot(
   const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2d<X> &B
@@ -155,6 +240,14 @@ cppmat::cartesian::tensor2<X> dot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dot(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor2<X> dot(
   const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2<X> &B
@@ -162,6 +255,14 @@ cppmat::cartesian::tensor2<X> dot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dot(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2s<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor2<X> dot(
   const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2s<X> &B
@@ -169,6 +270,14 @@ cppmat::cartesian::tensor2<X> dot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dot(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2d<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor2<X> dot(
   const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2d<X> &B
@@ -176,6 +285,14 @@ cppmat::cartesian::tensor2<X> dot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dot(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor2<X> dot(
   const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2<X> &B
@@ -183,6 +300,14 @@ cppmat::cartesian::tensor2<X> dot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dot(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2s<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor2<X> dot(
   const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2s<X> &B
@@ -190,6 +315,14 @@ cppmat::cartesian::tensor2<X> dot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dot(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2d<X> &B,
+  cppmat::cartesian::tensor2d<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor2d<X> dot(
   const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2d<X> &B
@@ -197,6 +330,14 @@ cppmat::cartesian::tensor2d<X> dot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::vector<X> &B,
+  cppmat::cartesian::vector<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::vector<X> dot(
   const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::vector<X> &B
@@ -204,6 +345,14 @@ cppmat::cartesian::vector<X> dot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dot(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::vector<X> &B,
+  cppmat::cartesian::vector<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::vector<X> dot(
   const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::vector<X> &B
@@ -211,6 +360,14 @@ cppmat::cartesian::vector<X> dot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dot(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::vector<X> &B,
+  cppmat::cartesian::vector<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::vector<X> dot(
   const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::vector<X> &B
@@ -218,6 +375,14 @@ cppmat::cartesian::vector<X> dot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dot(
+  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::tensor2<X> &B,
+  cppmat::cartesian::vector<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::vector<X> dot(
   const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::tensor2<X> &B
@@ -225,6 +390,14 @@ cppmat::cartesian::vector<X> dot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dot(
+  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::tensor2s<X> &B,
+  cppmat::cartesian::vector<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::vector<X> dot(
   const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::tensor2s<X> &B
@@ -232,6 +405,14 @@ cppmat::cartesian::vector<X> dot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dot(
+  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::tensor2d<X> &B,
+  cppmat::cartesian::vector<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::vector<X> dot(
   const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::tensor2d<X> &B
@@ -248,6 +429,14 @@ X dot(
 // tensor products: dyadic
 // =================================================================================================
 
+template<typename X>
+void dyadic(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2<X> &B,
+  cppmat::cartesian::tensor4<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor4<X> dyadic(
   const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2<X> &B
@@ -255,6 +444,14 @@ cppmat::cartesian::tensor4<X> dyadic(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dyadic(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2s<X> &B,
+  cppmat::cartesian::tensor4<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor4<X> dyadic(
   const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2s<X> &B
@@ -262,6 +459,14 @@ cppmat::cartesian::tensor4<X> dyadic(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dyadic(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2d<X> &B,
+  cppmat::cartesian::tensor4<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor4<X> dyadic(
   const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2d<X> &B
@@ -269,6 +474,14 @@ cppmat::cartesian::tensor4<X> dyadic(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dyadic(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2<X> &B,
+  cppmat::cartesian::tensor4<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor4<X> dyadic(
   const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2<X> &B
@@ -276,6 +489,14 @@ cppmat::cartesian::tensor4<X> dyadic(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dyadic(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2s<X> &B,
+  cppmat::cartesian::tensor4<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor4<X> dyadic(
   const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2s<X> &B
@@ -283,6 +504,14 @@ cppmat::cartesian::tensor4<X> dyadic(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dyadic(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2d<X> &B,
+  cppmat::cartesian::tensor4<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor4<X> dyadic(
   const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2d<X> &B
@@ -290,6 +519,14 @@ cppmat::cartesian::tensor4<X> dyadic(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dyadic(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2<X> &B,
+  cppmat::cartesian::tensor4<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor4<X> dyadic(
   const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2<X> &B
@@ -297,6 +534,14 @@ cppmat::cartesian::tensor4<X> dyadic(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dyadic(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2s<X> &B,
+  cppmat::cartesian::tensor4<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor4<X> dyadic(
   const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2s<X> &B
@@ -304,6 +549,14 @@ cppmat::cartesian::tensor4<X> dyadic(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dyadic(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2d<X> &B,
+  cppmat::cartesian::tensor4<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor4<X> dyadic(
   const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2d<X> &B
@@ -311,6 +564,14 @@ cppmat::cartesian::tensor4<X> dyadic(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void dyadic(
+  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::vector<X> &B,
+  cppmat::cartesian::tensor2<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor2<X> dyadic(
   const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::vector<X> &B
@@ -320,6 +581,14 @@ cppmat::cartesian::tensor2<X> dyadic(
 // cross (outer) product
 // =================================================================================================
 
+template<typename X>
+void cross(
+  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::vector<X> &B,
+  cppmat::cartesian::vector<X> &C
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::vector<X> cross(
   const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::vector<X> &B
@@ -329,26 +598,61 @@ cppmat::cartesian::vector<X> cross(
 // transpositions
 // =================================================================================================
 
+template<typename X>
+void T(const cppmat::cartesian::tensor4<X> &A, cppmat::cartesian::tensor4<X> &C);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor4<X> T(const cppmat::cartesian::tensor4<X> &A);
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void RT(const cppmat::cartesian::tensor4<X> &A, cppmat::cartesian::tensor4<X> &C);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor4<X> RT(const cppmat::cartesian::tensor4<X> &A);
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void LT(const cppmat::cartesian::tensor4<X> &A, cppmat::cartesian::tensor4<X> &C);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor4<X> LT(const cppmat::cartesian::tensor4<X> &A);
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void T(const cppmat::cartesian::tensor2<X> &A, cppmat::cartesian::tensor2<X> &C);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor2<X> T(const cppmat::cartesian::tensor2<X> &A);
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void T(const cppmat::cartesian::tensor2s<X> &A, cppmat::cartesian::tensor2s<X> &C);
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+cppmat::cartesian::tensor2s<X> T(const cppmat::cartesian::tensor2s<X> &A);
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+void T(const cppmat::cartesian::tensor2d<X> &A, cppmat::cartesian::tensor2d<X> &C);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor2d<X> T(const cppmat::cartesian::tensor2d<X> &A);
 
@@ -361,6 +665,11 @@ X trace(const cppmat::cartesian::tensor2<X> &A);
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+X trace(const cppmat::cartesian::tensor2s<X> &A);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 X trace(const cppmat::cartesian::tensor2d<X> &A);
 
@@ -373,6 +682,11 @@ X det(const cppmat::cartesian::tensor2<X> &A);
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+X det(const cppmat::cartesian::tensor2s<X> &A);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 X det(const cppmat::cartesian::tensor2d<X> &A);
 
@@ -380,11 +694,31 @@ X det(const cppmat::cartesian::tensor2d<X> &A);
 // inverse
 // =================================================================================================
 
+template<typename X>
+void inv(const cppmat::cartesian::tensor2<X> &A, cppmat::cartesian::tensor2<X> &C);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor2<X> inv(const cppmat::cartesian::tensor2<X> &A);
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+void inv(const cppmat::cartesian::tensor2s<X> &A, cppmat::cartesian::tensor2s<X> &C);
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+cppmat::cartesian::tensor2s<X> inv(const cppmat::cartesian::tensor2s<X> &A);
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+void inv(const cppmat::cartesian::tensor2d<X> &A, cppmat::cartesian::tensor2d<X> &C);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 cppmat::cartesian::tensor2d<X> inv(const cppmat::cartesian::tensor2d<X> &A);
 
@@ -22,23 +22,34 @@ namespace cartesian {
 
 template<typename X>
 inline
-cppmat::cartesian::tensor4<X> ddot(
-  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::tensor4<X> &B
+void ddot(
+  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::tensor4<X> &B,
+  cppmat::cartesian::tensor4<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor4<X> C = cppmat::cartesian::tensor4<X>::Zero(ND);
+  C.resize(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        for ( size_t l = 0 ; l < ND ; ++l )
-          for ( size_t m = 0 ; m < ND ; ++m )
-            for ( size_t n = 0 ; n < ND ; ++n )
-              C(i,j,m,n) += A(i,j,k,l) * B(l,k,m,n);
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::Private::ddot44<decltype(N)::value>(A.data(), B.data(), C.data(), ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor4<X> ddot(
+  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::tensor4<X> &B
+)
+{
+  cppmat::cartesian::tensor4<X> C;
+
+  ddot(A, B, C);
 
   return C;
 }
@@ -47,21 +58,34 @@ cppmat::cartesian::tensor4<X> ddot(
 
 template<typename X>
 inline
-cppmat::cartesian::tensor2<X> ddot(
-  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::tensor2<X> &B
+void ddot(
+  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::tensor2<X> &B,
+  cppmat::cartesian::tensor2<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor2<X> C = cppmat::cartesian::tensor2<X>::Zero(ND);
+  C.resize(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        for ( size_t l = 0 ; l < ND ; ++l )
-          C(i,j) += A(i,j,k,l) * B(l,k);
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::Private::ddot42<decltype(N)::value>(A.data(), B.data(), C.data(), ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2<X> ddot(
+  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::tensor2<X> &B
+)
+{
+  cppmat::cartesian::tensor2<X> C;
+
+  ddot(A, B, C);
 
   return C;
 }
@@ -70,21 +94,38 @@ cppmat::cartesian::tensor2<X> ddot(
 
 template<typename X>
 inline
-cppmat::cartesian::tensor2<X> ddot(
-  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::tensor2s<X> &B
+void ddot(
+  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::tensor2s<X> &B,
+  cppmat::cartesian::tensor2<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor2<X> C = cppmat::cartesian::tensor2<X>::Zero(ND);
+  C.resize(ND);
+
+  C.setZero();
 
   for ( size_t i = 0 ; i < ND ; ++i )
     for ( size_t j = 0 ; j < ND ; ++j )
       for ( size_t k = 0 ; k < ND ; ++k )
         for ( size_t l = 0 ; l < ND ; ++l )
           C(i,j) += A(i,j,k,l) * B(l,k);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2<X> ddot(
+  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::tensor2s<X> &B
+)
+{
+  cppmat::cartesian::tensor2<X> C;
+
+  ddot(A, B, C);
 
   return C;
 }
@@ -93,20 +134,37 @@ cppmat::cartesian::tensor2<X> ddot(
 
 template<typename X>
 inline
-cppmat::cartesian::tensor2<X> ddot(
-  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::tensor2d<X> &B
+void ddot(
+  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::tensor2d<X> &B,
+  cppmat::cartesian::tensor2<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor2<X> C = cppmat::cartesian::tensor2<X>::Zero(ND);
+  C.resize(ND);
+
+  C.setZero();
 
   for ( size_t i = 0 ; i < ND ; ++i )
     for ( size_t j = 0 ; j < ND ; ++j )
       for ( size_t k = 0 ; k < ND ; ++k )
         C(i,j) += A(i,j,k,k) * B(k,k);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2<X> ddot(
+  const cppmat::cartesian::tensor4<X> &A, const cppmat::cartesian::tensor2d<X> &B
+)
+{
+  cppmat::cartesian::tensor2<X> C;
+
+  ddot(A, B, C);
 
   return C;
 }
@@ -115,21 +173,34 @@ cppmat::cartesian::tensor2<X> ddot(
 
 template<typename X>
 inline
-cppmat::cartesian::tensor2<X> ddot(
-  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor4<X> &B
+void ddot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor4<X> &B,
+  cppmat::cartesian::tensor2<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor2<X> C = cppmat::cartesian::tensor2<X>::Zero(ND);
+  C.resize(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        for ( size_t l = 0 ; l < ND ; ++l )
-          C(k,l) += A(i,j) * B(j,i,k,l);
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::Private::ddot24<decltype(N)::value>(A.data(), B.data(), C.data(), ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2<X> ddot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor4<X> &B
+)
+{
+  cppmat::cartesian::tensor2<X> C;
+
+  ddot(A, B, C);
 
   return C;
 }
@@ -138,21 +209,38 @@ cppmat::cartesian::tensor2<X> ddot(
 
 template<typename X>
 inline
-cppmat::cartesian::tensor2<X> ddot(
-  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor4<X> &B
+void ddot(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor4<X> &B,
+  cppmat::cartesian::tensor2<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor2<X> C = cppmat::cartesian::tensor2<X>::Zero(ND);
+  C.resize(ND);
+
+  C.setZero();
 
   for ( size_t i = 0 ; i < ND ; ++i )
     for ( size_t j = 0 ; j < ND ; ++j )
       for ( size_t k = 0 ; k < ND ; ++k )
         for ( size_t l = 0 ; l < ND ; ++l )
           C(k,l) += A(i,j) * B(j,i,k,l);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2<X> ddot(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor4<X> &B
+)
+{
+  cppmat::cartesian::tensor2<X> C;
+
+  ddot(A, B, C);
 
   return C;
 }
@@ -161,20 +249,37 @@ cppmat::cartesian::tensor2<X> ddot(
 
 template<typename X>
 inline
-cppmat::cartesian::tensor2<X> ddot(
-  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor4<X> &B
+void ddot(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor4<X> &B,
+  cppmat::cartesian::tensor2<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor2<X> C = cppmat::cartesian::tensor2<X>::Zero(ND);
+  C.resize(ND);
+
+  C.setZero();
 
   for ( size_t i = 0 ; i < ND ; ++i )
     for ( size_t k = 0 ; k < ND ; ++k )
       for ( size_t l = 0 ; l < ND ; ++l )
         C(k,l) += A[i]*B(i,i,k,l);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2<X> ddot(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor4<X> &B
+)
+{
+  cppmat::cartesian::tensor2<X> C;
+
+  ddot(A, B, C);
 
   return C;
 }
@@ -191,13 +296,9 @@ X ddot(
 
   size_t ND = A.ndim();
 
-  X C = static_cast<X>(0);
-
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      C += A(i,j) * B(j,i);
-
-  return C;
+  return cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    return cppmat::Private::ddot22<decltype(N)::value>(A.data(), B.data(), ND);
+  });
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -372,20 +473,34 @@ X ddot(
 
 template<typename X>
 inline
-cppmat::cartesian::tensor2<X> dot(
-  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2<X> &B
+void dot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2<X> &B,
+  cppmat::cartesian::tensor2<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor2<X> C = cppmat::cartesian::tensor2<X>::Zero(ND);
+  C.resize(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        C(i,k) += A(i,j) * B(j,k);
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::Private::dot22<decltype(N)::value>(A.data(), B.data(), C.data(), ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2<X> dot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2<X> &B
+)
+{
+  cppmat::cartesian::tensor2<X> C;
+
+  dot(A, B, C);
 
   return C;
 }
@@ -394,20 +509,37 @@ cppmat::cartesian::tensor2<X> dot(
 
 template<typename X>
 inline
-cppmat::cartesian::tensor2<X> dot(
-  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2s<X> &B
+void dot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2s<X> &B,
+  cppmat::cartesian::tensor2<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor2<X> C = cppmat::cartesian::tensor2<X>::Zero(ND);
+  C.resize(ND);
+
+  C.setZero();
 
   for ( size_t i = 0 ; i < ND ; ++i )
     for ( size_t j = 0 ; j < ND ; ++j )
       for ( size_t k = 0 ; k < ND ; ++k )
         C(i,k) += A(i,j) * B(j,k);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2<X> dot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2s<X> &B
+)
+{
+  cppmat::cartesian::tensor2<X> C;
+
+  dot(A, B, C);
 
   return C;
 }
@@ -416,21 +548,23 @@ cppmat::cartesian::tensor2<X> dot(
 
 template<typename X>
 inline
-cppmat::cartesian::tensor2<X> dot(
-  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2d<X> &B
+void dot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2d<X> &B,
+  cppmat::cartesian::tensor2<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor2<X> C = cppmat::cartesian::tensor2<X>::Zero(ND);
+  C.resize(ND);
+
+  C.setZero();
 
   for ( size_t i = 0 ; i < ND ; ++i )
     for ( size_t j = 0 ; j < ND ; ++j )
       C(i,j) += A(i,j) * B(j,j);
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -438,19 +572,12 @@ cppmat::cartesian::tensor2<X> dot(
 template<typename X>
 inline
 cppmat::cartesian::tensor2<X> dot(
-  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2<X> &B
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2d<X> &B
 )
 {
-  assert( A.ndim() == B.ndim() );
-
-  size_t ND = A.ndim();
-
-  cppmat::cartesian::tensor2<X> C = cppmat::cartesian::tensor2<X>::Zero(ND);
+  cppmat::cartesian::tensor2<X> C;
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        C(i,k) += A(i,j) * B(j,k);
+  dot(A, B, C);
 
   return C;
 }
@@ -459,22 +586,24 @@ cppmat::cartesian::tensor2<X> dot(
 
 template<typename X>
 inline
-cppmat::cartesian::tensor2<X> dot(
-  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2s<X> &B
+void dot(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2<X> &B,
+  cppmat::cartesian::tensor2<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor2<X> C = cppmat::cartesian::tensor2<X>::Zero(ND);
+  C.resize(ND);
+
+  C.setZero();
 
   for ( size_t i = 0 ; i < ND ; ++i )
     for ( size_t j = 0 ; j < ND ; ++j )
       for ( size_t k = 0 ; k < ND ; ++k )
         C(i,k) += A(i,j) * B(j,k);
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -482,18 +611,12 @@ cppmat::cartesian::tensor2<X> dot(
 template<typename X>
 inline
 cppmat::cartesian::tensor2<X> dot(
-  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2d<X> &B
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2<X> &B
 )
 {
-  assert( A.ndim() == B.ndim() );
-
-  size_t ND = A.ndim();
+  cppmat::cartesian::tensor2<X> C;
 
-  cppmat::cartesian::tensor2<X> C = cppmat::cartesian::tensor2<X>::Zero(ND);
-
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      C(i,j) += A(i,j) * B[j];
+  dot(A, B, C);
 
   return C;
 }
@@ -502,21 +625,24 @@ cppmat::cartesian::tensor2<X> dot(
 
 template<typename X>
 inline
-cppmat::cartesian::tensor2<X> dot(
-  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2<X> &B
+void dot(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2s<X> &B,
+  cppmat::cartesian::tensor2<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor2<X> C = cppmat::cartesian::tensor2<X>::Zero(ND);
+  C.resize(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t k = 0 ; k < ND ; ++k )
-      C(i,k) += A[i] * B(i,k);
+  C.setZero();
 
-  return C;
+  for ( size_t i = 0 ; i < ND ; ++i )
+    for ( size_t j = 0 ; j < ND ; ++j )
+      for ( size_t k = 0 ; k < ND ; ++k )
+        C(i,k) += A(i,j) * B(j,k);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -524,18 +650,12 @@ cppmat::cartesian::tensor2<X> dot(
 template<typename X>
 inline
 cppmat::cartesian::tensor2<X> dot(
-  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2s<X> &B
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2s<X> &B
 )
 {
-  assert( A.ndim() == B.ndim() );
-
-  size_t ND = A.ndim();
-
-  cppmat::cartesian::tensor2<X> C = cppmat::cartesian::tensor2<X>::Zero(ND);
+  cppmat::cartesian::tensor2<X> C;
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t k = 0 ; k < ND ; ++k )
-      C(i,k) += A[i] * B(i,k);
+  dot(A, B, C);
 
   return C;
 }
@@ -544,39 +664,36 @@ cppmat::cartesian::tensor2<X> dot(
 
 template<typename X>
 inline
-cppmat::cartesian::tensor2d<X> dot(
-  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2d<X> &B
+void dot(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2d<X> &B,
+  cppmat::cartesian::tensor2<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor2d<X> C = cppmat::cartesian::tensor2d<X>::Zero(ND);
+  C.resize(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    C[i] += A[i] * B(i,i);
+  C.setZero();
 
-  return C;
+  for ( size_t i = 0 ; i < ND ; ++i )
+    for ( size_t j = 0 ; j < ND ; ++j )
+      C(i,j) += A(i,j) * B[j];
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::cartesian::vector<X> dot(
-  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::vector<X> &B
+cppmat::cartesian::tensor2<X> dot(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2d<X> &B
 )
 {
-  assert( A.ndim() == B.ndim() );
+  cppmat::cartesian::tensor2<X> C;
 
-  size_t ND = A.ndim();
-
-  cppmat::cartesian::vector<X> C = cppmat::cartesian::vector<X>::Zero(ND);
-
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      C(i) += A(i,j) * B(j);
+  dot(A, B, C);
 
   return C;
 }
@@ -585,39 +702,36 @@ cppmat::cartesian::vector<X> dot(
 
 template<typename X>
 inline
-cppmat::cartesian::vector<X> dot(
-  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::vector<X> &B
+void dot(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2<X> &B,
+  cppmat::cartesian::tensor2<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::vector<X> C = cppmat::cartesian::vector<X>::Zero(ND);
+  C.resize(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      C(i) += A(i,j) * B(j);
+  C.setZero();
 
-  return C;
+  for ( size_t i = 0 ; i < ND ; ++i )
+    for ( size_t k = 0 ; k < ND ; ++k )
+      C(i,k) += A[i] * B(i,k);
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::cartesian::vector<X> dot(
-  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::vector<X> &B
+cppmat::cartesian::tensor2<X> dot(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2<X> &B
 )
 {
-  assert( A.ndim() == B.ndim() );
+  cppmat::cartesian::tensor2<X> C;
 
-  size_t ND = A.ndim();
-
-  cppmat::cartesian::vector<X> C = cppmat::cartesian::vector<X>::Zero(ND);
-
-  for ( size_t i = 0 ; i < ND ; ++i )
-    C(i) += A[i] * B(i);
+  dot(A, B, C);
 
   return C;
 }
@@ -626,40 +740,36 @@ cppmat::cartesian::vector<X> dot(
 
 template<typename X>
 inline
-cppmat::cartesian::vector<X> dot(
-  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::tensor2<X> &B
+void dot(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2s<X> &B,
+  cppmat::cartesian::tensor2<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::vector<X> C = cppmat::cartesian::vector<X>::Zero(ND);
+  C.resize(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      C(j) += A(i) * B(i,j);
+  C.setZero();
 
-  return C;
+  for ( size_t i = 0 ; i < ND ; ++i )
+    for ( size_t k = 0 ; k < ND ; ++k )
+      C(i,k) += A[i] * B(i,k);
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::cartesian::vector<X> dot(
-  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::tensor2s<X> &B
+cppmat::cartesian::tensor2<X> dot(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2s<X> &B
 )
 {
-  assert( A.ndim() == B.ndim() );
-
-  size_t ND = A.ndim();
-
-  cppmat::cartesian::vector<X> C = cppmat::cartesian::vector<X>::Zero(ND);
+  cppmat::cartesian::tensor2<X> C;
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      C(j) += A(i) * B(i,j);
+  dot(A, B, C);
 
   return C;
 }
@@ -668,18 +778,35 @@ cppmat::cartesian::vector<X> dot(
 
 template<typename X>
 inline
-cppmat::cartesian::vector<X> dot(
-  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::tensor2d<X> &B
+void dot(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2d<X> &B,
+  cppmat::cartesian::tensor2d<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::vector<X> C = cppmat::cartesian::vector<X>::Zero(ND);
+  C.resize(ND);
+
+  C.setZero();
 
   for ( size_t i = 0 ; i < ND ; ++i )
-    C(i) += A(i) * B[i];
+    C[i] += A[i] * B(i,i);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2d<X> dot(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2d<X> &B
+)
+{
+  cppmat::cartesian::tensor2d<X> C;
+
+  dot(A, B, C);
 
   return C;
 }
@@ -688,66 +815,315 @@ cppmat::cartesian::vector<X> dot(
 
 template<typename X>
 inline
-X dot(
-  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::vector<X> &B
+void dot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::vector<X> &B,
+  cppmat::cartesian::vector<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  X C = static_cast<X>(0);
+  C.resize(ND);
+
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::Private::dot21<decltype(N)::value>(A.data(), B.data(), C.data(), ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::vector<X> dot(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::vector<X> &B
+)
+{
+  cppmat::cartesian::vector<X> C;
+
+  dot(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void dot(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::vector<X> &B,
+  cppmat::cartesian::vector<X> &C
+)
+{
+  assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
+
+  size_t ND = A.ndim();
+
+  C.resize(ND);
+
+  C.setZero();
 
   for ( size_t i = 0 ; i < ND ; ++i )
-    C += A(i) * B(i);
+    for ( size_t j = 0 ; j < ND ; ++j )
+      C(i) += A(i,j) * B(j);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::vector<X> dot(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::vector<X> &B
+)
+{
+  cppmat::cartesian::vector<X> C;
+
+  dot(A, B, C);
 
   return C;
 }
 
-// =================================================================================================
-// tensor products: dyadic
-// =================================================================================================
+// -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::cartesian::tensor4<X> dyadic(
-  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2<X> &B
+void dot(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::vector<X> &B,
+  cppmat::cartesian::vector<X> &C
+)
+{
+  assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
+
+  size_t ND = A.ndim();
+
+  C.resize(ND);
+
+  C.setZero();
+
+  for ( size_t i = 0 ; i < ND ; ++i )
+    C(i) += A[i] * B(i);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::vector<X> dot(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::vector<X> &B
+)
+{
+  cppmat::cartesian::vector<X> C;
+
+  dot(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void dot(
+  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::tensor2<X> &B,
+  cppmat::cartesian::vector<X> &C
+)
+{
+  assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
+
+  size_t ND = A.ndim();
+
+  C.resize(ND);
+
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::Private::dot12<decltype(N)::value>(A.data(), B.data(), C.data(), ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::vector<X> dot(
+  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::tensor2<X> &B
+)
+{
+  cppmat::cartesian::vector<X> C;
+
+  dot(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void dot(
+  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::tensor2s<X> &B,
+  cppmat::cartesian::vector<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor4<X> C = cppmat::cartesian::tensor4<X>::Zero(ND);
+  C.resize(ND);
+
+  C.setZero();
 
   for ( size_t i = 0 ; i < ND ; ++i )
     for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        for ( size_t l = 0 ; l < ND ; ++l )
-          C(i,j,k,l) += A(i,j) * B(k,l);
+      C(j) += A(i) * B(i,j);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::vector<X> dot(
+  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::tensor2s<X> &B
+)
+{
+  cppmat::cartesian::vector<X> C;
+
+  dot(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void dot(
+  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::tensor2d<X> &B,
+  cppmat::cartesian::vector<X> &C
+)
+{
+  assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
+
+  size_t ND = A.ndim();
+
+  C.resize(ND);
+
+  C.setZero();
+
+  for ( size_t i = 0 ; i < ND ; ++i )
+    C(i) += A(i) * B[i];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::vector<X> dot(
+  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::tensor2d<X> &B
+)
+{
+  cppmat::cartesian::vector<X> C;
+
+  dot(A, B, C);
 
   return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+inline
+X dot(
+  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::vector<X> &B
+)
+{
+  assert( A.ndim() == B.ndim() );
+
+  size_t ND = A.ndim();
+
+  return cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    return cppmat::Private::dot11<decltype(N)::value>(A.data(), B.data(), ND);
+  });
+}
+
+// =================================================================================================
+// tensor products: dyadic
+// =================================================================================================
+
+template<typename X>
+inline
+void dyadic(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2<X> &B,
+  cppmat::cartesian::tensor4<X> &C
+)
+{
+  assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
+
+  size_t ND = A.ndim();
+
+  C.resize(ND);
+
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::Private::dyadic22<decltype(N)::value>(A.data(), B.data(), C.data(), ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 inline
 cppmat::cartesian::tensor4<X> dyadic(
-  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2s<X> &B
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2<X> &B
+)
+{
+  cppmat::cartesian::tensor4<X> C;
+
+  dyadic(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void dyadic(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2s<X> &B,
+  cppmat::cartesian::tensor4<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor4<X> C = cppmat::cartesian::tensor4<X>::Zero(ND);
+  C.resize(ND);
+
+  C.setZero();
 
   for ( size_t i = 0 ; i < ND ; ++i )
     for ( size_t j = 0 ; j < ND ; ++j )
       for ( size_t k = 0 ; k < ND ; ++k )
         for ( size_t l = 0 ; l < ND ; ++l )
           C(i,j,k,l) += A(i,j) * B(k,l);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor4<X> dyadic(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2s<X> &B
+)
+{
+  cppmat::cartesian::tensor4<X> C;
+
+  dyadic(A, B, C);
 
   return C;
 }
@@ -756,20 +1132,37 @@ cppmat::cartesian::tensor4<X> dyadic(
 
 template<typename X>
 inline
-cppmat::cartesian::tensor4<X> dyadic(
-  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2d<X> &B
+void dyadic(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2d<X> &B,
+  cppmat::cartesian::tensor4<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor4<X> C = cppmat::cartesian::tensor4<X>::Zero(ND);
+  C.resize(ND);
+
+  C.setZero();
 
   for ( size_t i = 0 ; i < ND ; ++i )
     for ( size_t j = 0 ; j < ND ; ++j )
       for ( size_t k = 0 ; k < ND ; ++k )
         C(i,j,k,k) += A(i,j) * B(k,k);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor4<X> dyadic(
+  const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2d<X> &B
+)
+{
+  cppmat::cartesian::tensor4<X> C;
+
+  dyadic(A, B, C);
 
   return C;
 }
@@ -778,21 +1171,38 @@ cppmat::cartesian::tensor4<X> dyadic(
 
 template<typename X>
 inline
-cppmat::cartesian::tensor4<X> dyadic(
-  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2<X> &B
+void dyadic(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2<X> &B,
+  cppmat::cartesian::tensor4<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor4<X> C = cppmat::cartesian::tensor4<X>::Zero(ND);
+  C.resize(ND);
+
+  C.setZero();
 
   for ( size_t i = 0 ; i < ND ; ++i )
     for ( size_t j = 0 ; j < ND ; ++j )
       for ( size_t k = 0 ; k < ND ; ++k )
         for ( size_t l = 0 ; l < ND ; ++l )
           C(i,j,k,l) += A(i,j) * B(k,l);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor4<X> dyadic(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2<X> &B
+)
+{
+  cppmat::cartesian::tensor4<X> C;
+
+  dyadic(A, B, C);
 
   return C;
 }
@@ -801,21 +1211,38 @@ cppmat::cartesian::tensor4<X> dyadic(
 
 template<typename X>
 inline
-cppmat::cartesian::tensor4<X> dyadic(
-  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2s<X> &B
+void dyadic(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2s<X> &B,
+  cppmat::cartesian::tensor4<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor4<X> C = cppmat::cartesian::tensor4<X>::Zero(ND);
+  C.resize(ND);
+
+  C.setZero();
 
   for ( size_t i = 0 ; i < ND ; ++i )
     for ( size_t j = 0 ; j < ND ; ++j )
       for ( size_t k = 0 ; k < ND ; ++k )
         for ( size_t l = 0 ; l < ND ; ++l )
           C(i,j,k,l) += A(i,j) * B(k,l);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor4<X> dyadic(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2s<X> &B
+)
+{
+  cppmat::cartesian::tensor4<X> C;
+
+  dyadic(A, B, C);
 
   return C;
 }
@@ -824,20 +1251,37 @@ cppmat::cartesian::tensor4<X> dyadic(
 
 template<typename X>
 inline
-cppmat::cartesian::tensor4<X> dyadic(
-  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2d<X> &B
+void dyadic(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2d<X> &B,
+  cppmat::cartesian::tensor4<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor4<X> C = cppmat::cartesian::tensor4<X>::Zero(ND);
+  C.resize(ND);
+
+  C.setZero();
 
   for ( size_t i = 0 ; i < ND ; ++i )
     for ( size_t j = 0 ; j < ND ; ++j )
       for ( size_t k = 0 ; k < ND ; ++k )
         C(i,j,k,k) += A(i,j) * B[k];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor4<X> dyadic(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor2d<X> &B
+)
+{
+  cppmat::cartesian::tensor4<X> C;
+
+  dyadic(A, B, C);
 
   return C;
 }
@@ -846,20 +1290,37 @@ cppmat::cartesian::tensor4<X> dyadic(
 
 template<typename X>
 inline
-cppmat::cartesian::tensor4<X> dyadic(
-  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2<X> &B
+void dyadic(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2<X> &B,
+  cppmat::cartesian::tensor4<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor4<X> C = cppmat::cartesian::tensor4<X>::Zero(ND);
+  C.resize(ND);
+
+  C.setZero();
 
   for ( size_t i = 0 ; i < ND ; ++i )
     for ( size_t k = 0 ; k < ND ; ++k )
       for ( size_t l = 0 ; l < ND ; ++l )
         C(i,i,k,l) += A[i] * B(k,l);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor4<X> dyadic(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2<X> &B
+)
+{
+  cppmat::cartesian::tensor4<X> C;
+
+  dyadic(A, B, C);
 
   return C;
 }
@@ -868,20 +1329,37 @@ cppmat::cartesian::tensor4<X> dyadic(
 
 template<typename X>
 inline
-cppmat::cartesian::tensor4<X> dyadic(
-  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2s<X> &B
+void dyadic(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2s<X> &B,
+  cppmat::cartesian::tensor4<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor4<X> C = cppmat::cartesian::tensor4<X>::Zero(ND);
+  C.resize(ND);
+
+  C.setZero();
 
   for ( size_t i = 0 ; i < ND ; ++i )
     for ( size_t k = 0 ; k < ND ; ++k )
       for ( size_t l = 0 ; l < ND ; ++l )
         C(i,i,k,l) += A[i] * B(k,l);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor4<X> dyadic(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2s<X> &B
+)
+{
+  cppmat::cartesian::tensor4<X> C;
+
+  dyadic(A, B, C);
 
   return C;
 }
@@ -890,19 +1368,36 @@ cppmat::cartesian::tensor4<X> dyadic(
 
 template<typename X>
 inline
-cppmat::cartesian::tensor4<X> dyadic(
-  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2d<X> &B
+void dyadic(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2d<X> &B,
+  cppmat::cartesian::tensor4<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor4<X> C = cppmat::cartesian::tensor4<X>::Zero(ND);
+  C.resize(ND);
+
+  C.setZero();
 
   for ( size_t i = 0 ; i < ND ; ++i )
     for ( size_t k = 0 ; k < ND ; ++k )
       C(i,i,k,k) += A[i] * B[k];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor4<X> dyadic(
+  const cppmat::cartesian::tensor2d<X> &A, const cppmat::cartesian::tensor2d<X> &B
+)
+{
+  cppmat::cartesian::tensor4<X> C;
+
+  dyadic(A, B, C);
 
   return C;
 }
@@ -911,19 +1406,34 @@ cppmat::cartesian::tensor4<X> dyadic(
 
 template<typename X>
 inline
-cppmat::cartesian::tensor2<X> dyadic(
-  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::vector<X> &B
+void dyadic(
+  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::vector<X> &B,
+  cppmat::cartesian::tensor2<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor2<X> C(ND);
+  C.resize(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      C(i,j) = A(i) * B(j);
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::Private::dyadic11<decltype(N)::value>(A.data(), B.data(), C.data(), ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2<X> dyadic(
+  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::vector<X> &B
+)
+{
+  cppmat::cartesian::tensor2<X> C;
+
+  dyadic(A, B, C);
 
   return C;
 }
@@ -934,22 +1444,37 @@ cppmat::cartesian::tensor2<X> dyadic(
 
 template<typename X>
 inline
-cppmat::cartesian::vector<X> cross(
-  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::vector<X> &B
+void cross(
+  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::vector<X> &B,
+  cppmat::cartesian::vector<X> &C
 )
 {
   assert( A.ndim() == B.ndim() );
+  assert( cppmat::Private::noalias(C, A, B) );
 
   size_t ND = A.ndim();
 
   if ( ND != 3 )
     throw std::runtime_error("'cross' only implemented in 3D");
 
-  cppmat::cartesian::vector<X> C(3);
+  C.resize(3);
 
   C[0] =                     A[1]*B[2]-B[1]*A[2] ;
   C[1] = static_cast<X>(-1)*(A[0]*B[2]-B[0]*A[2]);
   C[2] =                     A[0]*B[1]-B[0]*A[1] ;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::vector<X> cross(
+  const cppmat::cartesian::vector<X> &A, const cppmat::cartesian::vector<X> &B
+)
+{
+  cppmat::cartesian::vector<X> C;
+
+  cross(A, B, C);
 
   return C;
 }
@@ -960,17 +1485,28 @@ cppmat::cartesian::vector<X> cross(
 
 template<typename X>
 inline
-cppmat::cartesian::tensor4<X> T(const cppmat::cartesian::tensor4<X> &A)
+void T(const cppmat::cartesian::tensor4<X> &A, cppmat::cartesian::tensor4<X> &C)
 {
+  assert( cppmat::Private::noalias(C, A) );
+
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor4<X> C(ND);
+  C.resize(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        for ( size_t l = 0 ; l < ND ; ++l )
-          C(l,k,j,i) = A(i,j,k,l);
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::Private::T4<decltype(N)::value>(A.data(), C.data(), ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor4<X> T(const cppmat::cartesian::tensor4<X> &A)
+{
+  cppmat::cartesian::tensor4<X> C;
+
+  T(A, C);
 
   return C;
 }
@@ -979,17 +1515,28 @@ cppmat::cartesian::tensor4<X> T(const cppmat::cartesian::tensor4<X> &A)
 
 template<typename X>
 inline
-cppmat::cartesian::tensor4<X> RT(const cppmat::cartesian::tensor4<X> &A)
+void RT(const cppmat::cartesian::tensor4<X> &A, cppmat::cartesian::tensor4<X> &C)
 {
+  assert( cppmat::Private::noalias(C, A) );
+
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor4<X> C(ND);
+  C.resize(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        for ( size_t l = 0 ; l < ND ; ++l )
-          C(i,j,l,k) = A(i,j,k,l);
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::Private::RT4<decltype(N)::value>(A.data(), C.data(), ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor4<X> RT(const cppmat::cartesian::tensor4<X> &A)
+{
+  cppmat::cartesian::tensor4<X> C;
+
+  RT(A, C);
 
   return C;
 }
@@ -998,17 +1545,28 @@ cppmat::cartesian::tensor4<X> RT(const cppmat::cartesian::tensor4<X> &A)
 
 template<typename X>
 inline
-cppmat::cartesian::tensor4<X> LT(const cppmat::cartesian::tensor4<X> &A)
+void LT(const cppmat::cartesian::tensor4<X> &A, cppmat::cartesian::tensor4<X> &C)
 {
+  assert( cppmat::Private::noalias(C, A) );
+
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor4<X> C(ND);
+  C.resize(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        for ( size_t l = 0 ; l < ND ; ++l )
-          C(j,i,k,l) = A(i,j,k,l);
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::Private::LT4<decltype(N)::value>(A.data(), C.data(), ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor4<X> LT(const cppmat::cartesian::tensor4<X> &A)
+{
+  cppmat::cartesian::tensor4<X> C;
+
+  LT(A, C);
 
   return C;
 }
@@ -1017,26 +1575,61 @@ cppmat::cartesian::tensor4<X> LT(const cppmat::cartesian::tensor4<X> &A)
 
 template<typename X>
 inline
-cppmat::cartesian::tensor2<X> T(const cppmat::cartesian::tensor2<X> &A)
+void T(const cppmat::cartesian::tensor2<X> &A, cppmat::cartesian::tensor2<X> &C)
 {
+  assert( cppmat::Private::noalias(C, A) );
+
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor2<X> C(ND);
+  C.resize(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      C(j,i) = A(i,j);
+  cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    cppmat::Private::T2<decltype(N)::value>(A.data(), C.data(), ND);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2<X> T(const cppmat::cartesian::tensor2<X> &A)
+{
+  cppmat::cartesian::tensor2<X> C;
+
+  T(A, C);
 
   return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+inline
+void T(const cppmat::cartesian::tensor2s<X> &A, cppmat::cartesian::tensor2s<X> &C)
+{
+  C = A;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 inline
 cppmat::cartesian::tensor2s<X> T(const cppmat::cartesian::tensor2s<X> &A)
 {
-  return A;
+  cppmat::cartesian::tensor2s<X> C;
+
+  T(A, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void T(const cppmat::cartesian::tensor2d<X> &A, cppmat::cartesian::tensor2d<X> &C)
+{
+  C = A;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -1045,7 +1638,11 @@ template<typename X>
 inline
 cppmat::cartesian::tensor2d<X> T(const cppmat::cartesian::tensor2d<X> &A)
 {
-  return A;
+  cppmat::cartesian::tensor2d<X> C;
+
+  T(A, C);
+
+  return C;
 }
 
 // =================================================================================================
@@ -1058,12 +1655,9 @@ X trace(const cppmat::cartesian::tensor2<X> &A)
 {
   size_t ND = A.ndim();
 
-  X C = static_cast<X>(0);
-
-  for ( size_t i = 0 ; i < ND ; ++i )
-    C += A(i,i);
-
-  return C;
+  return cppmat::Private::nd_dispatch(ND, [&](auto N) {
+    return cppmat::Private::trace2<decltype(N)::value>(A.data(), ND);
+  });
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -1165,15 +1759,17 @@ X det(const cppmat::cartesian::tensor2d<X> &A)
 
 template<typename X>
 inline
-cppmat::cartesian::tensor2<X> inv(const cppmat::cartesian::tensor2<X> &A)
+void inv(const cppmat::cartesian::tensor2<X> &A, cppmat::cartesian::tensor2<X> &C)
 {
+  assert( cppmat::Private::noalias(C, A) );
+
   size_t ND = A.ndim();
 
   // compute determinant
   X det = A.det();
 
-  // allocate result
-  cppmat::cartesian::tensor2<X> C(ND);
+  // resize result
+  C.resize(ND);
 
   if ( ND == 2 )
   {
@@ -1182,7 +1778,7 @@ cppmat::cartesian::tensor2<X> inv(const cppmat::cartesian::tensor2<X> &A)
     C[2] = static_cast<X>(-1) * A[2] / det;
     C[3] =                      A[0] / det;
 
-    return C;
+    return;
   }
 
   if ( ND == 3 )
@@ -1197,7 +1793,7 @@ cppmat::cartesian::tensor2<X> inv(const cppmat::cartesian::tensor2<X> &A)
     C[7] = (A[1]*A[6]-A[0]*A[7]) / det;
     C[8] = (A[0]*A[4]-A[1]*A[3]) / det;
 
-    return C;
+    return;
   }
 
   throw std::runtime_error("'inv' only implemented in 2D/3D");
@@ -1207,15 +1803,30 @@ cppmat::cartesian::tensor2<X> inv(const cppmat::cartesian::tensor2<X> &A)
 
 template<typename X>
 inline
-cppmat::cartesian::tensor2s<X> inv(const cppmat::cartesian::tensor2s<X> &A)
+cppmat::cartesian::tensor2<X> inv(const cppmat::cartesian::tensor2<X> &A)
 {
+  cppmat::cartesian::tensor2<X> C;
+
+  inv(A, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void inv(const cppmat::cartesian::tensor2s<X> &A, cppmat::cartesian::tensor2s<X> &C)
+{
+  assert( cppmat::Private::noalias(C, A) );
+
   size_t ND = A.ndim();
 
   // compute determinant
   X det = A.det();
 
-  // allocate result
-  cppmat::cartesian::tensor2s<X> C(ND);
+  // resize result
+  C.resize(ND);
 
   if ( ND==2 )
   {
@@ -1223,7 +1834,7 @@ cppmat::cartesian::tensor2s<X> inv(const cppmat::cartesian::tensor2s<X> &A)
     C[1] = static_cast<X>(-1) * A[1] / det;
     C[2] =                      A[0] / det;
 
-    return C;
+    return;
   }
 
   if ( ND==3 )
@@ -1235,7 +1846,7 @@ cppmat::cartesian::tensor2s<X> inv(const cppmat::cartesian::tensor2s<X> &A)
     C[4] = (A[2]*A[1]-A[0]*A[4]) / det;
     C[5] = (A[0]*A[3]-A[1]*A[1]) / det;
 
-    return C;
+    return;
   }
 
   throw std::runtime_error("'inv' only implemented in 2D/3D");
@@ -1245,14 +1856,40 @@ cppmat::cartesian::tensor2s<X> inv(const cppmat::cartesian::tensor2s<X> &A)
 
 template<typename X>
 inline
-cppmat::cartesian::tensor2d<X> inv(const cppmat::cartesian::tensor2d<X> &A)
+cppmat::cartesian::tensor2s<X> inv(const cppmat::cartesian::tensor2s<X> &A)
+{
+  cppmat::cartesian::tensor2s<X> C;
+
+  inv(A, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void inv(const cppmat::cartesian::tensor2d<X> &A, cppmat::cartesian::tensor2d<X> &C)
 {
+  assert( cppmat::Private::noalias(C, A) );
+
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor2d<X> C(ND);
+  C.resize(ND);
 
   for ( size_t i = 0; i < ND ; ++i )
     C[i] = static_cast<X>(1) / A[i];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2d<X> inv(const cppmat::cartesian::tensor2d<X> &A)
+{
+  cppmat::cartesian::tensor2d<X> C;
+
+  inv(A, C);
 
   return C;
 }
@@ -0,0 +1,232 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_VAR_CARTESIAN_SOA_H
+#define CPPMAT_VAR_CARTESIAN_SOA_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace cartesian {
+namespace soa {
+
+// =================================================================================================
+// Fields of tensors (one tensor per point) in structure-of-arrays layout: the components are the
+// leading axes and the point index is the last (fastest) axis. For example, a field of 2nd-order
+// tensors has shape [nd, nd, npoints] whereby each component is stored contiguously for all points.
+// The point-wise tensor products below therefore operate on "npoints" consecutive values at once.
+//
+// The classes derive from "cppmat::array", such that initialization, (element-wise) arithmetic,
+// and reductions are inherited. A single tensor is extracted/stored with "get"/"set".
+// =================================================================================================
+
+// =================================================================================================
+// cppmat::cartesian::soa::tensor4
+// =================================================================================================
+
+template<typename X>
+class tensor4 : public cppmat::array<X>
+{
+protected:
+
+  // local variables
+  size_t ND=0;      // number of dimensions
+  size_t mPoints=0; // number of points
+
+private:
+
+  // hide functions
+  using cppmat::array<X>::chrank;
+
+public:
+
+  // pointer to data (plain storage)
+  using cppmat::array<X>::data;
+
+  // constructor: default
+  tensor4() = default;
+
+  // constructor: allocate, don't initialize
+  tensor4(size_t npoints, size_t nd);
+
+  // named constructor: initialize
+  static tensor4<X> Zero(size_t npoints, size_t nd);
+
+  // named constructor: copy from array-of-structures, shape [..., nd, nd, nd, nd]
+  static tensor4<X> CopyAoS(const cppmat::array<X> &A);
+
+  // copy to array-of-structures, shape [npoints, nd, nd, nd, nd]
+  cppmat::array<X> AoS() const;
+  template<typename Iterator> void copyToAoS(Iterator first) const;
+
+  // get dimensions
+  size_t ndim() const;
+  size_t points() const;
+
+  // pointer to the values of component (i,j,k,l) for all points
+  X*       data(size_t i, size_t j, size_t k, size_t l);
+  const X* data(size_t i, size_t j, size_t k, size_t l) const;
+
+  // get/set the tensor of a point
+  cppmat::cartesian::tensor4<X> get(size_t p) const;
+  void set(size_t p, const cppmat::cartesian::tensor4<X> &A);
+  template<size_t nd> void get(size_t p, cppmat::tiny::cartesian::tensor4<X,nd> &A) const;
+  template<size_t nd> void set(size_t p, const cppmat::tiny::cartesian::tensor4<X,nd> &A);
+
+};
+
+// =================================================================================================
+// cppmat::cartesian::soa::tensor2
+// =================================================================================================
+
+template<typename X>
+class tensor2 : public cppmat::array<X>
+{
+protected:
+
+  // local variables
+  size_t ND=0;      // number of dimensions
+  size_t mPoints=0; // number of points
+
+private:
+
+  // hide functions
+  using cppmat::array<X>::chrank;
+
+public:
+
+  // pointer to data (plain storage)
+  using cppmat::array<X>::data;
+
+  // constructor: default
+  tensor2() = default;
+
+  // constructor: allocate, don't initialize
+  tensor2(size_t npoints, size_t nd);
+
+  // named constructor: initialize
+  static tensor2<X> Zero(size_t npoints, size_t nd);
+  static tensor2<X> I   (size_t npoints, size_t nd);
+
+  // named constructor: copy from array-of-structures, shape [..., nd, nd]
+  static tensor2<X> CopyAoS(const cppmat::array<X> &A);
+
+  // copy to array-of-structures, shape [npoints, nd, nd]
+  cppmat::array<X> AoS() const;
+  template<typename Iterator> void copyToAoS(Iterator first) const;
+
+  // get dimensions
+  size_t ndim() const;
+  size_t points() const;
+
+  // pointer to the values of component (i,j) for all points
+  X*       data(size_t i, size_t j);
+  const X* data(size_t i, size_t j) const;
+
+  // get/set the tensor of a point
+  cppmat::cartesian::tensor2<X> get(size_t p) const;
+  void set(size_t p, const cppmat::cartesian::tensor2<X> &A);
+  template<size_t nd> void get(size_t p, cppmat::tiny::cartesian::tensor2<X,nd> &A) const;
+  template<size_t nd> void set(size_t p, const cppmat::tiny::cartesian::tensor2<X,nd> &A);
+
+};
+
+// =================================================================================================
+// cppmat::cartesian::soa::vector
+// =================================================================================================
+
+template<typename X>
+class vector : public cppmat::array<X>
+{
+protected:
+
+  // local variables
+  size_t ND=0;      // number of dimensions
+  size_t mPoints=0; // number of points
+
+private:
+
+  // hide functions
+  using cppmat::array<X>::chrank;
+
+public:
+
+  // pointer to data (plain storage)
+  using cppmat::array<X>::data;
+
+  // constructor: default
+  vector() = default;
+
+  // constructor: allocate, don't initialize
+  vector(size_t npoints, size_t nd);
+
+  // named constructor: initialize
+  static vector<X> Zero(size_t npoints, size_t nd);
+
+  // named constructor: copy from array-of-structures, shape [..., nd]
+  static vector<X> CopyAoS(const cppmat::array<X> &A);
+
+  // copy to array-of-structures, shape [npoints, nd]
+  cppmat::array<X> AoS() const;
+  template<typename Iterator> void copyToAoS(Iterator first) const;
+
+  // get dimensions
+  size_t ndim() const;
+  size_t points() const;
+
+  // pointer to the values of component (i) for all points
+  X*       data(size_t i);
+  const X* data(size_t i) const;
+
+  // get/set the vector of a point
+  cppmat::cartesian::vector<X> get(size_t p) const;
+  void set(size_t p, const cppmat::cartesian::vector<X> &A);
+  template<size_t nd> void get(size_t p, cppmat::tiny::cartesian::vector<X,nd> &A) const;
+  template<size_t nd> void set(size_t p, const cppmat::tiny::cartesian::vector<X,nd> &A);
+
+};
+
+// =================================================================================================
+// tensor products, per point
+// =================================================================================================
+
+// double contraction: C_ijmn = A_ijkl * B_lkmn, C_ij = A_ijkl * B_lk, C_kl = A_ij * B_jikl,
+// C = A_ij * B_ji
+template<typename X> tensor4<X>        ddot(const tensor4<X> &A, const tensor4<X> &B);
+template<typename X> tensor2<X>        ddot(const tensor4<X> &A, const tensor2<X> &B);
+template<typename X> tensor2<X>        ddot(const tensor2<X> &A, const tensor4<X> &B);
+template<typename X> cppmat::vector<X> ddot(const tensor2<X> &A, const tensor2<X> &B);
+
+// single contraction: C_ik = A_ij * B_jk, C_i = A_ij * B_j
+template<typename X> tensor2<X> dot(const tensor2<X> &A, const tensor2<X> &B);
+template<typename X> vector<X>  dot(const tensor2<X> &A, const vector <X> &B);
+
+// dyadic product: C_ijkl = A_ij * B_kl
+template<typename X> tensor4<X> dyadic(const tensor2<X> &A, const tensor2<X> &B);
+
+// transpose: C_ij = A_ji
+template<typename X> tensor2<X> T(const tensor2<X> &A);
+
+// transpositions: C_lkji = A_ijkl (T), C_ijlk = A_ijkl (RT), C_jikl = A_ijkl (LT)
+template<typename X> tensor4<X> T (const tensor4<X> &A);
+template<typename X> tensor4<X> RT(const tensor4<X> &A);
+template<typename X> tensor4<X> LT(const tensor4<X> &A);
+
+// trace: C = A_ii
+template<typename X> cppmat::vector<X> trace(const tensor2<X> &A);
+
+// =================================================================================================
+
+}}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
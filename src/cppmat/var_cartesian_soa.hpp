@@ -0,0 +1,848 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_VAR_CARTESIAN_SOA_HPP
+#define CPPMAT_VAR_CARTESIAN_SOA_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace cartesian {
+namespace soa {
+
+// =================================================================================================
+// cppmat::cartesian::soa::tensor4
+// =================================================================================================
+
+template<typename X>
+inline
+tensor4<X>::tensor4(size_t npoints, size_t nd) : cppmat::array<X>({nd,nd,nd,nd,npoints})
+{
+  ND      = nd;
+  mPoints = npoints;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor4<X> tensor4<X>::Zero(size_t npoints, size_t nd)
+{
+  tensor4<X> out(npoints, nd);
+
+  out.setZero();
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor4<X> tensor4<X>::CopyAoS(const cppmat::array<X> &A)
+{
+  assert( A.rank() >= 4 );
+
+  size_t nd      = A.shape(-1);
+  size_t ncomp   = nd*nd*nd*nd;
+  size_t npoints = A.size() / ncomp;
+
+  assert( npoints * ncomp == A.size() );
+
+  tensor4<X> out(npoints, nd);
+
+  cppmat::Private::transpose(A.data(), out.data(), npoints, ncomp);
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> tensor4<X>::AoS() const
+{
+  cppmat::array<X> out(std::vector<size_t>({mPoints,ND,ND,ND,ND}));
+
+  cppmat::Private::transpose(this->data(), out.data(), ND*ND*ND*ND, mPoints);
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<typename Iterator>
+inline
+void tensor4<X>::copyToAoS(Iterator first) const
+{
+  size_t ncomp = ND*ND*ND*ND;
+
+  for ( size_t p = 0 ; p < mPoints ; ++p )
+    for ( size_t c = 0 ; c < ncomp ; ++c )
+      first[p*ncomp+c] = this->mData[c*mPoints+p];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t tensor4<X>::ndim() const
+{
+  return ND;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t tensor4<X>::points() const
+{
+  return mPoints;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X* tensor4<X>::data(size_t i, size_t j, size_t k, size_t l)
+{
+  return this->mData.data() + ( ((i*ND+j)*ND+k)*ND+l ) * mPoints;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+const X* tensor4<X>::data(size_t i, size_t j, size_t k, size_t l) const
+{
+  return this->mData.data() + ( ((i*ND+j)*ND+k)*ND+l ) * mPoints;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor4<X> tensor4<X>::get(size_t p) const
+{
+  assert( p < mPoints );
+
+  cppmat::cartesian::tensor4<X> out(ND);
+
+  for ( size_t c = 0 ; c < out.size() ; ++c )
+    out[c] = this->mData[c*mPoints+p];
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void tensor4<X>::set(size_t p, const cppmat::cartesian::tensor4<X> &A)
+{
+  assert( p < mPoints );
+  assert( A.ndim() == ND );
+
+  for ( size_t c = 0 ; c < A.size() ; ++c )
+    this->mData[c*mPoints+p] = A[c];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<size_t nd>
+inline
+void tensor4<X>::get(size_t p, cppmat::tiny::cartesian::tensor4<X,nd> &A) const
+{
+  assert( p < mPoints );
+  assert( nd == ND );
+
+  for ( size_t c = 0 ; c < A.size() ; ++c )
+    A[c] = this->mData[c*mPoints+p];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<size_t nd>
+inline
+void tensor4<X>::set(size_t p, const cppmat::tiny::cartesian::tensor4<X,nd> &A)
+{
+  assert( p < mPoints );
+  assert( nd == ND );
+
+  for ( size_t c = 0 ; c < A.size() ; ++c )
+    this->mData[c*mPoints+p] = A[c];
+}
+
+// =================================================================================================
+// cppmat::cartesian::soa::tensor2
+// =================================================================================================
+
+template<typename X>
+inline
+tensor2<X>::tensor2(size_t npoints, size_t nd) : cppmat::array<X>({nd,nd,npoints})
+{
+  ND      = nd;
+  mPoints = npoints;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor2<X> tensor2<X>::Zero(size_t npoints, size_t nd)
+{
+  tensor2<X> out(npoints, nd);
+
+  out.setZero();
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor2<X> tensor2<X>::I(size_t npoints, size_t nd)
+{
+  tensor2<X> out = tensor2<X>::Zero(npoints, nd);
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    std::fill(out.data(i,i), out.data(i,i)+npoints, static_cast<X>(1));
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor2<X> tensor2<X>::CopyAoS(const cppmat::array<X> &A)
+{
+  assert( A.rank() >= 2 );
+
+  size_t nd      = A.shape(-1);
+  size_t ncomp   = nd*nd;
+  size_t npoints = A.size() / ncomp;
+
+  assert( npoints * ncomp == A.size() );
+
+  tensor2<X> out(npoints, nd);
+
+  cppmat::Private::transpose(A.data(), out.data(), npoints, ncomp);
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> tensor2<X>::AoS() const
+{
+  cppmat::array<X> out(std::vector<size_t>({mPoints,ND,ND}));
+
+  cppmat::Private::transpose(this->data(), out.data(), ND*ND, mPoints);
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<typename Iterator>
+inline
+void tensor2<X>::copyToAoS(Iterator first) const
+{
+  size_t ncomp = ND*ND;
+
+  for ( size_t p = 0 ; p < mPoints ; ++p )
+    for ( size_t c = 0 ; c < ncomp ; ++c )
+      first[p*ncomp+c] = this->mData[c*mPoints+p];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t tensor2<X>::ndim() const
+{
+  return ND;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t tensor2<X>::points() const
+{
+  return mPoints;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X* tensor2<X>::data(size_t i, size_t j)
+{
+  return this->mData.data() + ( i*ND+j ) * mPoints;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+const X* tensor2<X>::data(size_t i, size_t j) const
+{
+  return this->mData.data() + ( i*ND+j ) * mPoints;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2<X> tensor2<X>::get(size_t p) const
+{
+  assert( p < mPoints );
+
+  cppmat::cartesian::tensor2<X> out(ND);
+
+  for ( size_t c = 0 ; c < out.size() ; ++c )
+    out[c] = this->mData[c*mPoints+p];
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void tensor2<X>::set(size_t p, const cppmat::cartesian::tensor2<X> &A)
+{
+  assert( p < mPoints );
+  assert( A.ndim() == ND );
+
+  for ( size_t c = 0 ; c < A.size() ; ++c )
+    this->mData[c*mPoints+p] = A[c];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<size_t nd>
+inline
+void tensor2<X>::get(size_t p, cppmat::tiny::cartesian::tensor2<X,nd> &A) const
+{
+  assert( p < mPoints );
+  assert( nd == ND );
+
+  for ( size_t c = 0 ; c < A.size() ; ++c )
+    A[c] = this->mData[c*mPoints+p];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<size_t nd>
+inline
+void tensor2<X>::set(size_t p, const cppmat::tiny::cartesian::tensor2<X,nd> &A)
+{
+  assert( p < mPoints );
+  assert( nd == ND );
+
+  for ( size_t c = 0 ; c < A.size() ; ++c )
+    this->mData[c*mPoints+p] = A[c];
+}
+
+// =================================================================================================
+// cppmat::cartesian::soa::vector
+// =================================================================================================
+
+template<typename X>
+inline
+vector<X>::vector(size_t npoints, size_t nd) : cppmat::array<X>({nd,npoints})
+{
+  ND      = nd;
+  mPoints = npoints;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+vector<X> vector<X>::Zero(size_t npoints, size_t nd)
+{
+  vector<X> out(npoints, nd);
+
+  out.setZero();
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+vector<X> vector<X>::CopyAoS(const cppmat::array<X> &A)
+{
+  assert( A.rank() >= 1 );
+
+  size_t nd      = A.shape(-1);
+  size_t ncomp   = nd;
+  size_t npoints = A.size() / ncomp;
+
+  assert( npoints * ncomp == A.size() );
+
+  vector<X> out(npoints, nd);
+
+  cppmat::Private::transpose(A.data(), out.data(), npoints, ncomp);
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> vector<X>::AoS() const
+{
+  cppmat::array<X> out(std::vector<size_t>({mPoints,ND}));
+
+  cppmat::Private::transpose(this->data(), out.data(), ND, mPoints);
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<typename Iterator>
+inline
+void vector<X>::copyToAoS(Iterator first) const
+{
+  size_t ncomp = ND;
+
+  for ( size_t p = 0 ; p < mPoints ; ++p )
+    for ( size_t c = 0 ; c < ncomp ; ++c )
+      first[p*ncomp+c] = this->mData[c*mPoints+p];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t vector<X>::ndim() const
+{
+  return ND;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t vector<X>::points() const
+{
+  return mPoints;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X* vector<X>::data(size_t i)
+{
+  return this->mData.data() + ( i ) * mPoints;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+const X* vector<X>::data(size_t i) const
+{
+  return this->mData.data() + ( i ) * mPoints;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::vector<X> vector<X>::get(size_t p) const
+{
+  assert( p < mPoints );
+
+  cppmat::cartesian::vector<X> out(ND);
+
+  for ( size_t c = 0 ; c < out.size() ; ++c )
+    out[c] = this->mData[c*mPoints+p];
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void vector<X>::set(size_t p, const cppmat::cartesian::vector<X> &A)
+{
+  assert( p < mPoints );
+  assert( A.ndim() == ND );
+
+  for ( size_t c = 0 ; c < A.size() ; ++c )
+    this->mData[c*mPoints+p] = A[c];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<size_t nd>
+inline
+void vector<X>::get(size_t p, cppmat::tiny::cartesian::vector<X,nd> &A) const
+{
+  assert( p < mPoints );
+  assert( nd == ND );
+
+  for ( size_t c = 0 ; c < A.size() ; ++c )
+    A[c] = this->mData[c*mPoints+p];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<size_t nd>
+inline
+void vector<X>::set(size_t p, const cppmat::tiny::cartesian::vector<X,nd> &A)
+{
+  assert( p < mPoints );
+  assert( nd == ND );
+
+  for ( size_t c = 0 ; c < A.size() ; ++c )
+    this->mData[c*mPoints+p] = A[c];
+}
+
+// =================================================================================================
+// tensor products, per point
+// =================================================================================================
+
+// All products are written as loops over the tensor components, with an inner loop over the points
+// (with unit stride, and without dependencies between iterations such that it is vectorized).
+
+template<typename X>
+inline
+tensor4<X> ddot(const tensor4<X> &A, const tensor4<X> &B)
+{
+  assert( A.ndim  () == B.ndim  () );
+  assert( A.points() == B.points() );
+
+  size_t nd = A.ndim();
+  size_t n  = A.points();
+
+  tensor4<X> C = tensor4<X>::Zero(n, nd);
+
+  // the point-wise "nd^2 x nd^2" matrix product, "C = A * LT(B)" (see "cppmat::Private::ddot44")
+  for ( size_t i = 0 ; i < nd ; ++i ) {
+    for ( size_t j = 0 ; j < nd ; ++j ) {
+      for ( size_t k = 0 ; k < nd ; ++k ) {
+        for ( size_t l = 0 ; l < nd ; ++l ) {
+          const X *a = A.data(i,j,k,l);
+          for ( size_t m = 0 ; m < nd ; ++m ) {
+            for ( size_t o = 0 ; o < nd ; ++o ) {
+              const X *b = B.data(l,k,m,o);
+              X       *c = C.data(i,j,m,o);
+              cppmat::simd::fmadd(a, b, c, n);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor2<X> ddot(const tensor4<X> &A, const tensor2<X> &B)
+{
+  assert( A.ndim  () == B.ndim  () );
+  assert( A.points() == B.points() );
+
+  size_t nd = A.ndim();
+  size_t n  = A.points();
+
+  tensor2<X> C = tensor2<X>::Zero(n, nd);
+
+  for ( size_t i = 0 ; i < nd ; ++i ) {
+    for ( size_t j = 0 ; j < nd ; ++j ) {
+      X *c = C.data(i,j);
+      for ( size_t k = 0 ; k < nd ; ++k ) {
+        for ( size_t l = 0 ; l < nd ; ++l ) {
+          const X *a = A.data(i,j,k,l);
+          const X *b = B.data(l,k);
+          cppmat::simd::fmadd(a, b, c, n);
+        }
+      }
+    }
+  }
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor2<X> ddot(const tensor2<X> &A, const tensor4<X> &B)
+{
+  assert( A.ndim  () == B.ndim  () );
+  assert( A.points() == B.points() );
+
+  size_t nd = A.ndim();
+  size_t n  = A.points();
+
+  tensor2<X> C = tensor2<X>::Zero(n, nd);
+
+  for ( size_t i = 0 ; i < nd ; ++i ) {
+    for ( size_t j = 0 ; j < nd ; ++j ) {
+      const X *a = A.data(i,j);
+      for ( size_t k = 0 ; k < nd ; ++k ) {
+        for ( size_t l = 0 ; l < nd ; ++l ) {
+          const X *b = B.data(j,i,k,l);
+          X       *c = C.data(k,l);
+          cppmat::simd::fmadd(a, b, c, n);
+        }
+      }
+    }
+  }
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::vector<X> ddot(const tensor2<X> &A, const tensor2<X> &B)
+{
+  assert( A.ndim  () == B.ndim  () );
+  assert( A.points() == B.points() );
+
+  size_t nd = A.ndim();
+  size_t n  = A.points();
+
+  cppmat::vector<X> C = cppmat::vector<X>::Zero(n);
+
+  X *c = C.data();
+
+  for ( size_t i = 0 ; i < nd ; ++i ) {
+    for ( size_t j = 0 ; j < nd ; ++j ) {
+      const X *a = A.data(i,j);
+      const X *b = B.data(j,i);
+      cppmat::simd::fmadd(a, b, c, n);
+    }
+  }
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor2<X> dot(const tensor2<X> &A, const tensor2<X> &B)
+{
+  assert( A.ndim  () == B.ndim  () );
+  assert( A.points() == B.points() );
+
+  size_t nd = A.ndim();
+  size_t n  = A.points();
+
+  tensor2<X> C = tensor2<X>::Zero(n, nd);
+
+  for ( size_t i = 0 ; i < nd ; ++i ) {
+    for ( size_t k = 0 ; k < nd ; ++k ) {
+      X *c = C.data(i,k);
+      for ( size_t j = 0 ; j < nd ; ++j ) {
+        const X *a = A.data(i,j);
+        const X *b = B.data(j,k);
+        cppmat::simd::fmadd(a, b, c, n);
+      }
+    }
+  }
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+vector<X> dot(const tensor2<X> &A, const vector<X> &B)
+{
+  assert( A.ndim  () == B.ndim  () );
+  assert( A.points() == B.points() );
+
+  size_t nd = A.ndim();
+  size_t n  = A.points();
+
+  vector<X> C = vector<X>::Zero(n, nd);
+
+  for ( size_t i = 0 ; i < nd ; ++i ) {
+    X *c = C.data(i);
+    for ( size_t j = 0 ; j < nd ; ++j ) {
+      const X *a = A.data(i,j);
+      const X *b = B.data(j);
+      cppmat::simd::fmadd(a, b, c, n);
+    }
+  }
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor4<X> dyadic(const tensor2<X> &A, const tensor2<X> &B)
+{
+  assert( A.ndim  () == B.ndim  () );
+  assert( A.points() == B.points() );
+
+  size_t nd = A.ndim();
+  size_t n  = A.points();
+
+  tensor4<X> C(n, nd);
+
+  for ( size_t i = 0 ; i < nd ; ++i ) {
+    for ( size_t j = 0 ; j < nd ; ++j ) {
+      const X *a = A.data(i,j);
+      for ( size_t k = 0 ; k < nd ; ++k ) {
+        for ( size_t l = 0 ; l < nd ; ++l ) {
+          const X *b = B.data(k,l);
+          X       *c = C.data(i,j,k,l);
+          cppmat::simd::mul(a, b, c, n);
+        }
+      }
+    }
+  }
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor2<X> T(const tensor2<X> &A)
+{
+  size_t nd = A.ndim();
+  size_t n  = A.points();
+
+  tensor2<X> C(n, nd);
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    for ( size_t j = 0 ; j < nd ; ++j )
+      std::copy(A.data(j,i), A.data(j,i)+n, C.data(i,j));
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor4<X> T(const tensor4<X> &A)
+{
+  size_t nd = A.ndim();
+  size_t n  = A.points();
+
+  tensor4<X> C(n, nd);
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    for ( size_t j = 0 ; j < nd ; ++j )
+      for ( size_t k = 0 ; k < nd ; ++k )
+        for ( size_t l = 0 ; l < nd ; ++l )
+          std::copy(A.data(i,j,k,l), A.data(i,j,k,l)+n, C.data(l,k,j,i));
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor4<X> RT(const tensor4<X> &A)
+{
+  size_t nd = A.ndim();
+  size_t n  = A.points();
+
+  tensor4<X> C(n, nd);
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    for ( size_t j = 0 ; j < nd ; ++j )
+      for ( size_t k = 0 ; k < nd ; ++k )
+        for ( size_t l = 0 ; l < nd ; ++l )
+          std::copy(A.data(i,j,k,l), A.data(i,j,k,l)+n, C.data(i,j,l,k));
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor4<X> LT(const tensor4<X> &A)
+{
+  size_t nd = A.ndim();
+  size_t n  = A.points();
+
+  tensor4<X> C(n, nd);
+
+  // the components "(i,j,:,:)" are stored contiguously for all points
+  for ( size_t i = 0 ; i < nd ; ++i )
+    for ( size_t j = 0 ; j < nd ; ++j )
+      std::copy(A.data(i,j,0,0), A.data(i,j,0,0)+nd*nd*n, C.data(j,i,0,0));
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::vector<X> trace(const tensor2<X> &A)
+{
+  size_t nd = A.ndim();
+  size_t n  = A.points();
+
+  cppmat::vector<X> C = cppmat::vector<X>::Zero(n);
+
+  X *c = C.data();
+
+  for ( size_t i = 0 ; i < nd ; ++i ) {
+    const X *a = A.data(i,i);
+    cppmat::simd::add(c, a, c, n);
+  }
+
+  return C;
+}
+
+// =================================================================================================
+
+}}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
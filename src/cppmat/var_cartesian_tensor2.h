@@ -40,6 +40,9 @@ public:
   template<typename U, typename=typename std::enable_if<std::is_convertible<U,X>::value>::type>
   tensor2(const cppmat::array<U> &A);
 
+  // constructor: move from parent (re-uses the storage)
+  tensor2(cppmat::array<X> &&A);
+
   // constructor: copy from other classes
   tensor2(const cppmat::symmetric::matrix<X> &A);
   tensor2(const cppmat::diagonal ::matrix<X> &A);
@@ -39,6 +39,15 @@ tensor2<X>::tensor2(const cppmat::array<U> &A) : cppmat::matrix<X>(A)
   ND = this->mShape[0];
 }
 
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor2<X>::tensor2(cppmat::array<X> &&A) : cppmat::matrix<X>(std::move(A))
+{
+  ND = this->mShape[0];
+}
+
 // =================================================================================================
 // constructors: copy from other class
 // =================================================================================================
@@ -40,6 +40,9 @@ public:
   template<typename U, typename=typename std::enable_if<std::is_convertible<U,X>::value>::type>
   tensor2d(const cppmat::diagonal::matrix<U> &A);
 
+  // constructor: move from parent (re-uses the storage)
+  tensor2d(cppmat::diagonal::matrix<X> &&A);
+
   // constructor: copy from fixed size
   template<size_t nd> tensor2d(const cppmat::tiny::cartesian::tensor2d<X,nd> &A);
 
@@ -47,6 +47,15 @@ tensor2d<X>::tensor2d(const cppmat::diagonal::matrix<U> &A) : cppmat::diagonal::
   ND = this->N;
 }
 
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor2d<X>::tensor2d(cppmat::diagonal::matrix<X> &&A) : cppmat::diagonal::matrix<X>(std::move(A))
+{
+  ND = this->N;
+}
+
 // =================================================================================================
 // constructors: copy from fixed size
 // =================================================================================================
@@ -40,6 +40,9 @@ public:
   template<typename U, typename=typename std::enable_if<std::is_convertible<U,X>::value>::type>
   tensor2s(const cppmat::symmetric::matrix<U> &A);
 
+  // constructor: move from parent (re-uses the storage)
+  tensor2s(cppmat::symmetric::matrix<X> &&A);
+
   // constructor: copy from other classes
   tensor2s(const cppmat::diagonal::matrix<X> &A);
 
@@ -39,6 +39,15 @@ tensor2s<X>::tensor2s(const cppmat::symmetric::matrix<U> &A) : cppmat::symmetric
   ND = this->N;
 }
 
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor2s<X>::tensor2s(cppmat::symmetric::matrix<X> &&A) : cppmat::symmetric::matrix<X>(std::move(A))
+{
+  ND = this->N;
+}
+
 // =================================================================================================
 // constructors: copy from other class
 // =================================================================================================
@@ -45,6 +45,9 @@ public:
   template<typename U, typename=typename std::enable_if<std::is_convertible<U,X>::value>::type>
   tensor4(const cppmat::array<U> &A);
 
+  // constructor: move from parent (re-uses the storage)
+  tensor4(cppmat::array<X> &&A);
+
   // constructor: copy from fixed size
   template<size_t nd> tensor4(const cppmat::tiny::cartesian::tensor4<X,nd> &A);
 
@@ -41,6 +41,17 @@ tensor4<X>::tensor4(const cppmat::array<U> &A) : cppmat::array<X>(A)
   ND = this->mShape[0];
 }
 
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor4<X>::tensor4(cppmat::array<X> &&A) : cppmat::array<X>(std::move(A))
+{
+  assert( this->mRank == 4 );
+
+  ND = this->mShape[0];
+}
+
 // =================================================================================================
 // constructors: copy from fixed size
 // =================================================================================================
@@ -328,7 +339,7 @@ template<typename X>
 inline
 void tensor4<X>::setIs()
 {
-  (*this) = ( tensor4<X>::I(ND) + tensor4<X>::Irt(ND) ) / static_cast<X>(2);
+  (*this) = cppmat::cartesian::projection::dense<X>(cppmat::cartesian::projection::Is(), ND);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -337,7 +348,7 @@ template<typename X>
 inline
 void tensor4<X>::setId()
 {
-  (*this) = tensor4<X>::I(ND) - tensor4<X>::II(ND)/static_cast<X>(ND);
+  (*this) = cppmat::cartesian::projection::dense<X>(cppmat::cartesian::projection::Id(), ND);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -346,7 +357,7 @@ template<typename X>
 inline
 void tensor4<X>::setIsd()
 {
-  (*this) = tensor4<X>::Is(ND) - tensor4<X>::II(ND)/static_cast<X>(ND);
+  (*this) = cppmat::cartesian::projection::dense<X>(cppmat::cartesian::projection::Isd(), ND);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -40,6 +40,9 @@ public:
   template<typename U, typename=typename std::enable_if<std::is_convertible<U,X>::value>::type>
   vector(const cppmat::array<U> &A);
 
+  // constructor: move from parent (re-uses the storage)
+  vector(cppmat::array<X> &&A);
+
   // constructor: copy from other classes
   template<typename U, typename=typename std::enable_if<std::is_convertible<U,X>::value>::type>
   vector(const std::vector<U> &A);
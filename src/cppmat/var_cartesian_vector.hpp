@@ -39,6 +39,15 @@ vector<X>::vector(const cppmat::array<U> &A) : cppmat::vector<X>(A)
   ND = this->mShape[0];
 }
 
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+vector<X>::vector(cppmat::array<X> &&A) : cppmat::vector<X>(std::move(A))
+{
+  ND = this->mShape[0];
+}
+
 // =================================================================================================
 // constructors: copy from other class
 // =================================================================================================
@@ -58,7 +67,7 @@ vector<X>::vector(const std::vector<U> &A) : cppmat::vector<X>(A)
 template<typename X>
 template<size_t nd>
 inline
-vector<X>::vector(const cppmat::tiny::cartesian::vector<X,nd> &A) : cppmat::array<X>(A)
+vector<X>::vector(const cppmat::tiny::cartesian::vector<X,nd> &A) : cppmat::vector<X>(A)
 {
   ND = this->mShape[0];
 }
@@ -70,7 +79,7 @@ vector<X>::vector(const cppmat::tiny::cartesian::vector<X,nd> &A) : cppmat::arra
 template<typename X>
 template<size_t nd>
 inline
-vector<X>::vector(const cppmat::view::cartesian::vector<X,nd> &A) : cppmat::array<X>(A)
+vector<X>::vector(const cppmat::view::cartesian::vector<X,nd> &A) : cppmat::vector<X>(A)
 {
   ND = this->mShape[0];
 }
@@ -28,7 +28,7 @@ protected:
   size_t              mSize=0;          // total size == data.size()
   static const size_t mRank=2;          // rank (number of axes)
   size_t              N=0;              // number of rows/columns
-  std::vector<X>      mData;            // data container
+  cppmat::small_vector<X,cppmat::inline_size<X>::value> mData; // data container
   X                   mZero[1];         // pointer to a zero entry
   bool                mPeriodic=false;  // if true: disable bounds-check where possible
 
@@ -80,7 +80,7 @@ public:
   size_t rank() const;
   size_t shape(int    i) const;
   size_t shape(size_t i) const;
-  std::vector<size_t> shape() const;
+  cppmat::shape_t shape() const;
 
   // get using a different return type
   template<typename U> U size() const;
@@ -243,6 +243,20 @@ template<typename X> matrix<X> operator* (const matrix<X> &A, const        X  &B
 template<typename X> matrix<X> operator/ (const matrix<X> &A, const        X  &B);
 template<typename X> matrix<X> operator* (const        X  &A, const matrix<X> &B);
 
+// external arithmetic operators (cppmat::diagonal): re-use the storage of a temporary operand
+template<typename X> matrix<X> operator* (      matrix<X> &&A, const matrix<X>  &B);
+template<typename X> matrix<X> operator* (const matrix<X>  &A,       matrix<X> &&B);
+template<typename X> matrix<X> operator* (      matrix<X> &&A,       matrix<X> &&B);
+template<typename X> matrix<X> operator+ (      matrix<X> &&A, const matrix<X>  &B);
+template<typename X> matrix<X> operator+ (const matrix<X>  &A,       matrix<X> &&B);
+template<typename X> matrix<X> operator+ (      matrix<X> &&A,       matrix<X> &&B);
+template<typename X> matrix<X> operator- (      matrix<X> &&A, const matrix<X>  &B);
+template<typename X> matrix<X> operator- (const matrix<X>  &A,       matrix<X> &&B);
+template<typename X> matrix<X> operator- (      matrix<X> &&A,       matrix<X> &&B);
+template<typename X> matrix<X> operator* (      matrix<X> &&A, const        X   &B);
+template<typename X> matrix<X> operator/ (      matrix<X> &&A, const        X   &B);
+template<typename X> matrix<X> operator* (const        X   &A,       matrix<X> &&B);
+
 // print operator
 template<typename X> std::ostream& operator<<(std::ostream& out, const matrix<X>& src);
 
@@ -346,11 +346,11 @@ size_t matrix<X>::shape(size_t i) const
 
 template<typename X>
 inline
-std::vector<size_t> matrix<X>::shape() const
+cppmat::shape_t matrix<X>::shape() const
 {
-  std::vector<size_t> shape(mRank);
+  cppmat::shape_t shape;
 
-  std::fill(shape.begin(), shape.end(), N);
+  shape.resize(mRank, N);
 
   return shape;
 }
@@ -404,7 +404,7 @@ template<typename U>
 inline
 std::vector<U> matrix<X>::shape() const
 {
-  std::vector<size_t> A = shape();
+  cppmat::shape_t A = shape();
 
   std::vector<U> B(A.size());
 
@@ -752,17 +752,8 @@ template<typename X>
 inline
 void matrix<X>::setRandom(X lower, X upper)
 {
-  // type of random number distribution
-  std::uniform_real_distribution<X> dist(lower, upper);
-
-  // Mersenne Twister: Good quality random number generator
-  std::mt19937 rng;
-
-  // Initialize with non-deterministic seeds
-  rng.seed(std::random_device{}());
-
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] = dist(rng);
+  // library-wide counter-based generator (reproducible, see "cppmat::random::seed")
+  cppmat::random::uniform(data(), mSize, lower, upper, cppmat::random::generator());
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -1625,6 +1616,188 @@ matrix<X> operator* (const X &A, const matrix<X> &B)
   return C;
 }
 
+// =================================================================================================
+// arithmetic operators: external, re-using the storage of a temporary (rvalue) operand
+// =================================================================================================
+
+template<typename X>
+inline
+matrix<X> operator* (matrix<X> &&A, const matrix<X> &B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] * B[i];
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator* (const matrix<X> &A, matrix<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  for ( size_t i = 0 ; i < B.size() ; ++i )
+    B[i] = A[i] * B[i];
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator* (matrix<X> &&A, matrix<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] * B[i];
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator+ (matrix<X> &&A, const matrix<X> &B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] + B[i];
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator+ (const matrix<X> &A, matrix<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  for ( size_t i = 0 ; i < B.size() ; ++i )
+    B[i] = A[i] + B[i];
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator+ (matrix<X> &&A, matrix<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] + B[i];
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator- (matrix<X> &&A, const matrix<X> &B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] - B[i];
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator- (const matrix<X> &A, matrix<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  for ( size_t i = 0 ; i < B.size() ; ++i )
+    B[i] = A[i] - B[i];
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator- (matrix<X> &&A, matrix<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] - B[i];
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator* (matrix<X> &&A, const X &B)
+{
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] * B;
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator/ (matrix<X> &&A, const X &B)
+{
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] / B;
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator* (const X &A, matrix<X> &&B)
+{
+  for ( size_t i = 0 ; i < B.size() ; ++i )
+    B[i] = A * B[i];
+
+  return std::move(B);
+}
+
 // =================================================================================================
 
 }} // namespace ...
@@ -0,0 +1,126 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_VAR_HALO_ARRAY_H
+#define CPPMAT_VAR_HALO_ARRAY_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace halo {
+
+// =================================================================================================
+// Array with ghost margins ("halo") of "width[i]" entries on both sides of each axis. The storage
+// is a plain "cppmat::array" of shape "shape[i]+2*width[i]", that is allocated once. The ghost
+// entries are refreshed in-place (periodic or constant) by copying only the boundary slabs.
+//
+// The index operators use interior indices: "A(0,0)" is the first interior entry, while "A(-1,0)"
+// and "A(shape[0],0)" are ghost entries. Stencils can thus be written without modulo indexing.
+// The plain storage and the padded shape are accessible via the "cppmat::array" base class.
+// =================================================================================================
+
+template<typename X>
+class array : public cppmat::array<X>
+{
+protected:
+
+  // base class variables
+  using cppmat::array<X>::MAX_DIM;
+  using cppmat::array<X>::mRank;
+  using cppmat::array<X>::mShape;
+  using cppmat::array<X>::mStrides;
+  using cppmat::array<X>::mData;
+
+  // local variables
+  size_t mInner[MAX_DIM]; // interior shape
+  size_t mWidth[MAX_DIM]; // width of the margins
+  size_t mOrigin=0;       // flat index of the first interior entry
+
+private:
+
+  // hide functions
+  using cppmat::array<X>::resize;
+  using cppmat::array<X>::reshape;
+  using cppmat::array<X>::chrank;
+  using cppmat::array<X>::ravel;
+  using cppmat::array<X>::setPeriodic;
+
+public:
+
+  // constructor: default
+  array() = default;
+
+  // constructor: allocate (interior shape + margins), don't initialize
+  array(const std::vector<size_t> &shape, size_t width);
+  array(const std::vector<size_t> &shape, const std::vector<size_t> &width);
+
+  // named constructor: copy interior
+  static array<X> Copy(const cppmat::array<X> &A, size_t width);
+  static array<X> Copy(const cppmat::array<X> &A, const std::vector<size_t> &width);
+
+  // interior shape and width of the margins
+  size_t interiorSize() const;
+  size_t interiorShape(size_t i) const;
+  cppmat::shape_t interiorShape() const;
+  size_t width(size_t i) const;
+  cppmat::shape_t width() const;
+
+  // pointer to the first interior entry (neighbours are at "+/- strides()[i]")
+  X*       origin();
+  const X* origin() const;
+
+  // index operators: interior indices, negative (or beyond the interior shape) for ghost entries
+  X&       operator()(int a);
+  const X& operator()(int a) const;
+  X&       operator()(int a, int b);
+  const X& operator()(int a, int b) const;
+  X&       operator()(int a, int b, int c);
+  const X& operator()(int a, int b, int c) const;
+  X&       operator()(int a, int b, int c, int d);
+  const X& operator()(int a, int b, int c, int d) const;
+  X&       operator()(int a, int b, int c, int d, int e);
+  const X& operator()(int a, int b, int c, int d, int e) const;
+  X&       operator()(int a, int b, int c, int d, int e, int f);
+  const X& operator()(int a, int b, int c, int d, int e, int f) const;
+
+  // copy the interior from/to a plain array of the interior shape (no reallocation)
+  void setInterior(const cppmat::array<X> &A);
+  void copyInteriorTo(cppmat::array<X> &A) const;
+  cppmat::array<X> interior() const;
+
+  // refresh the ghost entries: periodic (corners included), or constant
+  void refreshPeriodic();
+  void refreshPeriodic(size_t axis);
+  void refreshConstant(X D);
+  void refreshConstant(size_t axis, X D);
+
+private:
+
+  // initialize the geometry
+  void init(const std::vector<size_t> &shape, const std::vector<size_t> &width);
+
+  // the storage as [outer, shape[axis], inner], with "inner" contiguous
+  size_t outer(size_t axis) const;
+  size_t inner(size_t axis) const;
+
+  // call "func(i, j)" for each interior row: "i" is the flat index in the interior, "j" the flat
+  // index in the storage (the last axis is contiguous)
+  template<class F> void forEachRow(F func) const;
+
+};
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -0,0 +1,548 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_VAR_HALO_ARRAY_HPP
+#define CPPMAT_VAR_HALO_ARRAY_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace halo {
+
+// =================================================================================================
+// constructors
+// =================================================================================================
+
+template<typename X>
+inline
+array<X>::array(const std::vector<size_t> &shape, size_t width)
+{
+  init(shape, std::vector<size_t>(shape.size(), width));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X>::array(const std::vector<size_t> &shape, const std::vector<size_t> &width)
+{
+  init(shape, width);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void array<X>::init(const std::vector<size_t> &shape, const std::vector<size_t> &width)
+{
+  assert( shape.size() == width.size() );
+  assert( shape.size() >= 1 );
+  assert( shape.size() <= MAX_DIM );
+
+  std::vector<size_t> padded(shape.size());
+
+  for ( size_t i = 0 ; i < shape.size() ; ++i )
+    padded[i] = shape[i] + 2 * width[i];
+
+  cppmat::array<X>::resize(padded);
+
+  for ( size_t i = 0 ; i < MAX_DIM ; ++i ) {
+    mInner[i] = 1;
+    mWidth[i] = 0;
+  }
+
+  for ( size_t i = 0 ; i < mRank ; ++i ) {
+    mInner[i] = shape[i];
+    mWidth[i] = width[i];
+  }
+
+  mOrigin = 0;
+
+  for ( size_t i = 0 ; i < mRank ; ++i )
+    mOrigin += mWidth[i] * mStrides[i];
+}
+
+// =================================================================================================
+// named constructors
+// =================================================================================================
+
+template<typename X>
+inline
+array<X> array<X>::Copy(const cppmat::array<X> &A, size_t width)
+{
+  array<X> out(A.shape(), width);
+
+  out.setInterior(A);
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> array<X>::Copy(const cppmat::array<X> &A, const std::vector<size_t> &width)
+{
+  array<X> out(A.shape(), width);
+
+  out.setInterior(A);
+
+  return out;
+}
+
+// =================================================================================================
+// get dimensions
+// =================================================================================================
+
+template<typename X>
+inline
+size_t array<X>::interiorSize() const
+{
+  size_t n = 1;
+
+  for ( size_t i = 0 ; i < mRank ; ++i )
+    n *= mInner[i];
+
+  return n;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t array<X>::interiorShape(size_t i) const
+{
+  assert( i < mRank );
+
+  return mInner[i];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::shape_t array<X>::interiorShape() const
+{
+  return cppmat::shape_t(std::begin(mInner), std::begin(mInner)+mRank);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t array<X>::width(size_t i) const
+{
+  assert( i < mRank );
+
+  return mWidth[i];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::shape_t array<X>::width() const
+{
+  return cppmat::shape_t(std::begin(mWidth), std::begin(mWidth)+mRank);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t array<X>::outer(size_t axis) const
+{
+  size_t n = 1;
+
+  for ( size_t i = 0 ; i < axis ; ++i )
+    n *= mShape[i];
+
+  return n;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t array<X>::inner(size_t axis) const
+{
+  return mStrides[axis];
+}
+
+// =================================================================================================
+// pointer to the first interior entry
+// =================================================================================================
+
+template<typename X>
+inline
+X* array<X>::origin()
+{
+  return mData.data() + mOrigin;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+const X* array<X>::origin() const
+{
+  return mData.data() + mOrigin;
+}
+
+// =================================================================================================
+// index operators
+// =================================================================================================
+
+template<typename X>
+inline
+X& array<X>::operator()(int a)
+{
+  assert( a >= -static_cast<int>(mWidth[0]) and a < static_cast<int>(mInner[0]+mWidth[0]) );
+
+  return mData[ mOrigin + a*static_cast<long>(mStrides[0]) ];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+const X& array<X>::operator()(int a) const
+{
+  assert( a >= -static_cast<int>(mWidth[0]) and a < static_cast<int>(mInner[0]+mWidth[0]) );
+
+  return mData[ mOrigin + a*static_cast<long>(mStrides[0]) ];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X& array<X>::operator()(int a, int b)
+{
+  assert( a >= -static_cast<int>(mWidth[0]) and a < static_cast<int>(mInner[0]+mWidth[0]) );
+  assert( b >= -static_cast<int>(mWidth[1]) and b < static_cast<int>(mInner[1]+mWidth[1]) );
+
+  return mData[ mOrigin + a*static_cast<long>(mStrides[0])
+                       + b*static_cast<long>(mStrides[1]) ];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+const X& array<X>::operator()(int a, int b) const
+{
+  assert( a >= -static_cast<int>(mWidth[0]) and a < static_cast<int>(mInner[0]+mWidth[0]) );
+  assert( b >= -static_cast<int>(mWidth[1]) and b < static_cast<int>(mInner[1]+mWidth[1]) );
+
+  return mData[ mOrigin + a*static_cast<long>(mStrides[0])
+                       + b*static_cast<long>(mStrides[1]) ];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X& array<X>::operator()(int a, int b, int c)
+{
+  assert( a >= -static_cast<int>(mWidth[0]) and a < static_cast<int>(mInner[0]+mWidth[0]) );
+  assert( b >= -static_cast<int>(mWidth[1]) and b < static_cast<int>(mInner[1]+mWidth[1]) );
+  assert( c >= -static_cast<int>(mWidth[2]) and c < static_cast<int>(mInner[2]+mWidth[2]) );
+
+  return mData[ mOrigin + a*static_cast<long>(mStrides[0])
+                       + b*static_cast<long>(mStrides[1])
+                       + c*static_cast<long>(mStrides[2]) ];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+const X& array<X>::operator()(int a, int b, int c) const
+{
+  assert( a >= -static_cast<int>(mWidth[0]) and a < static_cast<int>(mInner[0]+mWidth[0]) );
+  assert( b >= -static_cast<int>(mWidth[1]) and b < static_cast<int>(mInner[1]+mWidth[1]) );
+  assert( c >= -static_cast<int>(mWidth[2]) and c < static_cast<int>(mInner[2]+mWidth[2]) );
+
+  return mData[ mOrigin + a*static_cast<long>(mStrides[0])
+                       + b*static_cast<long>(mStrides[1])
+                       + c*static_cast<long>(mStrides[2]) ];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X& array<X>::operator()(int a, int b, int c, int d)
+{
+  assert( a >= -static_cast<int>(mWidth[0]) and a < static_cast<int>(mInner[0]+mWidth[0]) );
+  assert( b >= -static_cast<int>(mWidth[1]) and b < static_cast<int>(mInner[1]+mWidth[1]) );
+  assert( c >= -static_cast<int>(mWidth[2]) and c < static_cast<int>(mInner[2]+mWidth[2]) );
+  assert( d >= -static_cast<int>(mWidth[3]) and d < static_cast<int>(mInner[3]+mWidth[3]) );
+
+  return mData[ mOrigin + a*static_cast<long>(mStrides[0])
+                       + b*static_cast<long>(mStrides[1])
+                       + c*static_cast<long>(mStrides[2])
+                       + d*static_cast<long>(mStrides[3]) ];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+const X& array<X>::operator()(int a, int b, int c, int d) const
+{
+  assert( a >= -static_cast<int>(mWidth[0]) and a < static_cast<int>(mInner[0]+mWidth[0]) );
+  assert( b >= -static_cast<int>(mWidth[1]) and b < static_cast<int>(mInner[1]+mWidth[1]) );
+  assert( c >= -static_cast<int>(mWidth[2]) and c < static_cast<int>(mInner[2]+mWidth[2]) );
+  assert( d >= -static_cast<int>(mWidth[3]) and d < static_cast<int>(mInner[3]+mWidth[3]) );
+
+  return mData[ mOrigin + a*static_cast<long>(mStrides[0])
+                       + b*static_cast<long>(mStrides[1])
+                       + c*static_cast<long>(mStrides[2])
+                       + d*static_cast<long>(mStrides[3]) ];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X& array<X>::operator()(int a, int b, int c, int d, int e)
+{
+  assert( a >= -static_cast<int>(mWidth[0]) and a < static_cast<int>(mInner[0]+mWidth[0]) );
+  assert( b >= -static_cast<int>(mWidth[1]) and b < static_cast<int>(mInner[1]+mWidth[1]) );
+  assert( c >= -static_cast<int>(mWidth[2]) and c < static_cast<int>(mInner[2]+mWidth[2]) );
+  assert( d >= -static_cast<int>(mWidth[3]) and d < static_cast<int>(mInner[3]+mWidth[3]) );
+  assert( e >= -static_cast<int>(mWidth[4]) and e < static_cast<int>(mInner[4]+mWidth[4]) );
+
+  return mData[ mOrigin + a*static_cast<long>(mStrides[0])
+                       + b*static_cast<long>(mStrides[1])
+                       + c*static_cast<long>(mStrides[2])
+                       + d*static_cast<long>(mStrides[3])
+                       + e*static_cast<long>(mStrides[4]) ];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+const X& array<X>::operator()(int a, int b, int c, int d, int e) const
+{
+  assert( a >= -static_cast<int>(mWidth[0]) and a < static_cast<int>(mInner[0]+mWidth[0]) );
+  assert( b >= -static_cast<int>(mWidth[1]) and b < static_cast<int>(mInner[1]+mWidth[1]) );
+  assert( c >= -static_cast<int>(mWidth[2]) and c < static_cast<int>(mInner[2]+mWidth[2]) );
+  assert( d >= -static_cast<int>(mWidth[3]) and d < static_cast<int>(mInner[3]+mWidth[3]) );
+  assert( e >= -static_cast<int>(mWidth[4]) and e < static_cast<int>(mInner[4]+mWidth[4]) );
+
+  return mData[ mOrigin + a*static_cast<long>(mStrides[0])
+                       + b*static_cast<long>(mStrides[1])
+                       + c*static_cast<long>(mStrides[2])
+                       + d*static_cast<long>(mStrides[3])
+                       + e*static_cast<long>(mStrides[4]) ];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X& array<X>::operator()(int a, int b, int c, int d, int e, int f)
+{
+  assert( a >= -static_cast<int>(mWidth[0]) and a < static_cast<int>(mInner[0]+mWidth[0]) );
+  assert( b >= -static_cast<int>(mWidth[1]) and b < static_cast<int>(mInner[1]+mWidth[1]) );
+  assert( c >= -static_cast<int>(mWidth[2]) and c < static_cast<int>(mInner[2]+mWidth[2]) );
+  assert( d >= -static_cast<int>(mWidth[3]) and d < static_cast<int>(mInner[3]+mWidth[3]) );
+  assert( e >= -static_cast<int>(mWidth[4]) and e < static_cast<int>(mInner[4]+mWidth[4]) );
+  assert( f >= -static_cast<int>(mWidth[5]) and f < static_cast<int>(mInner[5]+mWidth[5]) );
+
+  return mData[ mOrigin + a*static_cast<long>(mStrides[0])
+                       + b*static_cast<long>(mStrides[1])
+                       + c*static_cast<long>(mStrides[2])
+                       + d*static_cast<long>(mStrides[3])
+                       + e*static_cast<long>(mStrides[4])
+                       + f*static_cast<long>(mStrides[5]) ];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+const X& array<X>::operator()(int a, int b, int c, int d, int e, int f) const
+{
+  assert( a >= -static_cast<int>(mWidth[0]) and a < static_cast<int>(mInner[0]+mWidth[0]) );
+  assert( b >= -static_cast<int>(mWidth[1]) and b < static_cast<int>(mInner[1]+mWidth[1]) );
+  assert( c >= -static_cast<int>(mWidth[2]) and c < static_cast<int>(mInner[2]+mWidth[2]) );
+  assert( d >= -static_cast<int>(mWidth[3]) and d < static_cast<int>(mInner[3]+mWidth[3]) );
+  assert( e >= -static_cast<int>(mWidth[4]) and e < static_cast<int>(mInner[4]+mWidth[4]) );
+  assert( f >= -static_cast<int>(mWidth[5]) and f < static_cast<int>(mInner[5]+mWidth[5]) );
+
+  return mData[ mOrigin + a*static_cast<long>(mStrides[0])
+                       + b*static_cast<long>(mStrides[1])
+                       + c*static_cast<long>(mStrides[2])
+                       + d*static_cast<long>(mStrides[3])
+                       + e*static_cast<long>(mStrides[4])
+                       + f*static_cast<long>(mStrides[5]) ];
+}
+
+// =================================================================================================
+// copy interior
+// =================================================================================================
+
+template<typename X>
+template<class F>
+inline
+void array<X>::forEachRow(F func) const
+{
+  // length of a row (the last axis)
+  size_t ncol = mInner[mRank-1];
+
+  // visit the rows (all axes but the last) of the interior, which is a strided view of the storage
+  cppmat::shape_t rows   (std::begin(mInner  ), std::begin(mInner  )+mRank-1);
+  cppmat::shape_t strides(std::begin(mStrides), std::begin(mStrides)+mRank-1);
+
+  for ( cppmat::multi_index<1> row(rows, {strides}, {mOrigin}) ; !row.end() ; ++row )
+    func(row.flat()*ncol, row.offset());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void array<X>::setInterior(const cppmat::array<X> &A)
+{
+  assert( A.shape() == interiorShape() );
+
+  size_t ncol = mInner[mRank-1];
+
+  forEachRow([&](size_t i, size_t j) {
+    std::copy(A.data()+i, A.data()+i+ncol, mData.begin()+j);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void array<X>::copyInteriorTo(cppmat::array<X> &A) const
+{
+  assert( A.shape() == interiorShape() );
+
+  size_t ncol = mInner[mRank-1];
+
+  forEachRow([&](size_t i, size_t j) {
+    std::copy(mData.begin()+j, mData.begin()+j+ncol, A.data()+i);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> array<X>::interior() const
+{
+  cppmat::array<X> out(interiorShape());
+
+  copyInteriorTo(out);
+
+  return out;
+}
+
+// =================================================================================================
+// refresh ghost entries
+// =================================================================================================
+
+template<typename X>
+inline
+void array<X>::refreshPeriodic(size_t axis)
+{
+  assert( axis < mRank );
+  assert( mWidth[axis] <= mInner[axis] );
+
+  size_t n  = mInner[axis];
+  size_t w  = mWidth[axis];
+  size_t m  = mShape[axis];
+  size_t no = outer(axis);
+  size_t ni = inner(axis);
+
+  if ( w == 0 ) return;
+
+  // storage as [no, m, ni]: copy slabs of "ni" contiguous entries
+  // - ghost "g"       <- interior "g+n" (the last "w" interior entries)
+  // - ghost "w+n+g"   <- interior "w+g" (the first "w" interior entries)
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static) if ( no > 1 )
+  #endif
+  for ( size_t o = 0 ; o < no ; ++o )
+  {
+    X *slab = mData.data() + o*m*ni;
+
+    for ( size_t g = 0 ; g < w ; ++g ) {
+      std::copy(slab+(g+n)*ni, slab+(g+n+1)*ni, slab+ g     *ni);
+      std::copy(slab+(w+g)*ni, slab+(w+g+1)*ni, slab+(w+n+g)*ni);
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void array<X>::refreshPeriodic()
+{
+  // axis-by-axis over the full (padded) extent of the other axes: also fills the corners
+  for ( size_t axis = 0 ; axis < mRank ; ++axis )
+    refreshPeriodic(axis);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void array<X>::refreshConstant(size_t axis, X D)
+{
+  assert( axis < mRank );
+
+  size_t n  = mInner[axis];
+  size_t w  = mWidth[axis];
+  size_t m  = mShape[axis];
+  size_t no = outer(axis);
+  size_t ni = inner(axis);
+
+  if ( w == 0 ) return;
+
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static) if ( no > 1 )
+  #endif
+  for ( size_t o = 0 ; o < no ; ++o )
+  {
+    X *slab = mData.data() + o*m*ni;
+
+    std::fill(slab        , slab+ w     *ni, D);
+    std::fill(slab+(w+n)*ni, slab+(w+n+w)*ni, D);
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void array<X>::refreshConstant(X D)
+{
+  for ( size_t axis = 0 ; axis < mRank ; ++axis )
+    refreshConstant(axis, D);
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -11,6 +11,197 @@
 
 #include "cppmat.h"
 
+// =================================================================================================
+// extra external arithmetic operators, writing to an output argument "C" (which is resized if
+// needed, i.e. it does not allocate if it already has the right shape; it may be one of the inputs)
+// =================================================================================================
+
+namespace cppmat {
+
+template<typename X>
+void mul(
+  const cppmat::matrix<X> &A,
+  const cppmat::symmetric::matrix<X> &B,
+  cppmat::matrix<X> &C
+);
+
+template<typename X>
+void div(
+  const cppmat::matrix<X> &A,
+  const cppmat::symmetric::matrix<X> &B,
+  cppmat::matrix<X> &C
+);
+
+template<typename X>
+void add(
+  const cppmat::matrix<X> &A,
+  const cppmat::symmetric::matrix<X> &B,
+  cppmat::matrix<X> &C
+);
+
+template<typename X>
+void sub(
+  const cppmat::matrix<X> &A,
+  const cppmat::symmetric::matrix<X> &B,
+  cppmat::matrix<X> &C
+);
+
+template<typename X>
+void add(
+  const cppmat::matrix<X> &A,
+  const cppmat::diagonal::matrix<X> &B,
+  cppmat::matrix<X> &C
+);
+
+template<typename X>
+void sub(
+  const cppmat::matrix<X> &A,
+  const cppmat::diagonal::matrix<X> &B,
+  cppmat::matrix<X> &C
+);
+
+template<typename X>
+void mul(
+  const cppmat::symmetric::matrix<X> &A,
+  const cppmat::matrix<X> &B,
+  cppmat::matrix<X> &C
+);
+
+template<typename X>
+void div(
+  const cppmat::symmetric::matrix<X> &A,
+  const cppmat::matrix<X> &B,
+  cppmat::matrix<X> &C
+);
+
+template<typename X>
+void add(
+  const cppmat::symmetric::matrix<X> &A,
+  const cppmat::matrix<X> &B,
+  cppmat::matrix<X> &C
+);
+
+template<typename X>
+void sub(
+  const cppmat::symmetric::matrix<X> &A,
+  const cppmat::matrix<X> &B,
+  cppmat::matrix<X> &C
+);
+
+template<typename X>
+void add(
+  const cppmat::diagonal::matrix<X> &A,
+  const cppmat::matrix<X> &B,
+  cppmat::matrix<X> &C
+);
+
+template<typename X>
+void sub(
+  const cppmat::diagonal::matrix<X> &A,
+  const cppmat::matrix<X> &B,
+  cppmat::matrix<X> &C
+);
+
+template<typename X>
+void add(
+  const cppmat::symmetric::matrix<X> &A,
+  const cppmat::diagonal::matrix<X> &B,
+  cppmat::symmetric::matrix<X> &C
+);
+
+template<typename X>
+void sub(
+  const cppmat::symmetric::matrix<X> &A,
+  const cppmat::diagonal::matrix<X> &B,
+  cppmat::symmetric::matrix<X> &C
+);
+
+template<typename X>
+void add(
+  const cppmat::diagonal::matrix<X> &A,
+  const X &B,
+  cppmat::symmetric::matrix<X> &C
+);
+
+template<typename X>
+void sub(
+  const cppmat::diagonal::matrix<X> &A,
+  const X &B,
+  cppmat::symmetric::matrix<X> &C
+);
+
+template<typename X>
+void add(
+  const cppmat::diagonal::matrix<X> &A,
+  const cppmat::symmetric::matrix<X> &B,
+  cppmat::symmetric::matrix<X> &C
+);
+
+template<typename X>
+void sub(
+  const cppmat::diagonal::matrix<X> &A,
+  const cppmat::symmetric::matrix<X> &B,
+  cppmat::symmetric::matrix<X> &C
+);
+
+template<typename X>
+void add(
+  const X &A,
+  const cppmat::diagonal::matrix<X> &B,
+  cppmat::symmetric::matrix<X> &C
+);
+
+template<typename X>
+void sub(
+  const X &A,
+  const cppmat::diagonal::matrix<X> &B,
+  cppmat::symmetric::matrix<X> &C
+);
+
+template<typename X>
+void mul(
+  const cppmat::diagonal::matrix<X> &A,
+  const cppmat::matrix<X> &B,
+  cppmat::diagonal::matrix<X> &C
+);
+
+template<typename X>
+void div(
+  const cppmat::diagonal::matrix<X> &A,
+  const cppmat::matrix<X> &B,
+  cppmat::diagonal::matrix<X> &C
+);
+
+template<typename X>
+void mul(
+  const cppmat::diagonal::matrix<X> &A,
+  const cppmat::symmetric::matrix<X> &B,
+  cppmat::diagonal::matrix<X> &C
+);
+
+template<typename X>
+void div(
+  const cppmat::diagonal::matrix<X> &A,
+  const cppmat::symmetric::matrix<X> &B,
+  cppmat::diagonal::matrix<X> &C
+);
+
+template<typename X>
+void mul(
+  const cppmat::matrix<X> &A,
+  const cppmat::diagonal::matrix<X> &B,
+  cppmat::diagonal::matrix<X> &C
+);
+
+template<typename X>
+void mul(
+  const cppmat::symmetric::matrix<X> &A,
+  const cppmat::diagonal::matrix<X> &B,
+  cppmat::diagonal::matrix<X> &C
+);
+
+} // namespace ...
+
 // =================================================================================================
 // extra external arithmetic operators -> cppmat::matrix
 // =================================================================================================
@@ -179,6 +370,142 @@ cppmat::diagonal::matrix<X> operator* (
   const cppmat::diagonal::matrix<X> &B
 );
 
+// =================================================================================================
+// extra external arithmetic operators, re-using the storage of a temporary (rvalue) operand
+// =================================================================================================
+
+template<typename X>
+cppmat::matrix<X> operator* (
+  cppmat::matrix<X> &&A,
+  const cppmat::symmetric::matrix<X> &B
+);
+
+template<typename X>
+cppmat::matrix<X> operator/ (
+  cppmat::matrix<X> &&A,
+  const cppmat::symmetric::matrix<X> &B
+);
+
+template<typename X>
+cppmat::matrix<X> operator+ (
+  cppmat::matrix<X> &&A,
+  const cppmat::symmetric::matrix<X> &B
+);
+
+template<typename X>
+cppmat::matrix<X> operator- (
+  cppmat::matrix<X> &&A,
+  const cppmat::symmetric::matrix<X> &B
+);
+
+template<typename X>
+cppmat::matrix<X> operator+ (
+  cppmat::matrix<X> &&A,
+  const cppmat::diagonal::matrix<X> &B
+);
+
+template<typename X>
+cppmat::matrix<X> operator- (
+  cppmat::matrix<X> &&A,
+  const cppmat::diagonal::matrix<X> &B
+);
+
+template<typename X>
+cppmat::matrix<X> operator* (
+  const cppmat::symmetric::matrix<X> &A,
+  cppmat::matrix<X> &&B
+);
+
+template<typename X>
+cppmat::matrix<X> operator/ (
+  const cppmat::symmetric::matrix<X> &A,
+  cppmat::matrix<X> &&B
+);
+
+template<typename X>
+cppmat::matrix<X> operator+ (
+  const cppmat::symmetric::matrix<X> &A,
+  cppmat::matrix<X> &&B
+);
+
+template<typename X>
+cppmat::matrix<X> operator- (
+  const cppmat::symmetric::matrix<X> &A,
+  cppmat::matrix<X> &&B
+);
+
+template<typename X>
+cppmat::matrix<X> operator+ (
+  const cppmat::diagonal::matrix<X> &A,
+  cppmat::matrix<X> &&B
+);
+
+template<typename X>
+cppmat::matrix<X> operator- (
+  const cppmat::diagonal::matrix<X> &A,
+  cppmat::matrix<X> &&B
+);
+
+template<typename X>
+cppmat::symmetric::matrix<X> operator+ (
+  cppmat::symmetric::matrix<X> &&A,
+  const cppmat::diagonal::matrix<X> &B
+);
+
+template<typename X>
+cppmat::symmetric::matrix<X> operator- (
+  cppmat::symmetric::matrix<X> &&A,
+  const cppmat::diagonal::matrix<X> &B
+);
+
+template<typename X>
+cppmat::symmetric::matrix<X> operator+ (
+  const cppmat::diagonal::matrix<X> &A,
+  cppmat::symmetric::matrix<X> &&B
+);
+
+template<typename X>
+cppmat::symmetric::matrix<X> operator- (
+  const cppmat::diagonal::matrix<X> &A,
+  cppmat::symmetric::matrix<X> &&B
+);
+
+template<typename X>
+cppmat::diagonal::matrix<X> operator* (
+  cppmat::diagonal::matrix<X> &&A,
+  const cppmat::matrix<X> &B
+);
+
+template<typename X>
+cppmat::diagonal::matrix<X> operator/ (
+  cppmat::diagonal::matrix<X> &&A,
+  const cppmat::matrix<X> &B
+);
+
+template<typename X>
+cppmat::diagonal::matrix<X> operator* (
+  cppmat::diagonal::matrix<X> &&A,
+  const cppmat::symmetric::matrix<X> &B
+);
+
+template<typename X>
+cppmat::diagonal::matrix<X> operator/ (
+  cppmat::diagonal::matrix<X> &&A,
+  const cppmat::symmetric::matrix<X> &B
+);
+
+template<typename X>
+cppmat::diagonal::matrix<X> operator* (
+  const cppmat::matrix<X> &A,
+  cppmat::diagonal::matrix<X> &&B
+);
+
+template<typename X>
+cppmat::diagonal::matrix<X> operator* (
+  const cppmat::symmetric::matrix<X> &A,
+  cppmat::diagonal::matrix<X> &&B
+);
+
 // =================================================================================================
 
 #endif
@@ -306,21 +306,24 @@ cppmat::diagonal::matrix<X>::operator/= (
 }
 
 // =================================================================================================
-// extra external arithmetic operators -> cppmat::matrix
+// extra external arithmetic operators, writing to an output argument
 // =================================================================================================
 
+namespace cppmat {
+
 template<typename X>
 inline
-cppmat::matrix<X> operator* (
+void mul(
   const cppmat::matrix<X> &A,
-  const cppmat::symmetric::matrix<X> &B
+  const cppmat::symmetric::matrix<X> &B,
+  cppmat::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i ) {
     for ( size_t j = i ; j < N ; ++j ) {
@@ -331,24 +334,23 @@ cppmat::matrix<X> operator* (
       if ( i != j ) C[ j*N + i ] = A[ j*N + i ] * b;
     }
   }
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::matrix<X> operator/ (
+void div(
   const cppmat::matrix<X> &A,
-  const cppmat::symmetric::matrix<X> &B
+  const cppmat::symmetric::matrix<X> &B,
+  cppmat::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i ) {
     for ( size_t j = i ; j < N ; ++j ) {
@@ -359,24 +361,23 @@ cppmat::matrix<X> operator/ (
       if ( i != j ) C[ j*N + i ] = A[ j*N + i ] / b;
     }
   }
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::matrix<X> operator+ (
+void add(
   const cppmat::matrix<X> &A,
-  const cppmat::symmetric::matrix<X> &B
+  const cppmat::symmetric::matrix<X> &B,
+  cppmat::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i ) {
     for ( size_t j = i ; j < N ; ++j ) {
@@ -387,24 +388,23 @@ cppmat::matrix<X> operator+ (
       if ( i != j ) C[ j*N + i ] = A[ j*N + i ] + b;
     }
   }
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::matrix<X> operator- (
+void sub(
   const cppmat::matrix<X> &A,
-  const cppmat::symmetric::matrix<X> &B
+  const cppmat::symmetric::matrix<X> &B,
+  cppmat::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i ) {
     for ( size_t j = i ; j < N ; ++j ) {
@@ -415,24 +415,23 @@ cppmat::matrix<X> operator- (
       if ( i != j ) C[ j*N + i ] = A[ j*N + i ] - b;
     }
   }
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::matrix<X> operator+ (
+void add(
   const cppmat::matrix<X> &A,
-  const cppmat::diagonal::matrix<X> &B
+  const cppmat::diagonal::matrix<X> &B,
+  cppmat::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i ) {
     for ( size_t j = 0 ; j < N ; ++j ) {
@@ -440,24 +439,23 @@ cppmat::matrix<X> operator+ (
       else          C[ i*N + j ] = A[ i*N + j ];
     }
   }
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::matrix<X> operator- (
+void sub(
   const cppmat::matrix<X> &A,
-  const cppmat::diagonal::matrix<X> &B
+  const cppmat::diagonal::matrix<X> &B,
+  cppmat::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i ) {
     for ( size_t j = 0 ; j < N ; ++j ) {
@@ -465,24 +463,23 @@ cppmat::matrix<X> operator- (
       else          C[ i*N + j ] = A[ i*N + j ];
     }
   }
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::matrix<X> operator* (
+void mul(
   const cppmat::symmetric::matrix<X> &A,
-  const cppmat::matrix<X> &B
+  const cppmat::matrix<X> &B,
+  cppmat::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i ) {
     for ( size_t j = i ; j < N ; ++j ) {
@@ -493,24 +490,23 @@ cppmat::matrix<X> operator* (
       if ( i != j ) C[ j*N + i ] = a * B[ j*N + i ];
     }
   }
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::matrix<X> operator/ (
+void div(
   const cppmat::symmetric::matrix<X> &A,
-  const cppmat::matrix<X> &B
+  const cppmat::matrix<X> &B,
+  cppmat::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i ) {
     for ( size_t j = i ; j < N ; ++j ) {
@@ -521,24 +517,23 @@ cppmat::matrix<X> operator/ (
       if ( i != j ) C[ j*N + i ] = a / B[ j*N + i ];
     }
   }
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::matrix<X> operator+ (
+void add(
   const cppmat::symmetric::matrix<X> &A,
-  const cppmat::matrix<X> &B
+  const cppmat::matrix<X> &B,
+  cppmat::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i ) {
     for ( size_t j = i ; j < N ; ++j ) {
@@ -549,24 +544,23 @@ cppmat::matrix<X> operator+ (
       if ( i != j ) C[ j*N + i ] = a + B[ j*N + i ];
     }
   }
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::matrix<X> operator- (
+void sub(
   const cppmat::symmetric::matrix<X> &A,
-  const cppmat::matrix<X> &B
+  const cppmat::matrix<X> &B,
+  cppmat::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i ) {
     for ( size_t j = i ; j < N ; ++j ) {
@@ -577,24 +571,23 @@ cppmat::matrix<X> operator- (
       if ( i != j ) C[ j*N + i ] = a - B[ j*N + i ];
     }
   }
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::matrix<X> operator+ (
+void add(
   const cppmat::diagonal::matrix<X> &A,
-  const cppmat::matrix<X> &B
+  const cppmat::matrix<X> &B,
+  cppmat::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i ) {
     for ( size_t j = 0 ; j < N ; ++j ) {
@@ -602,24 +595,23 @@ cppmat::matrix<X> operator+ (
       else          C[ i*N + j ] =          B[ i*N + j ];
     }
   }
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::matrix<X> operator- (
+void sub(
   const cppmat::diagonal::matrix<X> &A,
-  const cppmat::matrix<X> &B
+  const cppmat::matrix<X> &B,
+  cppmat::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i ) {
     for ( size_t j = 0 ; j < N ; ++j ) {
@@ -627,26 +619,23 @@ cppmat::matrix<X> operator- (
       else          C[ i*N + j ] =        - B[ i*N + j ];
     }
   }
-
-  return C;
 }
 
-// =================================================================================================
-// extra external arithmetic operators -> cppmat::symmetric::matrix
-// =================================================================================================
+// -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::symmetric::matrix<X> operator+ (
+void add(
   const cppmat::symmetric::matrix<X> &A,
-  const cppmat::diagonal::matrix<X> &B
+  const cppmat::diagonal::matrix<X> &B,
+  cppmat::symmetric::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::symmetric::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i ) {
     for ( size_t j = i ; j < N ; ++j ) {
@@ -654,24 +643,23 @@ cppmat::symmetric::matrix<X> operator+ (
       else          C[ i*N - (i-1)*i/2 + j - i ] = A[ i*N - (i-1)*i/2 + j - i ];
     }
   }
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::symmetric::matrix<X> operator- (
+void sub(
   const cppmat::symmetric::matrix<X> &A,
-  const cppmat::diagonal::matrix<X> &B
+  const cppmat::diagonal::matrix<X> &B,
+  cppmat::symmetric::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::symmetric::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i ) {
     for ( size_t j = i ; j < N ; ++j ) {
@@ -679,22 +667,21 @@ cppmat::symmetric::matrix<X> operator- (
       else          C[ i*N - (i-1)*i/2 + j - i ] = A[ i*N - (i-1)*i/2 + j - i ];
     }
   }
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::symmetric::matrix<X> operator+ (
+void add(
   const cppmat::diagonal::matrix<X> &A,
-  const X &B
+  const X &B,
+  cppmat::symmetric::matrix<X> &C
 )
 {
   size_t N = A.shape(0);
 
-  cppmat::symmetric::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i ) {
     for ( size_t j = i ; j < N ; ++j ) {
@@ -702,22 +689,21 @@ cppmat::symmetric::matrix<X> operator+ (
       else          C[ i*N - (i-1)*i/2 + j - i ] =          B;
     }
   }
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::symmetric::matrix<X> operator- (
+void sub(
   const cppmat::diagonal::matrix<X> &A,
-  const X &B
+  const X &B,
+  cppmat::symmetric::matrix<X> &C
 )
 {
   size_t N = A.shape(0);
 
-  cppmat::symmetric::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i ) {
     for ( size_t j = i ; j < N ; ++j ) {
@@ -725,24 +711,23 @@ cppmat::symmetric::matrix<X> operator- (
       else          C[ i*N - (i-1)*i/2 + j - i ] =        - B;
     }
   }
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::symmetric::matrix<X> operator+ (
+void add(
   const cppmat::diagonal::matrix<X> &A,
-  const cppmat::symmetric::matrix<X> &B
+  const cppmat::symmetric::matrix<X> &B,
+  cppmat::symmetric::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::symmetric::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i ) {
     for ( size_t j = i ; j < N ; ++j ) {
@@ -750,24 +735,23 @@ cppmat::symmetric::matrix<X> operator+ (
       else          C[ i*N - (i-1)*i/2 + j - i ] =          B[ i*N - (i-1)*i/2 + j - i ];
     }
   }
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::symmetric::matrix<X> operator- (
+void sub(
   const cppmat::diagonal::matrix<X> &A,
-  const cppmat::symmetric::matrix<X> &B
+  const cppmat::symmetric::matrix<X> &B,
+  cppmat::symmetric::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::symmetric::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i ) {
     for ( size_t j = i ; j < N ; ++j ) {
@@ -775,22 +759,21 @@ cppmat::symmetric::matrix<X> operator- (
       else          C[ i*N - (i-1)*i/2 + j - i ] =        - B[ i*N - (i-1)*i/2 + j - i ];
     }
   }
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::symmetric::matrix<X> operator+ (
+void add(
   const X &A,
-  const cppmat::diagonal::matrix<X> &B
+  const cppmat::diagonal::matrix<X> &B,
+  cppmat::symmetric::matrix<X> &C
 )
 {
   size_t N = B.shape(0);
 
-  cppmat::symmetric::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i ) {
     for ( size_t j = i ; j < N ; ++j ) {
@@ -798,22 +781,21 @@ cppmat::symmetric::matrix<X> operator+ (
       else          C[ i*N - (i-1)*i/2 + j - i ] = A;
     }
   }
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::symmetric::matrix<X> operator- (
+void sub(
   const X &A,
-  const cppmat::diagonal::matrix<X> &B
+  const cppmat::diagonal::matrix<X> &B,
+  cppmat::symmetric::matrix<X> &C
 )
 {
   size_t N = B.shape(0);
 
-  cppmat::symmetric::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i ) {
     for ( size_t j = i ; j < N ; ++j ) {
@@ -821,138 +803,862 @@ cppmat::symmetric::matrix<X> operator- (
       else          C[ i*N - (i-1)*i/2 + j - i ] = A;
     }
   }
-
-  return C;
 }
 
-// =================================================================================================
-// extra external arithmetic operators -> cppmat::diagonal::matrix
-// =================================================================================================
+// -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::diagonal::matrix<X> operator* (
+void mul(
   const cppmat::diagonal::matrix<X> &A,
-  const cppmat::matrix<X> &B
+  const cppmat::matrix<X> &B,
+  cppmat::diagonal::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::diagonal::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i )
     C[i] = A[i] * B[ i*N + i ];
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::diagonal::matrix<X> operator/ (
+void div(
   const cppmat::diagonal::matrix<X> &A,
-  const cppmat::matrix<X> &B
+  const cppmat::matrix<X> &B,
+  cppmat::diagonal::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::diagonal::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i )
     C[i] = A[i] / B[ i*N + i ];
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::diagonal::matrix<X> operator* (
+void mul(
   const cppmat::diagonal::matrix<X> &A,
-  const cppmat::symmetric::matrix<X> &B
+  const cppmat::symmetric::matrix<X> &B,
+  cppmat::diagonal::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::diagonal::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i )
     C[i] = A[i] * B[ i*N - (i-1)*i/2 ];
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::diagonal::matrix<X> operator/ (
+void div(
   const cppmat::diagonal::matrix<X> &A,
-  const cppmat::symmetric::matrix<X> &B
+  const cppmat::symmetric::matrix<X> &B,
+  cppmat::diagonal::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::diagonal::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i )
     C[i] = A[i] / B[ i*N - (i-1)*i/2 ];
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::diagonal::matrix<X> operator* (
+void mul(
   const cppmat::matrix<X> &A,
-  const cppmat::diagonal::matrix<X> &B
+  const cppmat::diagonal::matrix<X> &B,
+  cppmat::diagonal::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::diagonal::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i )
     C[i] = A[ i*N + i ] * B[i];
-
-  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-cppmat::diagonal::matrix<X> operator* (
+void mul(
   const cppmat::symmetric::matrix<X> &A,
-  const cppmat::diagonal::matrix<X> &B
+  const cppmat::diagonal::matrix<X> &B,
+  cppmat::diagonal::matrix<X> &C
 )
 {
   assert( A.shape() == B.shape() );
 
   size_t N = A.shape(0);
 
-  cppmat::diagonal::matrix<X> C(N,N);
+  C.resize(N,N);
 
   for ( size_t i = 0 ; i < N ; ++i )
     C[i] = A[ i*N - (i-1)*i/2 ] * B[i];
+}
+
+} // namespace ...
+
+// =================================================================================================
+// extra external arithmetic operators -> cppmat::matrix
+// =================================================================================================
+
+template<typename X>
+inline
+cppmat::matrix<X> operator* (
+  const cppmat::matrix<X> &A,
+  const cppmat::symmetric::matrix<X> &B
+)
+{
+  cppmat::matrix<X> C;
+
+  cppmat::mul(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator/ (
+  const cppmat::matrix<X> &A,
+  const cppmat::symmetric::matrix<X> &B
+)
+{
+  cppmat::matrix<X> C;
+
+  cppmat::div(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator+ (
+  const cppmat::matrix<X> &A,
+  const cppmat::symmetric::matrix<X> &B
+)
+{
+  cppmat::matrix<X> C;
+
+  cppmat::add(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator- (
+  const cppmat::matrix<X> &A,
+  const cppmat::symmetric::matrix<X> &B
+)
+{
+  cppmat::matrix<X> C;
+
+  cppmat::sub(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator+ (
+  const cppmat::matrix<X> &A,
+  const cppmat::diagonal::matrix<X> &B
+)
+{
+  cppmat::matrix<X> C;
+
+  cppmat::add(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator- (
+  const cppmat::matrix<X> &A,
+  const cppmat::diagonal::matrix<X> &B
+)
+{
+  cppmat::matrix<X> C;
+
+  cppmat::sub(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator* (
+  const cppmat::symmetric::matrix<X> &A,
+  const cppmat::matrix<X> &B
+)
+{
+  cppmat::matrix<X> C;
+
+  cppmat::mul(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator/ (
+  const cppmat::symmetric::matrix<X> &A,
+  const cppmat::matrix<X> &B
+)
+{
+  cppmat::matrix<X> C;
+
+  cppmat::div(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator+ (
+  const cppmat::symmetric::matrix<X> &A,
+  const cppmat::matrix<X> &B
+)
+{
+  cppmat::matrix<X> C;
+
+  cppmat::add(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator- (
+  const cppmat::symmetric::matrix<X> &A,
+  const cppmat::matrix<X> &B
+)
+{
+  cppmat::matrix<X> C;
+
+  cppmat::sub(A, B, C);
 
   return C;
 }
 
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator+ (
+  const cppmat::diagonal::matrix<X> &A,
+  const cppmat::matrix<X> &B
+)
+{
+  cppmat::matrix<X> C;
+
+  cppmat::add(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator- (
+  const cppmat::diagonal::matrix<X> &A,
+  const cppmat::matrix<X> &B
+)
+{
+  cppmat::matrix<X> C;
+
+  cppmat::sub(A, B, C);
+
+  return C;
+}
+
+// =================================================================================================
+// extra external arithmetic operators -> cppmat::symmetric::matrix
+// =================================================================================================
+
+template<typename X>
+inline
+cppmat::symmetric::matrix<X> operator+ (
+  const cppmat::symmetric::matrix<X> &A,
+  const cppmat::diagonal::matrix<X> &B
+)
+{
+  cppmat::symmetric::matrix<X> C;
+
+  cppmat::add(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::symmetric::matrix<X> operator- (
+  const cppmat::symmetric::matrix<X> &A,
+  const cppmat::diagonal::matrix<X> &B
+)
+{
+  cppmat::symmetric::matrix<X> C;
+
+  cppmat::sub(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::symmetric::matrix<X> operator+ (
+  const cppmat::diagonal::matrix<X> &A,
+  const X &B
+)
+{
+  cppmat::symmetric::matrix<X> C;
+
+  cppmat::add(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::symmetric::matrix<X> operator- (
+  const cppmat::diagonal::matrix<X> &A,
+  const X &B
+)
+{
+  cppmat::symmetric::matrix<X> C;
+
+  cppmat::sub(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::symmetric::matrix<X> operator+ (
+  const cppmat::diagonal::matrix<X> &A,
+  const cppmat::symmetric::matrix<X> &B
+)
+{
+  cppmat::symmetric::matrix<X> C;
+
+  cppmat::add(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::symmetric::matrix<X> operator- (
+  const cppmat::diagonal::matrix<X> &A,
+  const cppmat::symmetric::matrix<X> &B
+)
+{
+  cppmat::symmetric::matrix<X> C;
+
+  cppmat::sub(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::symmetric::matrix<X> operator+ (
+  const X &A,
+  const cppmat::diagonal::matrix<X> &B
+)
+{
+  cppmat::symmetric::matrix<X> C;
+
+  cppmat::add(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::symmetric::matrix<X> operator- (
+  const X &A,
+  const cppmat::diagonal::matrix<X> &B
+)
+{
+  cppmat::symmetric::matrix<X> C;
+
+  cppmat::sub(A, B, C);
+
+  return C;
+}
+
+// =================================================================================================
+// extra external arithmetic operators -> cppmat::diagonal::matrix
+// =================================================================================================
+
+template<typename X>
+inline
+cppmat::diagonal::matrix<X> operator* (
+  const cppmat::diagonal::matrix<X> &A,
+  const cppmat::matrix<X> &B
+)
+{
+  cppmat::diagonal::matrix<X> C;
+
+  cppmat::mul(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::diagonal::matrix<X> operator/ (
+  const cppmat::diagonal::matrix<X> &A,
+  const cppmat::matrix<X> &B
+)
+{
+  cppmat::diagonal::matrix<X> C;
+
+  cppmat::div(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::diagonal::matrix<X> operator* (
+  const cppmat::diagonal::matrix<X> &A,
+  const cppmat::symmetric::matrix<X> &B
+)
+{
+  cppmat::diagonal::matrix<X> C;
+
+  cppmat::mul(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::diagonal::matrix<X> operator/ (
+  const cppmat::diagonal::matrix<X> &A,
+  const cppmat::symmetric::matrix<X> &B
+)
+{
+  cppmat::diagonal::matrix<X> C;
+
+  cppmat::div(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::diagonal::matrix<X> operator* (
+  const cppmat::matrix<X> &A,
+  const cppmat::diagonal::matrix<X> &B
+)
+{
+  cppmat::diagonal::matrix<X> C;
+
+  cppmat::mul(A, B, C);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::diagonal::matrix<X> operator* (
+  const cppmat::symmetric::matrix<X> &A,
+  const cppmat::diagonal::matrix<X> &B
+)
+{
+  cppmat::diagonal::matrix<X> C;
+
+  cppmat::mul(A, B, C);
+
+  return C;
+}
+
+// =================================================================================================
+// extra external arithmetic operators, re-using the storage of a temporary (rvalue) operand
+// =================================================================================================
+
+template<typename X>
+inline
+cppmat::matrix<X> operator* (
+  cppmat::matrix<X> &&A,
+  const cppmat::symmetric::matrix<X> &B
+)
+{
+  cppmat::mul(A, B, A);
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator/ (
+  cppmat::matrix<X> &&A,
+  const cppmat::symmetric::matrix<X> &B
+)
+{
+  cppmat::div(A, B, A);
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator+ (
+  cppmat::matrix<X> &&A,
+  const cppmat::symmetric::matrix<X> &B
+)
+{
+  cppmat::add(A, B, A);
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator- (
+  cppmat::matrix<X> &&A,
+  const cppmat::symmetric::matrix<X> &B
+)
+{
+  cppmat::sub(A, B, A);
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator+ (
+  cppmat::matrix<X> &&A,
+  const cppmat::diagonal::matrix<X> &B
+)
+{
+  cppmat::add(A, B, A);
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator- (
+  cppmat::matrix<X> &&A,
+  const cppmat::diagonal::matrix<X> &B
+)
+{
+  cppmat::sub(A, B, A);
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator* (
+  const cppmat::symmetric::matrix<X> &A,
+  cppmat::matrix<X> &&B
+)
+{
+  cppmat::mul(A, B, B);
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator/ (
+  const cppmat::symmetric::matrix<X> &A,
+  cppmat::matrix<X> &&B
+)
+{
+  cppmat::div(A, B, B);
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator+ (
+  const cppmat::symmetric::matrix<X> &A,
+  cppmat::matrix<X> &&B
+)
+{
+  cppmat::add(A, B, B);
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator- (
+  const cppmat::symmetric::matrix<X> &A,
+  cppmat::matrix<X> &&B
+)
+{
+  cppmat::sub(A, B, B);
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator+ (
+  const cppmat::diagonal::matrix<X> &A,
+  cppmat::matrix<X> &&B
+)
+{
+  cppmat::add(A, B, B);
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> operator- (
+  const cppmat::diagonal::matrix<X> &A,
+  cppmat::matrix<X> &&B
+)
+{
+  cppmat::sub(A, B, B);
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::symmetric::matrix<X> operator+ (
+  cppmat::symmetric::matrix<X> &&A,
+  const cppmat::diagonal::matrix<X> &B
+)
+{
+  cppmat::add(A, B, A);
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::symmetric::matrix<X> operator- (
+  cppmat::symmetric::matrix<X> &&A,
+  const cppmat::diagonal::matrix<X> &B
+)
+{
+  cppmat::sub(A, B, A);
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::symmetric::matrix<X> operator+ (
+  const cppmat::diagonal::matrix<X> &A,
+  cppmat::symmetric::matrix<X> &&B
+)
+{
+  cppmat::add(A, B, B);
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::symmetric::matrix<X> operator- (
+  const cppmat::diagonal::matrix<X> &A,
+  cppmat::symmetric::matrix<X> &&B
+)
+{
+  cppmat::sub(A, B, B);
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::diagonal::matrix<X> operator* (
+  cppmat::diagonal::matrix<X> &&A,
+  const cppmat::matrix<X> &B
+)
+{
+  cppmat::mul(A, B, A);
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::diagonal::matrix<X> operator/ (
+  cppmat::diagonal::matrix<X> &&A,
+  const cppmat::matrix<X> &B
+)
+{
+  cppmat::div(A, B, A);
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::diagonal::matrix<X> operator* (
+  cppmat::diagonal::matrix<X> &&A,
+  const cppmat::symmetric::matrix<X> &B
+)
+{
+  cppmat::mul(A, B, A);
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::diagonal::matrix<X> operator/ (
+  cppmat::diagonal::matrix<X> &&A,
+  const cppmat::symmetric::matrix<X> &B
+)
+{
+  cppmat::div(A, B, A);
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::diagonal::matrix<X> operator* (
+  const cppmat::matrix<X> &A,
+  cppmat::diagonal::matrix<X> &&B
+)
+{
+  cppmat::mul(A, B, B);
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::diagonal::matrix<X> operator* (
+  const cppmat::symmetric::matrix<X> &A,
+  cppmat::diagonal::matrix<X> &&B
+)
+{
+  cppmat::mul(A, B, B);
+
+  return std::move(B);
+}
+
 // =================================================================================================
 
 #endif
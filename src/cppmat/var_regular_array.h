@@ -24,13 +24,15 @@ class array
 {
 protected:
 
-  static const size_t MAX_DIM=6;    // maximum number of dimensions
-  size_t         mSize=0;           // total size == data.size() == prod(shape)
-  size_t         mRank=0;           // rank (number of axes)
-  size_t         mShape[MAX_DIM];   // number of entries along each axis
-  size_t         mStrides[MAX_DIM]; // stride length for each index
-  std::vector<X> mData;             // data container
-  bool           mPeriodic=false;   // if true: disable bounds-check where possible
+  static const size_t MAX_DIM=6;                       // number of axes always stored (padded)
+  size_t          mSize=0;                             // total size == data.size() == prod(shape)
+  size_t          mRank=0;                             // rank (number of axes, arbitrary)
+  cppmat::shape_t mShape  =cppmat::shape_t(MAX_DIM,1); // number of entries along each axis
+  cppmat::shape_t mStrides=cppmat::shape_t(MAX_DIM,1); // stride length for each index
+  bool            mPeriodic=false;                     // if true: disable bounds-check if possible
+
+  // data container
+  cppmat::small_vector<X,cppmat::inline_size<X>::value> mData;
 
 public:
 
@@ -38,7 +40,7 @@ public:
   array() = default;
 
   // constructor: allocate, don't initialize
-  array(const std::vector<size_t> &shape);
+  array(const cppmat::shape_t &shape);
 
   // constructor: copy from own class (with different type)
   template<typename U, typename=typename std::enable_if<std::is_convertible<U,X>::value>::type>
@@ -53,25 +55,25 @@ public:
   array(const cppmat::view::array<X,rank,i,j,k,l,m,n> &A);
 
   // named constructor: initialize
-  static array<X> Random  (const std::vector<size_t> &shape, X lower=(X)0, X upper=(X)1);
-  static array<X> Arange  (const std::vector<size_t> &shape);
-  static array<X> Zero    (const std::vector<size_t> &shape);
-  static array<X> Ones    (const std::vector<size_t> &shape);
-  static array<X> Constant(const std::vector<size_t> &shape, X D);
-  static array<X> Copy    (const std::vector<size_t> &shape, const std::vector<X> &D);
+  static array<X> Random  (const cppmat::shape_t &shape, X lower=(X)0, X upper=(X)1);
+  static array<X> Arange  (const cppmat::shape_t &shape);
+  static array<X> Zero    (const cppmat::shape_t &shape);
+  static array<X> Ones    (const cppmat::shape_t &shape);
+  static array<X> Constant(const cppmat::shape_t &shape, X D);
+  static array<X> Copy    (const cppmat::shape_t &shape, const std::vector<X> &D);
 
   // named constructor: copy
-  template<typename It> static array<X> Copy(const std::vector<size_t> &shape, It first);
-  template<typename It> static array<X> Copy(const std::vector<size_t> &shape, It first, It last);
+  template<typename It> static array<X> Copy(const cppmat::shape_t &shape, It first);
+  template<typename It> static array<X> Copy(const cppmat::shape_t &shape, It first, It last);
 
   // return plain storage as vector
   template<typename U, typename=typename std::enable_if<std::is_convertible<U,X>::value>::type>
   operator std::vector<U> () const;
 
   // resize
-  void resize (const std::vector<size_t> &shape);
-  void resize (const std::vector<size_t> &shape, const X &D);
-  void reshape(const std::vector<size_t> &shape);
+  void resize (const cppmat::shape_t &shape);
+  void resize (const cppmat::shape_t &shape, const X &D);
+  void reshape(const cppmat::shape_t &shape);
   void chrank (size_t rank);
   void ravel  ();
 
@@ -83,8 +85,8 @@ public:
   size_t rank() const;
   size_t shape(int    i) const;
   size_t shape(size_t i) const;
-  std::vector<size_t> shape() const;
-  std::vector<size_t> strides(bool bytes=false) const;
+  cppmat::shape_t shape() const;
+  cppmat::shape_t strides(bool bytes=false) const;
 
   // get using a different return type
   template<typename U> U size() const;
@@ -149,6 +151,13 @@ public:
   template<typename T, typename=typename std::enable_if<std::is_unsigned<T>::value,void>::type>
   const X& operator()(T a, T b, T c, T d, T e, T f) const;
 
+  // index operators: access using an arbitrary number of array-indices (rank > 6)
+  template<typename... T, typename=typename std::enable_if<(sizeof...(T)>6),void>::type>
+  X&       operator()(T... idx);
+
+  template<typename... T, typename=typename std::enable_if<(sizeof...(T)>6),void>::type>
+  const X& operator()(T... idx) const;
+
   // index operators: access using iterator
   // N.B. the iterator points to list of array-indices (a,b,c,...)
   template<class Iterator> X&       at(Iterator first, Iterator last);
@@ -181,6 +190,10 @@ public:
   template<typename T, typename=typename std::enable_if<std::is_unsigned<T>::value,void>::type>
   size_t compress(T a, T b, T c, T d, T e, T f) const;
 
+  // index operators: an arbitrary number of array-indices -> plain storage (rank > 6)
+  template<typename... T, typename=typename std::enable_if<(sizeof...(T)>6),void>::type>
+  size_t compress(T... idx) const;
+
   // index operators: plain storage -> array-indices (i -> a,b,c,...)
   std::vector<size_t> decompress(size_t i) const;
 
@@ -350,6 +363,79 @@ public:
   array<X> average(const array<X> &weights, size_t axis,                  bool norm=true) const;
   array<X> average(const array<X> &weights, const std::vector<int> &axes, bool norm=true) const;
 
+  // (weighted) moments, computed in a single pass (see "cppmat::moments")
+  cppmat::moments                moments() const;
+  cppmat::array<cppmat::moments> moments(int    axis) const;
+  cppmat::array<cppmat::moments> moments(size_t axis) const;
+  cppmat::array<cppmat::moments> moments(const std::vector<int> &axes) const;
+  cppmat::moments                moments(const array<X> &weights) const;
+  cppmat::array<cppmat::moments> moments(const array<X> &weights, int    axis) const;
+  cppmat::array<cppmat::moments> moments(const array<X> &weights, size_t axis) const;
+  cppmat::array<cppmat::moments> moments(
+    const array<X> &weights, const std::vector<int> &axes) const;
+
+  // variance, standard deviation, skewness, and excess kurtosis (from "moments"); the weights are
+  // as in "average"; the result is "double" also along axes (and for an integer "X")
+  // - variance
+  double        var() const;
+  array<double> var(int    axis) const;
+  array<double> var(size_t axis) const;
+  array<double> var(const std::vector<int> &axes) const;
+  double        var(const array<X> &weights) const;
+  array<double> var(const array<X> &weights, int    axis) const;
+  array<double> var(const array<X> &weights, size_t axis) const;
+  array<double> var(const array<X> &weights, const std::vector<int> &axes) const;
+
+  // - standard deviation
+  double        stddev() const;
+  array<double> stddev(int    axis) const;
+  array<double> stddev(size_t axis) const;
+  array<double> stddev(const std::vector<int> &axes) const;
+  double        stddev(const array<X> &weights) const;
+  array<double> stddev(const array<X> &weights, int    axis) const;
+  array<double> stddev(const array<X> &weights, size_t axis) const;
+  array<double> stddev(const array<X> &weights, const std::vector<int> &axes) const;
+
+  // - skewness
+  double        skewness() const;
+  array<double> skewness(int    axis) const;
+  array<double> skewness(size_t axis) const;
+  array<double> skewness(const std::vector<int> &axes) const;
+  double        skewness(const array<X> &weights) const;
+  array<double> skewness(const array<X> &weights, int    axis) const;
+  array<double> skewness(const array<X> &weights, size_t axis) const;
+  array<double> skewness(const array<X> &weights, const std::vector<int> &axes) const;
+
+  // - excess kurtosis
+  double        kurtosis() const;
+  array<double> kurtosis(int    axis) const;
+  array<double> kurtosis(size_t axis) const;
+  array<double> kurtosis(const std::vector<int> &axes) const;
+  double        kurtosis(const array<X> &weights) const;
+  array<double> kurtosis(const array<X> &weights, int    axis) const;
+  array<double> kurtosis(const array<X> &weights, size_t axis) const;
+  array<double> kurtosis(const array<X> &weights, const std::vector<int> &axes) const;
+
+  // quantile "q" in [0,1], percentile "q" in [0,100], and median: linear interpolation between the
+  // closest values (as NumPy's default), using selection rather than sorting
+  // - quantile
+  double        quantile(double q) const;
+  array<double> quantile(double q, int    axis) const;
+  array<double> quantile(double q, size_t axis) const;
+  array<double> quantile(double q, const std::vector<int> &axes) const;
+
+  // - percentile
+  double        percentile(double q) const;
+  array<double> percentile(double q, int    axis) const;
+  array<double> percentile(double q, size_t axis) const;
+  array<double> percentile(double q, const std::vector<int> &axes) const;
+
+  // - median
+  double        median() const;
+  array<double> median(int    axis) const;
+  array<double> median(size_t axis) const;
+  array<double> median(const std::vector<int> &axes) const;
+
   // return array of booleans, based on condition
   array<int> equal        (const       X  &D) const;
   array<int> not_equal    (const       X  &D) const;
@@ -389,6 +475,28 @@ template<typename X> array<X> operator/ (const       X  &A, const array<X> &B);
 template<typename X> array<X> operator+ (const       X  &A, const array<X> &B);
 template<typename X> array<X> operator- (const       X  &A, const array<X> &B);
 
+// external arithmetic operators: re-use the storage of a temporary (rvalue) operand
+template<typename X> array<X> operator* (      array<X> &&A, const array<X>  &B);
+template<typename X> array<X> operator* (const array<X>  &A,       array<X> &&B);
+template<typename X> array<X> operator* (      array<X> &&A,       array<X> &&B);
+template<typename X> array<X> operator/ (      array<X> &&A, const array<X>  &B);
+template<typename X> array<X> operator/ (const array<X>  &A,       array<X> &&B);
+template<typename X> array<X> operator/ (      array<X> &&A,       array<X> &&B);
+template<typename X> array<X> operator+ (      array<X> &&A, const array<X>  &B);
+template<typename X> array<X> operator+ (const array<X>  &A,       array<X> &&B);
+template<typename X> array<X> operator+ (      array<X> &&A,       array<X> &&B);
+template<typename X> array<X> operator- (      array<X> &&A, const array<X>  &B);
+template<typename X> array<X> operator- (const array<X>  &A,       array<X> &&B);
+template<typename X> array<X> operator- (      array<X> &&A,       array<X> &&B);
+template<typename X> array<X> operator* (      array<X> &&A, const       X   &B);
+template<typename X> array<X> operator/ (      array<X> &&A, const       X   &B);
+template<typename X> array<X> operator+ (      array<X> &&A, const       X   &B);
+template<typename X> array<X> operator- (      array<X> &&A, const       X   &B);
+template<typename X> array<X> operator* (const       X   &A,       array<X> &&B);
+template<typename X> array<X> operator/ (const       X   &A,       array<X> &&B);
+template<typename X> array<X> operator+ (const       X   &A,       array<X> &&B);
+template<typename X> array<X> operator- (const       X   &A,       array<X> &&B);
+
 // print operator
 template<typename X> std::ostream& operator<<(std::ostream& out, const array<X>& src);
 
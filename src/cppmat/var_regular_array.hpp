@@ -21,7 +21,7 @@ namespace cppmat {
 
 template<typename X>
 inline
-array<X>::array(const std::vector<size_t> &shape)
+array<X>::array(const cppmat::shape_t &shape)
 {
   resize(shape);
 }
@@ -75,7 +75,7 @@ array<X>::array(const cppmat::view::array<X,RANK,I,J,K,L,M,N> &A)
 
 template<typename X>
 inline
-array<X> array<X>::Random(const std::vector<size_t> &shape, X lower, X upper)
+array<X> array<X>::Random(const cppmat::shape_t &shape, X lower, X upper)
 {
   array<X> out(shape);
 
@@ -88,7 +88,7 @@ array<X> array<X>::Random(const std::vector<size_t> &shape, X lower, X upper)
 
 template<typename X>
 inline
-array<X> array<X>::Arange(const std::vector<size_t> &shape)
+array<X> array<X>::Arange(const cppmat::shape_t &shape)
 {
   array<X> out(shape);
 
@@ -101,7 +101,7 @@ array<X> array<X>::Arange(const std::vector<size_t> &shape)
 
 template<typename X>
 inline
-array<X> array<X>::Zero(const std::vector<size_t> &shape)
+array<X> array<X>::Zero(const cppmat::shape_t &shape)
 {
   array<X> out(shape);
 
@@ -114,7 +114,7 @@ array<X> array<X>::Zero(const std::vector<size_t> &shape)
 
 template<typename X>
 inline
-array<X> array<X>::Ones(const std::vector<size_t> &shape)
+array<X> array<X>::Ones(const cppmat::shape_t &shape)
 {
   array<X> out(shape);
 
@@ -127,7 +127,7 @@ array<X> array<X>::Ones(const std::vector<size_t> &shape)
 
 template<typename X>
 inline
-array<X> array<X>::Constant(const std::vector<size_t> &shape, X D)
+array<X> array<X>::Constant(const cppmat::shape_t &shape, X D)
 {
   array<X> out(shape);
 
@@ -140,7 +140,7 @@ array<X> array<X>::Constant(const std::vector<size_t> &shape, X D)
 
 template<typename X>
 inline
-array<X> array<X>::Copy(const std::vector<size_t> &shape, const std::vector<X> &D)
+array<X> array<X>::Copy(const cppmat::shape_t &shape, const std::vector<X> &D)
 {
   array<X> out(shape);
 
@@ -154,7 +154,7 @@ array<X> array<X>::Copy(const std::vector<size_t> &shape, const std::vector<X> &
 template<typename X>
 template<typename Iterator>
 inline
-array<X> array<X>::Copy(const std::vector<size_t> &shape, Iterator first)
+array<X> array<X>::Copy(const cppmat::shape_t &shape, Iterator first)
 {
   array<X> out(shape);
 
@@ -168,7 +168,7 @@ array<X> array<X>::Copy(const std::vector<size_t> &shape, Iterator first)
 template<typename X>
 template<typename Iterator>
 inline
-array<X> array<X>::Copy(const std::vector<size_t> &shape, Iterator first, Iterator last)
+array<X> array<X>::Copy(const cppmat::shape_t &shape, Iterator first, Iterator last)
 {
   array<X> out(shape);
 
@@ -200,22 +200,23 @@ array<X>::operator std::vector<U> () const
 
 template<typename X>
 inline
-void array<X>::resize(const std::vector<size_t> &shape)
+void array<X>::resize(const cppmat::shape_t &shape)
 {
-  assert( shape.size() <= MAX_DIM );
-
   // store old size
   size_t size = mSize;
 
   // update number of dimensions
   mRank = shape.size();
 
-  // initialize shape/strides in all directions
-  std::fill(std::begin(mShape  )+mRank, std::begin(mShape  )+MAX_DIM, 1);
-  std::fill(std::begin(mStrides)      , std::begin(mStrides)+MAX_DIM, 1);
+  // initialize shape/strides in all directions (at least "MAX_DIM", padded with ones)
+  mShape  .resize(mRank > MAX_DIM ? mRank : MAX_DIM);
+  mStrides.resize(mShape.size());
+
+  std::fill(mShape  .begin()+mRank, mShape  .end(), 1);
+  std::fill(mStrides.begin()      , mStrides.end(), 1);
 
   // copy shape from input
-  std::copy(shape.begin(), shape.end(), std::begin(mShape));
+  std::copy(shape.begin(), shape.end(), mShape.begin());
 
   // get size
   // - initialize
@@ -224,9 +225,8 @@ void array<X>::resize(const std::vector<size_t> &shape)
   for ( size_t i = 0 ; i < mRank ; ++i ) mSize *= shape[i];
 
   // set storage strides
-  for ( size_t i = 0 ; i < MAX_DIM ; ++i )
-    for ( size_t j = i+1 ; j < MAX_DIM ; ++j )
-      mStrides[i] *= mShape[j];
+  for ( size_t i = mRank ; i-- > 1 ; )
+    mStrides[i-1] = mStrides[i] * mShape[i];
 
   // set empty
   if ( shape.size() == 0 ) mSize = 0;
@@ -239,22 +239,23 @@ void array<X>::resize(const std::vector<size_t> &shape)
 
 template<typename X>
 inline
-void array<X>::resize(const std::vector<size_t> &shape, const X &D)
+void array<X>::resize(const cppmat::shape_t &shape, const X &D)
 {
-  assert( shape.size() <= MAX_DIM );
-
   // store old size
   size_t size = mSize;
 
   // update number of dimensions
   mRank = shape.size();
 
-  // initialize shape/strides in all directions
-  std::fill(std::begin(mShape  )+mRank, std::begin(mShape  )+MAX_DIM, 1);
-  std::fill(std::begin(mStrides)      , std::begin(mStrides)+MAX_DIM, 1);
+  // initialize shape/strides in all directions (at least "MAX_DIM", padded with ones)
+  mShape  .resize(mRank > MAX_DIM ? mRank : MAX_DIM);
+  mStrides.resize(mShape.size());
+
+  std::fill(mShape  .begin()+mRank, mShape  .end(), 1);
+  std::fill(mStrides.begin()      , mStrides.end(), 1);
 
   // copy shape from input
-  std::copy(shape.begin(), shape.end(), std::begin(mShape));
+  std::copy(shape.begin(), shape.end(), mShape.begin());
 
   // get size
   // - initialize
@@ -263,9 +264,8 @@ void array<X>::resize(const std::vector<size_t> &shape, const X &D)
   for ( size_t i = 0 ; i < mRank ; ++i ) mSize *= shape[i];
 
   // set storage strides
-  for ( size_t i = 0 ; i < mRank ; ++i )
-    for ( size_t j = i+1 ; j < mRank ; ++j )
-      mStrides[i] *= mShape[j];
+  for ( size_t i = mRank ; i-- > 1 ; )
+    mStrides[i-1] = mStrides[i] * mShape[i];
 
   // set empty
   if ( shape.size() == 0 ) mSize = 0;
@@ -278,7 +278,7 @@ void array<X>::resize(const std::vector<size_t> &shape, const X &D)
 
 template<typename X>
 inline
-void array<X>::reshape(const std::vector<size_t> &shape)
+void array<X>::reshape(const cppmat::shape_t &shape)
 {
   // check that the size is unchanged
   #ifndef NDEBUG
@@ -299,7 +299,7 @@ void array<X>::chrank(size_t rank)
 {
   // check that all removed dimensions are of shape 1
   #ifndef NDEBUG
-    for ( size_t i = rank ; i < MAX_DIM ; ++i ) assert( mShape[i] == 1 );
+    for ( size_t i = rank ; i < mShape.size() ; ++i ) assert( mShape[i] == 1 );
   #endif
 
   // update number of dimensions
@@ -383,24 +383,18 @@ size_t array<X>::shape(size_t i) const
 
 template<typename X>
 inline
-std::vector<size_t> array<X>::shape() const
+cppmat::shape_t array<X>::shape() const
 {
-  std::vector<size_t> shape(mRank);
-
-  std::copy(std::begin(mShape), std::begin(mShape)+mRank, shape.begin());
-
-  return shape;
+  return cppmat::shape_t(mShape.begin(), mShape.begin()+mRank);
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-std::vector<size_t> array<X>::strides(bool bytes) const
+cppmat::shape_t array<X>::strides(bool bytes) const
 {
-  std::vector<size_t> strides(mRank);
-
-  std::copy(std::begin(mStrides), std::begin(mStrides)+mRank, strides.begin());
+  cppmat::shape_t strides(mStrides.begin(), mStrides.begin()+mRank);
 
   if ( bytes )
     for ( size_t i = 0 ; i < mRank ; ++i )
@@ -458,7 +452,7 @@ template<typename U>
 inline
 std::vector<U> array<X>::shape() const
 {
-  std::vector<size_t> A = shape();
+  cppmat::shape_t A = shape();
 
   std::vector<U> B(A.size());
 
@@ -474,7 +468,7 @@ template<typename U>
 inline
 std::vector<U> array<X>::strides(bool bytes) const
 {
-  std::vector<size_t> A = strides(bytes);
+  cppmat::shape_t A = strides(bytes);
 
   std::vector<U> B(A.size());
 
@@ -1037,6 +1031,26 @@ const X& array<X>::operator()(T a, T b, T c, T d, T e, T f) const
     f * mStrides[5]];
 }
 
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<typename... T, typename S>
+inline
+X& array<X>::operator()(T... idx)
+{
+  return mData[compress(idx...)];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<typename... T, typename S>
+inline
+const X& array<X>::operator()(T... idx) const
+{
+  return mData[compress(idx...)];
+}
+
 // =================================================================================================
 // index operators : at(...)
 // =================================================================================================
@@ -1051,8 +1065,8 @@ X& array<X>::at(Iterator first, Iterator last)
   assert( static_cast<size_t>(last-first) <= mRank );
 
   // iterator to shape and stride
-  size_t *shape  = &mShape  [0];
-  size_t *stride = &mStrides[0];
+  const size_t *shape  = mShape  .data();
+  const size_t *stride = mStrides.data();
 
   // zero-initialize plain storage index
   size_t idx = 0;
@@ -1084,8 +1098,8 @@ const X& array<X>::at(Iterator first, Iterator last) const
   assert( static_cast<size_t>(last-first) <= mRank );
 
   // iterator to shape and stride
-  size_t *shape  = &mShape  [0];
-  size_t *stride = &mStrides[0];
+  const size_t *shape  = mShape  .data();
+  const size_t *stride = mStrides.data();
 
   // zero-initialize plain storage index
   size_t idx = 0;
@@ -1359,6 +1373,27 @@ size_t array<X>::compress(T a, T b, T c, T d, T e, T f) const
          f * mStrides[5];
 }
 
+// -------------------------------------------------------------------------------------------------
+
+// the pack is expanded to one (inlined) term per index, for the number of indices that is fixed at
+// compile time; signed indices are periodic (as above)
+template<typename X>
+template<typename... T, typename S>
+inline
+size_t array<X>::compress(T... idx) const
+{
+  assert( sizeof...(T) <= mRank );
+
+  size_t i = 0;
+  size_t j = 0;
+
+  int expand[] = { ( i += Private::index(idx, mShape[j], mPeriodic) * mStrides[j], ++j, 0 )... };
+
+  (void)expand;
+
+  return i;
+}
+
 // =================================================================================================
 // index operators : decompress(...)
 // =================================================================================================
@@ -2047,6 +2082,9 @@ array<X> array<X>::slice(
   const std::vector<int> &d, const std::vector<int> &e, const std::vector<int> &f
 ) const
 {
+  // slicing is limited to the first "MAX_DIM" axes
+  assert( mRank <= MAX_DIM );
+
   // return empty
   if ( a.size()+b.size()+c.size()+d.size()+e.size()+f.size() == 0 ) return array<X>({0});
 
@@ -2094,7 +2132,7 @@ array<X> array<X>::slice(
 
   // shape of the output, without contraction
   // - allocate
-  std::vector<size_t> fullshape;
+  cppmat::shape_t fullshape;
   // - fill
   fullshape.push_back(A.size());
   fullshape.push_back(B.size());
@@ -2106,14 +2144,21 @@ array<X> array<X>::slice(
   // allocate output
   array<X> out(fullshape);
 
-  // copy based on selected indices
-  for ( size_t i = 0 ; i < A.size() ; ++i )
-    for ( size_t j = 0 ; j < B.size() ; ++j )
-      for ( size_t k = 0 ; k < C.size() ; ++k )
-        for ( size_t l = 0 ; l < D.size() ; ++l )
-          for ( size_t m = 0 ; m < E.size() ; ++m )
-            for ( size_t n = 0 ; n < F.size() ; ++n )
-              out(i,j,k,l,m,n) = (*this)(A[i],B[j],C[k],D[l],E[m],F[n]);
+  // convert the selected indices to offsets
+  for ( auto &i : A ) i *= mStrides[0];
+  for ( auto &i : B ) i *= mStrides[1];
+  for ( auto &i : C ) i *= mStrides[2];
+  for ( auto &i : D ) i *= mStrides[3];
+  for ( auto &i : E ) i *= mStrides[4];
+  for ( auto &i : F ) i *= mStrides[5];
+
+  // copy based on selected indices (the output is visited in order)
+  cppmat::multi_index<1> idx(fullshape);
+
+  for ( size_t i = 0 ; i < out.mSize ; ++i, ++idx ) {
+    const cppmat::shape_t &j = idx.index();
+    out.mData[i] = mData[A[j[0]]+B[j[1]]+C[j[2]]+D[j[3]]+E[j[4]]+F[j[5]]];
+  }
 
   // shape with contraction
   // - allocate
@@ -2145,6 +2190,9 @@ array<X> array<X>::slice(
   const std::vector<T> &d, const std::vector<T> &e, const std::vector<T> &f
 ) const
 {
+  // slicing is limited to the first "MAX_DIM" axes
+  assert( mRank <= MAX_DIM );
+
   // return empty
   if ( a.size()+b.size()+c.size()+d.size()+e.size()+f.size() == 0 ) return array<X>({0});
 
@@ -2204,7 +2252,7 @@ array<X> array<X>::slice(
 
   // shape of the output, without contraction
   // - allocate
-  std::vector<size_t> fullshape;
+  cppmat::shape_t fullshape;
   // - fill
   fullshape.push_back(A.size());
   fullshape.push_back(B.size());
@@ -2216,14 +2264,21 @@ array<X> array<X>::slice(
   // allocate output
   array<X> out(fullshape);
 
-  // copy based on selected indices
-  for ( size_t i = 0 ; i < A.size() ; ++i )
-    for ( size_t j = 0 ; j < B.size() ; ++j )
-      for ( size_t k = 0 ; k < C.size() ; ++k )
-        for ( size_t l = 0 ; l < D.size() ; ++l )
-          for ( size_t m = 0 ; m < E.size() ; ++m )
-            for ( size_t n = 0 ; n < F.size() ; ++n )
-              out(i,j,k,l,m,n) = (*this)(A[i],B[j],C[k],D[l],E[m],F[n]);
+  // convert the selected indices to offsets
+  for ( auto &i : A ) i *= mStrides[0];
+  for ( auto &i : B ) i *= mStrides[1];
+  for ( auto &i : C ) i *= mStrides[2];
+  for ( auto &i : D ) i *= mStrides[3];
+  for ( auto &i : E ) i *= mStrides[4];
+  for ( auto &i : F ) i *= mStrides[5];
+
+  // copy based on selected indices (the output is visited in order)
+  cppmat::multi_index<1> idx(fullshape);
+
+  for ( size_t i = 0 ; i < out.mSize ; ++i, ++idx ) {
+    const cppmat::shape_t &j = idx.index();
+    out.mData[i] = mData[A[j[0]]+B[j[1]]+C[j[2]]+D[j[3]]+E[j[4]]+F[j[5]]];
+  }
 
   // shape with contraction
   // - allocate
@@ -2264,21 +2319,25 @@ array<X> array<X>::pad(const std::vector<size_t> &pad_width, X D)
   // - allocate array
   array<X> out = array<X>::Constant(shape, D);
 
-  // pad size
-  // - allocate
-  std::vector<size_t> pad(MAX_DIM, 0);
-  // - fill
+  if ( mSize == 0 ) return out;
+
+  // flat index of the first entry of the current array in the output
+  size_t offset = 0;
+
   for ( size_t i = 0 ; i < mRank ; ++i )
-    pad[i] = pad_width[i];
+    offset += pad_width[i] * out.mStrides[i];
+
+  // place current array in output, row-by-row (the last axis is contiguous in both)
+  size_t ncol = mShape[mRank-1];
 
-  // place current array in output
-  for ( size_t i = 0 ; i < mShape[0] ; ++i )
-    for ( size_t j = 0 ; j < mShape[1] ; ++j )
-      for ( size_t k = 0 ; k < mShape[2] ; ++k )
-        for ( size_t l = 0 ; l < mShape[3] ; ++l )
-          for ( size_t m = 0 ; m < mShape[4] ; ++m )
-            for ( size_t n = 0 ; n < mShape[5] ; ++n )
-              out(i+pad[0],j+pad[1],k+pad[2],l+pad[3],m+pad[4],n+pad[5]) = (*this)(i,j,k,l,m,n);
+  cppmat::shape_t rows   (std::begin(    mShape  ), std::begin(    mShape  )+mRank-1);
+  cppmat::shape_t strides(std::begin(out.mStrides), std::begin(out.mStrides)+mRank-1);
+
+  for ( cppmat::multi_index<1> row(rows, {strides}, {offset}) ; !row.end() ; ++row )
+    std::copy(
+      mData.begin()+row.flat()*ncol, mData.begin()+(row.flat()+1)*ncol,
+      out.mData.begin()+row.offset()
+    );
 
   return out;
 }
@@ -2291,17 +2350,8 @@ template<typename X>
 inline
 void array<X>::setRandom(X lower, X upper)
 {
-  // type of random number distribution
-  std::uniform_real_distribution<X> dist(lower, upper);
-
-  // Mersenne Twister: Good quality random number generator
-  std::mt19937 rng;
-
-  // Initialize with non-deterministic seeds
-  rng.seed(std::random_device{}());
-
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] = dist(rng);
+  // library-wide counter-based generator (reproducible, see "cppmat::random::seed")
+  cppmat::random::uniform(data(), mSize, lower, upper, cppmat::random::generator());
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -2576,8 +2626,7 @@ array<X>& array<X>::operator*= (const array<X> &B)
   assert( rank () == B.rank () );
   assert( size () == B.size () );
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] *= B[i];
+  cppmat::simd::mul(mData.data(), B.data(), mData.data(), mSize);
 
   return *this;
 }
@@ -2592,8 +2641,7 @@ array<X>& array<X>::operator/= (const array<X> &B)
   assert( rank () == B.rank () );
   assert( size () == B.size () );
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] /= B[i];
+  cppmat::simd::div(mData.data(), B.data(), mData.data(), mSize);
 
   return *this;
 }
@@ -2608,8 +2656,7 @@ array<X>& array<X>::operator+= (const array<X> &B)
   assert( rank () == B.rank () );
   assert( size () == B.size () );
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] += B[i];
+  cppmat::simd::add(mData.data(), B.data(), mData.data(), mSize);
 
   return *this;
 }
@@ -2624,8 +2671,7 @@ array<X>& array<X>::operator-= (const array<X> &B)
   assert( rank () == B.rank () );
   assert( size () == B.size () );
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] -= B[i];
+  cppmat::simd::sub(mData.data(), B.data(), mData.data(), mSize);
 
   return *this;
 }
@@ -2764,24 +2810,11 @@ array<X> array<X>::min(size_t axis) const
   // initialize output to the same shape as the input, with one axis removed
   array<X> out = array<X>::Constant(del(shape(),axis), max());
 
-  // extended strides
-  // - copy strides
-  std::vector<size_t> estrides = strides();
-  // - insert total size at the beginning
-  estrides.insert(estrides.begin(), mSize);
-
-  // extract sizes
-  size_t n = estrides[axis  ];
-  size_t m = estrides[axis+1];
+  // perform reduction: the offset in the output follows from the multi-index of the input
+  cppmat::multi_index<1> idx(shape(), {Private::reduce_strides(out.strides(), axis)});
 
-  // perform reduction
-  for ( size_t i = 0 ; i < mSize ; ++i )
-  {
-    // - get the new index
-    size_t ni = i/n*m + i%m;
-    // - store
-    out[ni] = std::min(out[ni], mData[i]);
-  }
+  for ( size_t i = 0 ; i < mSize ; ++i, ++idx )
+    out[idx.offset()] = std::min(out[idx.offset()], mData[i]);
 
   return out;
 }
@@ -2848,24 +2881,11 @@ array<X> array<X>::max(size_t axis) const
   // initialize output to the same shape as the input, with one axis removed
   array<X> out = array<X>::Constant(del(shape(),axis), min());
 
-  // extended strides
-  // - copy strides
-  std::vector<size_t> estrides = strides();
-  // - insert total size at the beginning
-  estrides.insert(estrides.begin(), mSize);
-
-  // extract sizes
-  size_t n = estrides[axis  ];
-  size_t m = estrides[axis+1];
+  // perform reduction: the offset in the output follows from the multi-index of the input
+  cppmat::multi_index<1> idx(shape(), {Private::reduce_strides(out.strides(), axis)});
 
-  // perform reduction
-  for ( size_t i = 0 ; i < mSize ; ++i )
-  {
-    // - get the new index
-    size_t ni = i/n*m + i%m;
-    // - store
-    out[ni] = std::max(out[ni], mData[i]);
-  }
+  for ( size_t i = 0 ; i < mSize ; ++i, ++idx )
+    out[idx.offset()] = std::max(out[idx.offset()], mData[i]);
 
   return out;
 }
@@ -2917,7 +2937,7 @@ template<typename X>
 inline
 X array<X>::sum() const
 {
-  return std::accumulate(begin(), end(), static_cast<X>(0));
+  return cppmat::simd::sum(mData.data(), mSize);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -2929,24 +2949,11 @@ array<X> array<X>::sum(size_t axis) const
   // zero-initialize output to the same shape as the input, with one axis removed
   array<X> out = array<X>::Zero(del(shape(),axis));
 
-  // extended strides
-  // - copy strides
-  std::vector<size_t> estrides = strides();
-  // - insert total size at the beginning
-  estrides.insert(estrides.begin(), mSize);
-
-  // extract sizes
-  size_t n = estrides[axis  ];
-  size_t m = estrides[axis+1];
+  // perform reduction: the offset in the output follows from the multi-index of the input
+  cppmat::multi_index<1> idx(shape(), {Private::reduce_strides(out.strides(), axis)});
 
-  // perform reduction
-  for ( size_t i = 0 ; i < mSize ; ++i )
-  {
-    // - get the new index
-    size_t ni = i/n*m + i%m;
-    // - store
-    out[ni] += mData[i];
-  }
+  for ( size_t i = 0 ; i < mSize ; ++i, ++idx )
+    out[idx.offset()] += mData[i];
 
   return out;
 }
@@ -3081,268 +3088,873 @@ array<X> array<X>::average(
 }
 
 // =================================================================================================
-// return array of booleans, based on condition
+// moments
 // =================================================================================================
 
 template<typename X>
 inline
-array<int> array<X>::equal(const X &D) const
+cppmat::moments array<X>::moments() const
 {
-  array<int> out = array<int>::Zero(shape());
-
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] == D )
-      out[i] = 1;
-
-  return out;
+  return Private::moments_all(mData.data(), static_cast<const X*>(nullptr), mSize);
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-array<int> array<X>::not_equal(const X &D) const
+cppmat::array<cppmat::moments> array<X>::moments(size_t axis) const
 {
-  array<int> out = array<int>::Zero(shape());
-
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] != D )
-      out[i] = 1;
+  assert( axis < mRank );
 
-  return out;
+  return Private::moments_along(
+    mData.data(), static_cast<const X*>(nullptr), shape(), {static_cast<int>(axis)});
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-array<int> array<X>::greater(const X &D) const
+cppmat::array<cppmat::moments> array<X>::moments(int axis) const
 {
-  array<int> out = array<int>::Zero(shape());
+  // check axis: (0,1,...,rank-1) or (-1,-2,...,-rank)
+  assert( axis  <      static_cast<int>(mRank) );
+  assert( axis >= -1 * static_cast<int>(mRank) );
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] > D )
-      out[i] = 1;
+  // get number of dimensions as integer
+  int n = static_cast<int>(mRank);
 
-  return out;
+  // correct periodic axis
+  axis = ( n + (axis%n) ) % n;
+
+  // compute
+  return moments(static_cast<size_t>(axis));
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-array<int> array<X>::greater_equal(const X &D) const
+cppmat::array<cppmat::moments> array<X>::moments(const std::vector<int> &axes_in) const
 {
-  array<int> out = array<int>::Zero(shape());
+  // check rank
+  assert( axes_in.size() < mRank );
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] >= D )
-      out[i] = 1;
+  // correct for 'periodicity', sort from low to high
+  std::vector<int> axes = cppmat::Private::sort_axes(axes_in, static_cast<int>(mRank), false);
 
-  return out;
+  // compute: all axes at once
+  return Private::moments_along(mData.data(), static_cast<const X*>(nullptr), shape(), axes);
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-array<int> array<X>::less(const X &D) const
+cppmat::moments array<X>::moments(const array<X> &weights) const
 {
-  array<int> out = array<int>::Zero(shape());
-
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] < D )
-      out[i] = 1;
+  assert( weights.shape() == shape() );
 
-  return out;
+  return Private::moments_all(mData.data(), weights.data(), mSize);
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-array<int> array<X>::less_equal(const X &D) const
+cppmat::array<cppmat::moments> array<X>::moments(const array<X> &weights, size_t axis) const
 {
-  array<int> out = array<int>::Zero(shape());
-
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] <= D )
-      out[i] = 1;
+  assert( axis < mRank );
+  assert( weights.shape() == shape() );
 
-  return out;
+  return Private::moments_along(mData.data(), weights.data(), shape(), {static_cast<int>(axis)});
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-array<int> array<X>::equal(const array<X> &D) const
+cppmat::array<cppmat::moments> array<X>::moments(const array<X> &weights, int axis) const
 {
-  assert( shape() == D.shape() );
-  assert( size () == D.size () );
+  // check axis: (0,1,...,rank-1) or (-1,-2,...,-rank)
+  assert( axis  <      static_cast<int>(mRank) );
+  assert( axis >= -1 * static_cast<int>(mRank) );
 
-  array<int> out = array<int>::Zero(shape());
+  // get number of dimensions as integer
+  int n = static_cast<int>(mRank);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] == D[i] )
-      out[i] = 1;
+  // correct periodic axis
+  axis = ( n + (axis%n) ) % n;
 
-  return out;
+  // compute
+  return moments(weights, static_cast<size_t>(axis));
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-array<int> array<X>::not_equal(const array<X> &D) const
+cppmat::array<cppmat::moments> array<X>::moments(
+  const array<X> &weights, const std::vector<int> &axes_in) const
 {
-  assert( shape() == D.shape() );
-  assert( size () == D.size () );
-
-  array<int> out = array<int>::Zero(shape());
+  // check rank
+  assert( axes_in.size() < mRank );
+  assert( weights.shape() == shape() );
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] != D[i] )
-      out[i] = 1;
+  // correct for 'periodicity', sort from low to high
+  std::vector<int> axes = cppmat::Private::sort_axes(axes_in, static_cast<int>(mRank), false);
 
-  return out;
+  // compute: all axes at once
+  return Private::moments_along(mData.data(), weights.data(), shape(), axes);
 }
 
-// -------------------------------------------------------------------------------------------------
+// =================================================================================================
+// variance
+// =================================================================================================
 
 template<typename X>
 inline
-array<int> array<X>::greater(const array<X> &D) const
+double array<X>::var() const
 {
-  assert( shape() == D.shape() );
-  assert( size () == D.size () );
+  return moments().var();
+}
 
-  array<int> out = array<int>::Zero(shape());
+// -------------------------------------------------------------------------------------------------
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] > D[i] )
-      out[i] = 1;
+template<typename X>
+inline
+array<double> array<X>::var(int axis) const
+{
+  auto f = [](const cppmat::moments &m) { return m.var(); };
 
-  return out;
+  return Private::moments_map<double>(moments(axis), f);
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-array<int> array<X>::greater_equal(const array<X> &D) const
+array<double> array<X>::var(size_t axis) const
 {
-  assert( shape() == D.shape() );
-  assert( size () == D.size () );
+  auto f = [](const cppmat::moments &m) { return m.var(); };
 
-  array<int> out = array<int>::Zero(shape());
+  return Private::moments_map<double>(moments(axis), f);
+}
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] >= D[i] )
-      out[i] = 1;
+// -------------------------------------------------------------------------------------------------
 
-  return out;
+template<typename X>
+inline
+array<double> array<X>::var(const std::vector<int> &axes) const
+{
+  auto f = [](const cppmat::moments &m) { return m.var(); };
+
+  return Private::moments_map<double>(moments(axes), f);
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-array<int> array<X>::less(const array<X> &D) const
+double array<X>::var(const array<X> &weights) const
 {
-  assert( shape() == D.shape() );
-  assert( size () == D.size () );
+  return moments(weights).var();
+}
 
-  array<int> out = array<int>::Zero(shape());
+// -------------------------------------------------------------------------------------------------
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] < D[i] )
-      out[i] = 1;
+template<typename X>
+inline
+array<double> array<X>::var(const array<X> &weights, int axis) const
+{
+  auto f = [](const cppmat::moments &m) { return m.var(); };
 
-  return out;
+  return Private::moments_map<double>(moments(weights, axis), f);
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-array<int> array<X>::less_equal(const array<X> &D) const
+array<double> array<X>::var(const array<X> &weights, size_t axis) const
 {
-  assert( shape() == D.shape() );
-  assert( size () == D.size () );
+  auto f = [](const cppmat::moments &m) { return m.var(); };
 
-  array<int> out = array<int>::Zero(shape());
+  return Private::moments_map<double>(moments(weights, axis), f);
+}
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] <= D[i] )
-      out[i] = 1;
+// -------------------------------------------------------------------------------------------------
 
-  return out;
+template<typename X>
+inline
+array<double> array<X>::var(const array<X> &weights, const std::vector<int> &axes) const
+{
+  auto f = [](const cppmat::moments &m) { return m.var(); };
+
+  return Private::moments_map<double>(moments(weights, axes), f);
 }
 
 // =================================================================================================
-// find the plain storage indices of all non-zero entries
+// standard deviation
 // =================================================================================================
 
 template<typename X>
 inline
-std::vector<size_t> array<X>::where() const
+double array<X>::stddev() const
 {
-  size_t nnz = 0;
-
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] )
-      ++nnz;
-
-  std::vector<size_t> out(nnz);
+  return moments().stddev();
+}
 
-  size_t j = 0;
+// -------------------------------------------------------------------------------------------------
 
-  for ( size_t i = 0 ; i < mSize ; ++i ) {
-    if ( mData[i] ) {
-      out[j] = i;
-      ++j;
-    }
-  }
+template<typename X>
+inline
+array<double> array<X>::stddev(int axis) const
+{
+  auto f = [](const cppmat::moments &m) { return m.stddev(); };
 
-  return out;
+  return Private::moments_map<double>(moments(axis), f);
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-size_t array<X>::where(size_t index) const
+array<double> array<X>::stddev(size_t axis) const
 {
-  size_t j = 0;
-
-  for ( size_t i = 0 ; i < mSize ; ++i ) {
-    if ( mData[i] ) {
-      if ( j == index ) return i;
-      ++j;
-    }
-  }
+  auto f = [](const cppmat::moments &m) { return m.stddev(); };
 
-  throw std::runtime_error("Out-of-bounds");
+  return Private::moments_map<double>(moments(axis), f);
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-size_t array<X>::where(int index) const
+array<double> array<X>::stddev(const std::vector<int> &axes) const
 {
-  int nnz = 0;
+  auto f = [](const cppmat::moments &m) { return m.stddev(); };
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] )
-      ++nnz;
+  return Private::moments_map<double>(moments(axes), f);
+}
 
-  assert( index < nnz && index >= -nnz );
+// -------------------------------------------------------------------------------------------------
 
-  index = ( nnz + (index%nnz) ) % nnz;
+template<typename X>
+inline
+double array<X>::stddev(const array<X> &weights) const
+{
+  return moments(weights).stddev();
+}
 
-  int j = 0;
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::stddev(const array<X> &weights, int axis) const
+{
+  auto f = [](const cppmat::moments &m) { return m.stddev(); };
+
+  return Private::moments_map<double>(moments(weights, axis), f);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::stddev(const array<X> &weights, size_t axis) const
+{
+  auto f = [](const cppmat::moments &m) { return m.stddev(); };
+
+  return Private::moments_map<double>(moments(weights, axis), f);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::stddev(const array<X> &weights, const std::vector<int> &axes) const
+{
+  auto f = [](const cppmat::moments &m) { return m.stddev(); };
+
+  return Private::moments_map<double>(moments(weights, axes), f);
+}
+
+// =================================================================================================
+// skewness
+// =================================================================================================
+
+template<typename X>
+inline
+double array<X>::skewness() const
+{
+  return moments().skewness();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::skewness(int axis) const
+{
+  auto f = [](const cppmat::moments &m) { return m.skewness(); };
+
+  return Private::moments_map<double>(moments(axis), f);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::skewness(size_t axis) const
+{
+  auto f = [](const cppmat::moments &m) { return m.skewness(); };
+
+  return Private::moments_map<double>(moments(axis), f);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::skewness(const std::vector<int> &axes) const
+{
+  auto f = [](const cppmat::moments &m) { return m.skewness(); };
+
+  return Private::moments_map<double>(moments(axes), f);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+double array<X>::skewness(const array<X> &weights) const
+{
+  return moments(weights).skewness();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::skewness(const array<X> &weights, int axis) const
+{
+  auto f = [](const cppmat::moments &m) { return m.skewness(); };
+
+  return Private::moments_map<double>(moments(weights, axis), f);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::skewness(const array<X> &weights, size_t axis) const
+{
+  auto f = [](const cppmat::moments &m) { return m.skewness(); };
+
+  return Private::moments_map<double>(moments(weights, axis), f);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::skewness(const array<X> &weights, const std::vector<int> &axes) const
+{
+  auto f = [](const cppmat::moments &m) { return m.skewness(); };
+
+  return Private::moments_map<double>(moments(weights, axes), f);
+}
+
+// =================================================================================================
+// excess kurtosis
+// =================================================================================================
+
+template<typename X>
+inline
+double array<X>::kurtosis() const
+{
+  return moments().kurtosis();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::kurtosis(int axis) const
+{
+  auto f = [](const cppmat::moments &m) { return m.kurtosis(); };
+
+  return Private::moments_map<double>(moments(axis), f);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::kurtosis(size_t axis) const
+{
+  auto f = [](const cppmat::moments &m) { return m.kurtosis(); };
+
+  return Private::moments_map<double>(moments(axis), f);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::kurtosis(const std::vector<int> &axes) const
+{
+  auto f = [](const cppmat::moments &m) { return m.kurtosis(); };
+
+  return Private::moments_map<double>(moments(axes), f);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+double array<X>::kurtosis(const array<X> &weights) const
+{
+  return moments(weights).kurtosis();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::kurtosis(const array<X> &weights, int axis) const
+{
+  auto f = [](const cppmat::moments &m) { return m.kurtosis(); };
+
+  return Private::moments_map<double>(moments(weights, axis), f);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::kurtosis(const array<X> &weights, size_t axis) const
+{
+  auto f = [](const cppmat::moments &m) { return m.kurtosis(); };
+
+  return Private::moments_map<double>(moments(weights, axis), f);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::kurtosis(const array<X> &weights, const std::vector<int> &axes) const
+{
+  auto f = [](const cppmat::moments &m) { return m.kurtosis(); };
+
+  return Private::moments_map<double>(moments(weights, axes), f);
+}
+
+// =================================================================================================
+// quantile
+// =================================================================================================
+
+template<typename X>
+inline
+double array<X>::quantile(double q) const
+{
+  assert( q >= 0. and q <= 1. );
+
+  // copy to scratch buffer: the selection reorders
+  std::vector<X> buf(mData.begin(), mData.end());
+
+  return Private::quantile_inplace(buf.data(), buf.size(), q);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::quantile(double q, size_t axis) const
+{
+  assert( axis < mRank );
+  assert( q >= 0. and q <= 1. );
+
+  return Private::quantile_along(mData.data(), shape(), {static_cast<int>(axis)}, q);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::quantile(double q, int axis) const
+{
+  // check axis: (0,1,...,rank-1) or (-1,-2,...,-rank)
+  assert( axis  <      static_cast<int>(mRank) );
+  assert( axis >= -1 * static_cast<int>(mRank) );
+
+  // get number of dimensions as integer
+  int n = static_cast<int>(mRank);
+
+  // correct periodic axis
+  axis = ( n + (axis%n) ) % n;
+
+  // compute
+  return quantile(q, static_cast<size_t>(axis));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::quantile(double q, const std::vector<int> &axes_in) const
+{
+  // check rank
+  assert( axes_in.size() < mRank );
+  assert( q >= 0. and q <= 1. );
+
+  // correct for 'periodicity', sort from low to high
+  std::vector<int> axes = cppmat::Private::sort_axes(axes_in, static_cast<int>(mRank), false);
+
+  // compute: all axes at once
+  return Private::quantile_along(mData.data(), shape(), axes, q);
+}
+
+// =================================================================================================
+// percentile
+// =================================================================================================
+
+template<typename X>
+inline
+double array<X>::percentile(double q) const
+{
+  return quantile(q / 100.);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::percentile(double q, int axis) const
+{
+  return quantile(q / 100., axis);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::percentile(double q, size_t axis) const
+{
+  return quantile(q / 100., axis);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::percentile(double q, const std::vector<int> &axes) const
+{
+  return quantile(q / 100., axes);
+}
+
+// =================================================================================================
+// median
+// =================================================================================================
+
+template<typename X>
+inline
+double array<X>::median() const
+{
+  return quantile(.5);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::median(int axis) const
+{
+  return quantile(.5, axis);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::median(size_t axis) const
+{
+  return quantile(.5, axis);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<double> array<X>::median(const std::vector<int> &axes) const
+{
+  return quantile(.5, axes);
+}
+
+// =================================================================================================
+// return array of booleans, based on condition
+// =================================================================================================
+
+template<typename X>
+inline
+array<int> array<X>::equal(const X &D) const
+{
+  array<int> out = array<int>::Zero(shape());
+
+  for ( size_t i = 0 ; i < mSize ; ++i )
+    if ( mData[i] == D )
+      out[i] = 1;
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<int> array<X>::not_equal(const X &D) const
+{
+  array<int> out = array<int>::Zero(shape());
+
+  for ( size_t i = 0 ; i < mSize ; ++i )
+    if ( mData[i] != D )
+      out[i] = 1;
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<int> array<X>::greater(const X &D) const
+{
+  array<int> out = array<int>::Zero(shape());
+
+  for ( size_t i = 0 ; i < mSize ; ++i )
+    if ( mData[i] > D )
+      out[i] = 1;
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<int> array<X>::greater_equal(const X &D) const
+{
+  array<int> out = array<int>::Zero(shape());
+
+  for ( size_t i = 0 ; i < mSize ; ++i )
+    if ( mData[i] >= D )
+      out[i] = 1;
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<int> array<X>::less(const X &D) const
+{
+  array<int> out = array<int>::Zero(shape());
+
+  for ( size_t i = 0 ; i < mSize ; ++i )
+    if ( mData[i] < D )
+      out[i] = 1;
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<int> array<X>::less_equal(const X &D) const
+{
+  array<int> out = array<int>::Zero(shape());
+
+  for ( size_t i = 0 ; i < mSize ; ++i )
+    if ( mData[i] <= D )
+      out[i] = 1;
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<int> array<X>::equal(const array<X> &D) const
+{
+  assert( shape() == D.shape() );
+  assert( size () == D.size () );
+
+  array<int> out = array<int>::Zero(shape());
+
+  for ( size_t i = 0 ; i < mSize ; ++i )
+    if ( mData[i] == D[i] )
+      out[i] = 1;
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<int> array<X>::not_equal(const array<X> &D) const
+{
+  assert( shape() == D.shape() );
+  assert( size () == D.size () );
+
+  array<int> out = array<int>::Zero(shape());
+
+  for ( size_t i = 0 ; i < mSize ; ++i )
+    if ( mData[i] != D[i] )
+      out[i] = 1;
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<int> array<X>::greater(const array<X> &D) const
+{
+  assert( shape() == D.shape() );
+  assert( size () == D.size () );
+
+  array<int> out = array<int>::Zero(shape());
+
+  for ( size_t i = 0 ; i < mSize ; ++i )
+    if ( mData[i] > D[i] )
+      out[i] = 1;
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<int> array<X>::greater_equal(const array<X> &D) const
+{
+  assert( shape() == D.shape() );
+  assert( size () == D.size () );
+
+  array<int> out = array<int>::Zero(shape());
+
+  for ( size_t i = 0 ; i < mSize ; ++i )
+    if ( mData[i] >= D[i] )
+      out[i] = 1;
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<int> array<X>::less(const array<X> &D) const
+{
+  assert( shape() == D.shape() );
+  assert( size () == D.size () );
+
+  array<int> out = array<int>::Zero(shape());
+
+  for ( size_t i = 0 ; i < mSize ; ++i )
+    if ( mData[i] < D[i] )
+      out[i] = 1;
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<int> array<X>::less_equal(const array<X> &D) const
+{
+  assert( shape() == D.shape() );
+  assert( size () == D.size () );
+
+  array<int> out = array<int>::Zero(shape());
+
+  for ( size_t i = 0 ; i < mSize ; ++i )
+    if ( mData[i] <= D[i] )
+      out[i] = 1;
+
+  return out;
+}
+
+// =================================================================================================
+// find the plain storage indices of all non-zero entries
+// =================================================================================================
+
+template<typename X>
+inline
+std::vector<size_t> array<X>::where() const
+{
+  size_t nnz = 0;
+
+  for ( size_t i = 0 ; i < mSize ; ++i )
+    if ( mData[i] )
+      ++nnz;
+
+  std::vector<size_t> out(nnz);
+
+  size_t j = 0;
+
+  for ( size_t i = 0 ; i < mSize ; ++i ) {
+    if ( mData[i] ) {
+      out[j] = i;
+      ++j;
+    }
+  }
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t array<X>::where(size_t index) const
+{
+  size_t j = 0;
+
+  for ( size_t i = 0 ; i < mSize ; ++i ) {
+    if ( mData[i] ) {
+      if ( j == index ) return i;
+      ++j;
+    }
+  }
+
+  throw std::runtime_error("Out-of-bounds");
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t array<X>::where(int index) const
+{
+  int nnz = 0;
+
+  for ( size_t i = 0 ; i < mSize ; ++i )
+    if ( mData[i] )
+      ++nnz;
+
+  assert( index < nnz && index >= -nnz );
+
+  index = ( nnz + (index%nnz) ) % nnz;
+
+  int j = 0;
 
   for ( size_t i = 0 ; i < mSize ; ++i ) {
     if ( mData[i] ) {
@@ -3451,8 +4063,7 @@ array<X> operator* (const array<X> &A, const array<X> &B)
 
   array<X> C(A.shape());
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] * B[i];
+  cppmat::simd::mul(A.data(), B.data(), C.data(), C.size());
 
   return C;
 }
@@ -3469,8 +4080,7 @@ array<X> operator/ (const array<X> &A, const array<X> &B)
 
   array<X> C(A.shape());
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] / B[i];
+  cppmat::simd::div(A.data(), B.data(), C.data(), C.size());
 
   return C;
 }
@@ -3487,8 +4097,7 @@ array<X> operator+ (const array<X> &A, const array<X> &B)
 
   array<X> C(A.shape());
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] + B[i];
+  cppmat::simd::add(A.data(), B.data(), C.data(), C.size());
 
   return C;
 }
@@ -3505,8 +4114,7 @@ array<X> operator- (const array<X> &A, const array<X> &B)
 
   array<X> C(A.shape());
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] - B[i];
+  cppmat::simd::sub(A.data(), B.data(), C.data(), C.size());
 
   return C;
 }
@@ -3623,6 +4231,284 @@ array<X> operator- (const X &A, const array<X> &B)
   return C;
 }
 
+// =================================================================================================
+// arithmetic operators: external, re-using the storage of a temporary (rvalue) operand
+// =================================================================================================
+
+template<typename X>
+inline
+array<X> operator* (array<X> &&A, const array<X> &B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  cppmat::simd::mul(A.data(), B.data(), A.data(), A.size());
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> operator* (const array<X> &A, array<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  cppmat::simd::mul(A.data(), B.data(), B.data(), B.size());
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> operator* (array<X> &&A, array<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  cppmat::simd::mul(A.data(), B.data(), A.data(), A.size());
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> operator/ (array<X> &&A, const array<X> &B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  cppmat::simd::div(A.data(), B.data(), A.data(), A.size());
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> operator/ (const array<X> &A, array<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  cppmat::simd::div(A.data(), B.data(), B.data(), B.size());
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> operator/ (array<X> &&A, array<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  cppmat::simd::div(A.data(), B.data(), A.data(), A.size());
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> operator+ (array<X> &&A, const array<X> &B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  cppmat::simd::add(A.data(), B.data(), A.data(), A.size());
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> operator+ (const array<X> &A, array<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  cppmat::simd::add(A.data(), B.data(), B.data(), B.size());
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> operator+ (array<X> &&A, array<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  cppmat::simd::add(A.data(), B.data(), A.data(), A.size());
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> operator- (array<X> &&A, const array<X> &B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  cppmat::simd::sub(A.data(), B.data(), A.data(), A.size());
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> operator- (const array<X> &A, array<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  cppmat::simd::sub(A.data(), B.data(), B.data(), B.size());
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> operator- (array<X> &&A, array<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  cppmat::simd::sub(A.data(), B.data(), A.data(), A.size());
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> operator* (array<X> &&A, const X &B)
+{
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] * B;
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> operator/ (array<X> &&A, const X &B)
+{
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] / B;
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> operator+ (array<X> &&A, const X &B)
+{
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] + B;
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> operator- (array<X> &&A, const X &B)
+{
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] - B;
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> operator* (const X &A, array<X> &&B)
+{
+  for ( size_t i = 0 ; i < B.size() ; ++i )
+    B[i] = A * B[i];
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> operator/ (const X &A, array<X> &&B)
+{
+  for ( size_t i = 0 ; i < B.size() ; ++i )
+    B[i] = A / B[i];
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> operator+ (const X &A, array<X> &&B)
+{
+  for ( size_t i = 0 ; i < B.size() ; ++i )
+    B[i] = A + B[i];
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> operator- (const X &A, array<X> &&B)
+{
+  for ( size_t i = 0 ; i < B.size() ; ++i )
+    B[i] = A - B[i];
+
+  return std::move(B);
+}
+
 // =================================================================================================
 // minimum/maximum from two arrays of equal shape
 // =================================================================================================
@@ -47,6 +47,9 @@ public:
   template<typename U, typename=typename std::enable_if<std::is_convertible<U,X>::value>::type>
   matrix(const cppmat::array<U> &A);
 
+  // constructor: move from parent (re-uses the storage)
+  matrix(cppmat::array<X> &&A);
+
   // constructor: copy from other class
   matrix(const cppmat::symmetric::matrix<X> &A);
   matrix(const cppmat::diagonal ::matrix<X> &A);
@@ -37,6 +37,15 @@ matrix<X>::matrix(const cppmat::array<U> &A) : cppmat::array<X>(A)
   assert( this->mRank == 2 );
 }
 
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X>::matrix(cppmat::array<X> &&A) : cppmat::array<X>(std::move(A))
+{
+  assert( this->mRank == 2 );
+}
+
 // =================================================================================================
 // constructors: copy from other class
 // =================================================================================================
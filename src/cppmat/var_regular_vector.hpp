@@ -37,6 +37,15 @@ vector<X>::vector(const cppmat::array<U> &A) : cppmat::array<X>(A)
   assert( this->mRank == 1 );
 }
 
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+vector<X>::vector(cppmat::array<X> &&A) : cppmat::array<X>(std::move(A))
+{
+  assert( this->mRank == 1 );
+}
+
 // =================================================================================================
 // constructors: copy from other class
 // =================================================================================================
@@ -268,7 +277,9 @@ void vector<X>::append(const cppmat::array<X> &A)
 {
   assert( A.rank() == 1 );
 
-  this->mData.insert(this->end(), A.begin(), A.end());
+  this->mData.resize(this->mSize + A.size());
+
+  std::copy(A.begin(), A.end(), this->mData.begin() + this->mSize);
 
   this->mShape[0] += A.size();
   this->mSize     += A.size();
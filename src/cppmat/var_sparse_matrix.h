@@ -0,0 +1,130 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_VAR_SPARSE_MATRIX_H
+#define CPPMAT_VAR_SPARSE_MATRIX_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace sparse {
+
+// =================================================================================================
+// cppmat::sparse::matrix
+// =================================================================================================
+
+// Assembly is done by adding (row, column, value) triplets (COO format), which are stored in a
+// buffer. Calling "compress()" converts the buffer to compressed row storage (CSR format) by sorting
+// the entries per row and summing duplicates. Adding to an entry that is already part of the
+// compressed storage does not touch the buffer, such that re-assembling a fixed sparsity pattern
+// (e.g. after "setZero()") does not allocate.
+
+template<typename X>
+class matrix
+{
+protected:
+
+  static const size_t mRank=2;          // rank (number of axes)
+  size_t              M=0;              // number of rows
+  size_t              N=0;              // number of columns
+  std::vector<size_t> mOuter;           // CSR: start of each row in "mInner" and "mData" [M+1]
+  std::vector<size_t> mInner;           // CSR: column index of each entry [nnz]
+  std::vector<X>      mData;            // CSR: value of each entry [nnz]
+  std::vector<size_t> mRowBuf;          // COO: row index of each uncompressed entry
+  std::vector<size_t> mColBuf;          // COO: column index of each uncompressed entry
+  std::vector<X>      mValBuf;          // COO: value of each uncompressed entry
+
+public:
+
+  // constructor: default
+  matrix() = default;
+
+  // constructor: allocate an empty matrix
+  matrix(size_t m, size_t n);
+
+  // named constructor: copy from (row, column, value) triplets, duplicates are summed
+  static matrix<X> Copy(size_t m, size_t n,
+    const std::vector<size_t> &row, const std::vector<size_t> &col, const std::vector<X> &D);
+
+  // named constructor: copy the non-zero entries of a dense matrix
+  static matrix<X> CopyDense(const cppmat::matrix<X> &A);
+
+  // resize (removes all entries)
+  void resize(size_t m, size_t n);
+
+  // reserve buffer space for a number of (uncompressed) entries
+  void reserve(size_t nnz);
+
+  // get dimensions
+  size_t rank() const;
+  size_t shape(int    i) const;
+  size_t shape(size_t i) const;
+  cppmat::shape_t shape() const;
+
+  // number of stored entries (in the compressed storage, excluding the buffer)
+  size_t nnz() const;
+
+  // check if all entries are in the compressed storage
+  bool isCompressed() const;
+
+  // compressed storage: row pointer [M+1], column index [nnz], and values [nnz]
+  const size_t* indptr () const;
+  const size_t* indices() const;
+  X*            data   ();
+  const X*      data   () const;
+
+  // add a single entry: A(a,b) += D
+  void add(size_t a, size_t b, X D);
+
+  // scatter-add a (dense) element matrix: A(dofs[i],dofs[j]) += B(i,j)
+  void add(const cppmat::matrix<X> &B, const std::vector<size_t> &dofs);
+
+  // scatter-add a (dense) element matrix: A(row[i],col[j]) += B(i,j)
+  void add(const cppmat::matrix<X> &B, const std::vector<size_t> &row,
+    const std::vector<size_t> &col);
+
+  // convert buffered entries to compressed storage, summing duplicates
+  void compress();
+
+  // set all values to zero, keep the sparsity pattern
+  void setZero();
+
+  // remove all entries, including the sparsity pattern
+  void clear();
+
+  // read a value (zero if not stored), the matrix has to be compressed
+  X operator()(size_t a, size_t b) const;
+
+  // copy to dense storage (row-major), the matrix has to be compressed
+  template<typename Iterator> void copyToDense(Iterator first) const;
+  template<typename Iterator> void copyToDense(Iterator first, Iterator last) const;
+
+  // matrix-vector product: C_i = A_ij * B_j, the matrix has to be compressed
+  cppmat::vector<X> dot(const cppmat::vector<X> &B) const;
+
+};
+
+// matrix-vector product: C_i = A_ij * B_j
+template<typename X> cppmat::vector<X> dot(const matrix<X> &A, const cppmat::vector<X> &B);
+
+// matrix-array product: "B" is rank 1 (vector), or rank 2 (each column is a right-hand side)
+template<typename X> cppmat::array<X> dot(const matrix<X> &A, const cppmat::array<X> &B);
+
+// print operator
+template<typename X> std::ostream& operator<<(std::ostream& out, const matrix<X>& src);
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
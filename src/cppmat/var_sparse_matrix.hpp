@@ -0,0 +1,528 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_VAR_SPARSE_MATRIX_HPP
+#define CPPMAT_VAR_SPARSE_MATRIX_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace sparse {
+
+// =================================================================================================
+// constructors
+// =================================================================================================
+
+template<typename X>
+inline
+matrix<X>::matrix(size_t m, size_t n)
+{
+  resize(m,n);
+}
+
+// =================================================================================================
+// named constructors
+// =================================================================================================
+
+template<typename X>
+inline
+matrix<X> matrix<X>::Copy(size_t m, size_t n,
+  const std::vector<size_t> &row, const std::vector<size_t> &col, const std::vector<X> &D)
+{
+  assert( row.size() == col.size() );
+  assert( row.size() == D  .size() );
+
+  matrix<X> out(m,n);
+
+  out.mRowBuf = row;
+  out.mColBuf = col;
+  out.mValBuf = D;
+
+  out.compress();
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> matrix<X>::CopyDense(const cppmat::matrix<X> &A)
+{
+  matrix<X> out(A.shape(0),A.shape(1));
+
+  for ( size_t i = 0 ; i < out.M ; ++i )
+    for ( size_t j = 0 ; j < out.N ; ++j )
+      if ( A[i*out.N+j] != static_cast<X>(0) )
+        out.add(i, j, A[i*out.N+j]);
+
+  out.compress();
+
+  return out;
+}
+
+// =================================================================================================
+// resize
+// =================================================================================================
+
+template<typename X>
+inline
+void matrix<X>::resize(size_t m, size_t n)
+{
+  M = m;
+  N = n;
+
+  clear();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void matrix<X>::reserve(size_t nnz)
+{
+  mRowBuf.reserve(nnz);
+  mColBuf.reserve(nnz);
+  mValBuf.reserve(nnz);
+}
+
+// =================================================================================================
+// get dimensions
+// =================================================================================================
+
+template<typename X>
+inline
+size_t matrix<X>::rank() const
+{
+  return mRank;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t matrix<X>::shape(int i) const
+{
+  // check axis: (0,1,...,rank-1) or (-1,-2,...,-rank)
+  assert( i  <      static_cast<int>(mRank) );
+  assert( i >= -1 * static_cast<int>(mRank) );
+
+  // get number of dimensions as integer
+  int n = static_cast<int>(mRank);
+
+  // correct periodic index
+  i = ( n + (i%n) ) % n;
+
+  // return shape
+  if ( i == 0 ) return M;
+  else          return N;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t matrix<X>::shape(size_t i) const
+{
+  // check axis: (0,1,...,rank-1)
+  assert( i < mRank );
+
+  // return shape
+  if ( i == 0 ) return M;
+  else          return N;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::shape_t matrix<X>::shape() const
+{
+  cppmat::shape_t out = {M, N};
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t matrix<X>::nnz() const
+{
+  return mData.size();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+bool matrix<X>::isCompressed() const
+{
+  return mValBuf.size() == 0;
+}
+
+// =================================================================================================
+// pointer to data
+// =================================================================================================
+
+template<typename X>
+inline
+const size_t* matrix<X>::indptr() const
+{
+  return mOuter.data();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+const size_t* matrix<X>::indices() const
+{
+  return mInner.data();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X* matrix<X>::data()
+{
+  return mData.data();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+const X* matrix<X>::data() const
+{
+  return mData.data();
+}
+
+// =================================================================================================
+// assembly
+// =================================================================================================
+
+template<typename X>
+inline
+void matrix<X>::add(size_t a, size_t b, X D)
+{
+  assert( a < M );
+  assert( b < N );
+
+  // add to the compressed storage, if the entry is part of the sparsity pattern
+  auto first = mInner.begin() + mOuter[a  ];
+  auto last  = mInner.begin() + mOuter[a+1];
+  auto entry = std::lower_bound(first, last, b);
+
+  if ( entry != last and *entry == b ) {
+    mData[entry-mInner.begin()] += D;
+    return;
+  }
+
+  // add to buffer
+  mRowBuf.push_back(a);
+  mColBuf.push_back(b);
+  mValBuf.push_back(D);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void matrix<X>::add(const cppmat::matrix<X> &B, const std::vector<size_t> &dofs)
+{
+  add(B, dofs, dofs);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void matrix<X>::add(const cppmat::matrix<X> &B, const std::vector<size_t> &row,
+  const std::vector<size_t> &col)
+{
+  assert( B.shape(0) == row.size() );
+  assert( B.shape(1) == col.size() );
+
+  size_t n = col.size();
+
+  for ( size_t i = 0 ; i < row.size() ; ++i )
+    for ( size_t j = 0 ; j < n ; ++j )
+      add(row[i], col[j], B[i*n+j]);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void matrix<X>::compress()
+{
+  if ( mValBuf.size() == 0 ) return;
+
+  // bucket all entries (compressed and buffered) per row
+  // - number of entries per row
+  std::vector<size_t> outer(M+1, 0);
+  // - count
+  for ( size_t i = 0 ; i < M ; ++i ) outer[i+1] = mOuter[i+1] - mOuter[i];
+  for ( auto &i : mRowBuf ) ++outer[i+1];
+  // - convert to row pointer
+  std::partial_sum(outer.begin(), outer.end(), outer.begin());
+  // - allocate bucketed storage
+  std::vector<size_t> inner(outer[M]);
+  std::vector<X>      data (outer[M]);
+  std::vector<size_t> pos  (outer.begin(), outer.end()-1);
+  // - copy compressed entries
+  for ( size_t i = 0 ; i < M ; ++i ) {
+    for ( size_t k = mOuter[i] ; k < mOuter[i+1] ; ++k ) {
+      inner[pos[i]] = mInner[k];
+      data [pos[i]] = mData [k];
+      ++pos[i];
+    }
+  }
+  // - copy buffered entries
+  for ( size_t k = 0 ; k < mValBuf.size() ; ++k ) {
+    size_t i = mRowBuf[k];
+    inner[pos[i]] = mColBuf[k];
+    data [pos[i]] = mValBuf[k];
+    ++pos[i];
+  }
+
+  // sort each row on column index, and sum duplicates
+  mInner.clear();
+  mData .clear();
+  mInner.reserve(outer[M]);
+  mData .reserve(outer[M]);
+
+  std::vector<std::pair<size_t,X>> row;
+
+  for ( size_t i = 0 ; i < M ; ++i )
+  {
+    row.clear();
+
+    for ( size_t k = outer[i] ; k < outer[i+1] ; ++k )
+      row.push_back(std::make_pair(inner[k], data[k]));
+
+    std::sort(row.begin(), row.end(),
+      [](const std::pair<size_t,X> &a, const std::pair<size_t,X> &b){return a.first < b.first;});
+
+    mOuter[i] = mData.size();
+
+    for ( auto &entry : row ) {
+      if ( mData.size() > mOuter[i] and mInner.back() == entry.first ) {
+        mData.back() += entry.second;
+      }
+      else {
+        mInner.push_back(entry.first);
+        mData .push_back(entry.second);
+      }
+    }
+  }
+
+  mOuter[M] = mData.size();
+
+  // empty buffer (keep its capacity)
+  mRowBuf.clear();
+  mColBuf.clear();
+  mValBuf.clear();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void matrix<X>::setZero()
+{
+  std::fill(mData.begin(), mData.end(), static_cast<X>(0));
+
+  std::fill(mValBuf.begin(), mValBuf.end(), static_cast<X>(0));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void matrix<X>::clear()
+{
+  mOuter.assign(M+1, 0);
+
+  mInner .clear();
+  mData  .clear();
+  mRowBuf.clear();
+  mColBuf.clear();
+  mValBuf.clear();
+}
+
+// =================================================================================================
+// index operators
+// =================================================================================================
+
+template<typename X>
+inline
+X matrix<X>::operator()(size_t a, size_t b) const
+{
+  assert( a < M );
+  assert( b < N );
+  assert( isCompressed() );
+
+  auto first = mInner.begin() + mOuter[a  ];
+  auto last  = mInner.begin() + mOuter[a+1];
+  auto entry = std::lower_bound(first, last, b);
+
+  if ( entry != last and *entry == b ) return mData[entry-mInner.begin()];
+
+  return static_cast<X>(0);
+}
+
+// =================================================================================================
+// copy to target
+// =================================================================================================
+
+template<typename X>
+template<typename Iterator>
+inline
+void matrix<X>::copyToDense(Iterator first) const
+{
+  assert( isCompressed() );
+
+  std::fill(first, first+M*N, static_cast<X>(0));
+
+  for ( size_t i = 0 ; i < M ; ++i )
+    for ( size_t k = mOuter[i] ; k < mOuter[i+1] ; ++k )
+      first[i*N+mInner[k]] = mData[k];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<typename Iterator>
+inline
+void matrix<X>::copyToDense(Iterator first, Iterator last) const
+{
+  assert( M*N == static_cast<size_t>(last-first) );
+
+  UNUSED(last);
+
+  copyToDense(first);
+}
+
+// =================================================================================================
+// matrix-vector product
+// =================================================================================================
+
+template<typename X>
+inline
+cppmat::vector<X> matrix<X>::dot(const cppmat::vector<X> &B) const
+{
+  assert( isCompressed() );
+  assert( N == B.size() );
+
+  cppmat::vector<X> C(M);
+
+  const size_t *outer = mOuter.data();
+  const size_t *inner = mInner.data();
+  const X      *a     = mData .data();
+  const X      *b     = B     .data();
+  X            *c     = C     .data();
+
+  // rows are independent: distribute them over threads (if OpenMP is enabled)
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for ( size_t i = 0 ; i < M ; ++i )
+  {
+    X ci = static_cast<X>(0);
+
+    for ( size_t k = outer[i] ; k < outer[i+1] ; ++k )
+      ci += a[k] * b[inner[k]];
+
+    c[i] = ci;
+  }
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::vector<X> dot(const matrix<X> &A, const cppmat::vector<X> &B)
+{
+  return A.dot(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::array<X> dot(const matrix<X> &A, const cppmat::array<X> &B)
+{
+  assert( A.isCompressed() );
+  assert( B.rank() == 1 or B.rank() == 2 );
+  assert( A.shape(1) == B.shape(0) );
+
+  size_t M = A.shape(0);
+  size_t K = B.rank() == 2 ? B.shape(1) : 1;
+
+  std::vector<size_t> shape = B.shape();
+
+  shape[0] = M;
+
+  cppmat::array<X> C = cppmat::array<X>::Zero(shape);
+
+  const size_t *outer = A.indptr();
+  const size_t *inner = A.indices();
+  const X      *a     = A.data();
+  const X      *b     = B.data();
+  X            *c     = C.data();
+
+  // rows are independent: distribute them over threads (if OpenMP is enabled)
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for ( size_t i = 0 ; i < M ; ++i )
+    for ( size_t k = outer[i] ; k < outer[i+1] ; ++k )
+      for ( size_t j = 0 ; j < K ; ++j )
+        c[i*K+j] += a[k] * b[inner[k]*K+j];
+
+  return C;
+}
+
+// =================================================================================================
+// print operator
+// =================================================================================================
+
+template<typename X>
+inline
+std::ostream& operator<<(std::ostream& out, const matrix<X>& src)
+{
+  auto w = out.width();
+  auto p = out.precision();
+
+  for ( size_t i = 0 ; i < src.shape(0) ; ++i ) {
+    for ( size_t j = 0 ; j < src.shape(1) ; ++j ) {
+      out << std::setw(w) << std::setprecision(p) << src(i,j);
+      if      ( j != src.shape(1)-1 ) out << ", ";
+      else if ( i != src.shape(0)-1 ) out << ";" << std::endl;
+      else                            out << ";";
+    }
+  }
+
+  return out;
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -28,7 +28,7 @@ protected:
   size_t              mSize=0;          // total size == data.size()
   static const size_t mRank=2;          // rank (number of axes)
   size_t              N=0;              // number of rows/columns
-  std::vector<X>      mData;            // data container
+  cppmat::small_vector<X,cppmat::inline_size<X>::value> mData; // data container
   bool                mPeriodic=false;  // if true: disable bounds-check where possible
 
 public:
@@ -82,7 +82,7 @@ public:
   size_t rank() const;
   size_t shape(int    i) const;
   size_t shape(size_t i) const;
-  std::vector<size_t> shape() const;
+  cppmat::shape_t shape() const;
 
   // get using a different return type
   template<typename U> U size() const;
@@ -145,6 +145,12 @@ public:
   template<typename T, typename=typename std::enable_if<std::is_unsigned<T>::value,void>::type>
   auto item(T a, T b) const;
 
+  // iterator to the packed storage of row "a" of the upper triangle: (a,a), (a,a+1), ..., (a,N-1)
+  auto rowBegin(size_t a);
+  auto rowBegin(size_t a) const;
+  auto rowEnd  (size_t a);
+  auto rowEnd  (size_t a) const;
+
   // initialization
   void setRandom(X lower=(X)0, X upper=(X)1);
   void setArange();
@@ -253,9 +259,44 @@ template<typename X> matrix<X> operator/ (const        X  &A, const matrix<X> &B
 template<typename X> matrix<X> operator+ (const        X  &A, const matrix<X> &B);
 template<typename X> matrix<X> operator- (const        X  &A, const matrix<X> &B);
 
+// external arithmetic operators (cppmat::symmetric::matrix): re-use the storage of a temporary operand
+template<typename X> matrix<X> operator* (      matrix<X> &&A, const matrix<X>  &B);
+template<typename X> matrix<X> operator* (const matrix<X>  &A,       matrix<X> &&B);
+template<typename X> matrix<X> operator* (      matrix<X> &&A,       matrix<X> &&B);
+template<typename X> matrix<X> operator/ (      matrix<X> &&A, const matrix<X>  &B);
+template<typename X> matrix<X> operator/ (const matrix<X>  &A,       matrix<X> &&B);
+template<typename X> matrix<X> operator/ (      matrix<X> &&A,       matrix<X> &&B);
+template<typename X> matrix<X> operator+ (      matrix<X> &&A, const matrix<X>  &B);
+template<typename X> matrix<X> operator+ (const matrix<X>  &A,       matrix<X> &&B);
+template<typename X> matrix<X> operator+ (      matrix<X> &&A,       matrix<X> &&B);
+template<typename X> matrix<X> operator- (      matrix<X> &&A, const matrix<X>  &B);
+template<typename X> matrix<X> operator- (const matrix<X>  &A,       matrix<X> &&B);
+template<typename X> matrix<X> operator- (      matrix<X> &&A,       matrix<X> &&B);
+template<typename X> matrix<X> operator* (      matrix<X> &&A, const        X   &B);
+template<typename X> matrix<X> operator/ (      matrix<X> &&A, const        X   &B);
+template<typename X> matrix<X> operator+ (      matrix<X> &&A, const        X   &B);
+template<typename X> matrix<X> operator- (      matrix<X> &&A, const        X   &B);
+template<typename X> matrix<X> operator* (const        X   &A,       matrix<X> &&B);
+template<typename X> matrix<X> operator/ (const        X   &A,       matrix<X> &&B);
+template<typename X> matrix<X> operator+ (const        X   &A,       matrix<X> &&B);
+template<typename X> matrix<X> operator- (const        X   &A,       matrix<X> &&B);
+
 // print operator
 template<typename X> std::ostream& operator<<(std::ostream& out, const matrix<X>& src);
 
+// symmetric matrix-vector product: C_i = A_ij * B_j
+template<typename X> cppmat::vector<X> dot(const matrix<X> &A, const cppmat::vector<X> &B);
+
+// symmetric-dense matrix products: C_ik = A_ij * B_jk
+template<typename X> cppmat::matrix<X> dot(const matrix<X> &A, const cppmat::matrix<X> &B);
+template<typename X> cppmat::matrix<X> dot(const cppmat::matrix<X> &A, const matrix<X> &B);
+
+// symmetric rank-1 update: A_ij += alpha * x_i * x_j
+template<typename X> void syr(matrix<X> &A, const cppmat::vector<X> &x, X alpha=(X)1);
+
+// symmetric rank-k update: A_ij += alpha * B_ik * B_jk
+template<typename X> void syrk(matrix<X> &A, const cppmat::matrix<X> &B, X alpha=(X)1);
+
 // =================================================================================================
 
 }} // namespace ...
@@ -348,11 +348,11 @@ size_t matrix<X>::shape(size_t i) const
 
 template<typename X>
 inline
-std::vector<size_t> matrix<X>::shape() const
+cppmat::shape_t matrix<X>::shape() const
 {
-  std::vector<size_t> shape(mRank);
+  cppmat::shape_t shape;
 
-  std::fill(shape.begin(), shape.end(), N);
+  shape.resize(mRank, N);
 
   return shape;
 }
@@ -406,7 +406,7 @@ template<typename U>
 inline
 std::vector<U> matrix<X>::shape() const
 {
-  std::vector<size_t> A = shape();
+  cppmat::shape_t A = shape();
 
   std::vector<U> B(A.size());
 
@@ -455,8 +455,10 @@ X& matrix<X>::operator()(int a, int b)
   size_t A = static_cast<size_t>( (n+(a%n)) % n );
   size_t B = static_cast<size_t>( (n+(b%n)) % n );
 
-  if (A <= B) return mData[ A*N - (A-1)*A/2 + B - A ];
-  else        return mData[ B*N - (B-1)*B/2 + A - B ];
+  size_t i = std::min<size_t>(A,B);
+  size_t j = std::max<size_t>(A,B);
+
+  return mData[ i*N - (i-1)*i/2 + j - i ];
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -473,8 +475,10 @@ const X& matrix<X>::operator()(int a, int b) const
   size_t A = static_cast<size_t>( (n+(a%n)) % n );
   size_t B = static_cast<size_t>( (n+(b%n)) % n );
 
-  if (A <= B) return mData[ A*N - (A-1)*A/2 + B - A ];
-  else        return mData[ B*N - (B-1)*B/2 + A - B ];
+  size_t i = std::min<size_t>(A,B);
+  size_t j = std::max<size_t>(A,B);
+
+  return mData[ i*N - (i-1)*i/2 + j - i ];
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -487,8 +491,10 @@ X& matrix<X>::operator()(T a, T b)
   assert( a < N );
   assert( b < N );
 
-  if (a <= b) return mData[ a*N - (a-1)*a/2 + b - a ];
-  else        return mData[ b*N - (b-1)*b/2 + a - b ];
+  size_t i = std::min<size_t>(a,b);
+  size_t j = std::max<size_t>(a,b);
+
+  return mData[ i*N - (i-1)*i/2 + j - i ];
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -501,8 +507,10 @@ const X& matrix<X>::operator()(T a, T b) const
   assert( a < N );
   assert( b < N );
 
-  if (a <= b) return mData[ a*N - (a-1)*a/2 + b - a ];
-  else        return mData[ b*N - (b-1)*b/2 + a - b ];
+  size_t i = std::min<size_t>(a,b);
+  size_t j = std::max<size_t>(a,b);
+
+  return mData[ i*N - (i-1)*i/2 + j - i ];
 }
 
 // =================================================================================================
@@ -521,8 +529,10 @@ size_t matrix<X>::compress(int a, int b) const
   size_t A = static_cast<size_t>( (n+(a%n)) % n );
   size_t B = static_cast<size_t>( (n+(b%n)) % n );
 
-  if (A <= B) return A*N - (A-1)*A/2 + B - A;
-  else        return B*N - (B-1)*B/2 + A - B;
+  size_t i = std::min<size_t>(A,B);
+  size_t j = std::max<size_t>(A,B);
+
+  return i*N - (i-1)*i/2 + j - i;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -535,8 +545,10 @@ size_t matrix<X>::compress(T a, T b) const
   assert( a < N );
   assert( b < N );
 
-  if (a <= b) return a*N - (a-1)*a/2 + b - a;
-  else        return b*N - (b-1)*b/2 + a - b;
+  size_t i = std::min<size_t>(a,b);
+  size_t j = std::max<size_t>(a,b);
+
+  return i*N - (i-1)*i/2 + j - i;
 }
 
 // =================================================================================================
@@ -707,8 +719,10 @@ auto matrix<X>::item(int a, int b)
   size_t A = static_cast<size_t>( (n+(a%n)) % n );
   size_t B = static_cast<size_t>( (n+(b%n)) % n );
 
-  if (A <= B) return begin() + ( A*N - (A-1)*A/2 + B - A );
-  else        return begin() + ( B*N - (B-1)*B/2 + A - B );
+  size_t i = std::min<size_t>(A,B);
+  size_t j = std::max<size_t>(A,B);
+
+  return begin() + ( i*N - (i-1)*i/2 + j - i );
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -725,8 +739,10 @@ auto matrix<X>::item(int a, int b) const
   size_t A = static_cast<size_t>( (n+(a%n)) % n );
   size_t B = static_cast<size_t>( (n+(b%n)) % n );
 
-  if (A <= B) return begin() + ( A*N - (A-1)*A/2 + B - A );
-  else        return begin() + ( B*N - (B-1)*B/2 + A - B );
+  size_t i = std::min<size_t>(A,B);
+  size_t j = std::max<size_t>(A,B);
+
+  return begin() + ( i*N - (i-1)*i/2 + j - i );
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -739,8 +755,10 @@ auto matrix<X>::item(T a, T b)
   assert( a < N );
   assert( b < N );
 
-  if (a <= b) return begin() + ( a*N - (a-1)*a/2 + b - a );
-  else        return begin() + ( b*N - (b-1)*b/2 + a - b );
+  size_t i = std::min<size_t>(a,b);
+  size_t j = std::max<size_t>(a,b);
+
+  return begin() + ( i*N - (i-1)*i/2 + j - i );
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -753,29 +771,68 @@ auto matrix<X>::item(T a, T b) const
   assert( a < N );
   assert( b < N );
 
-  if (a <= b) return begin() + ( a*N - (a-1)*a/2 + b - a );
-  else        return begin() + ( b*N - (b-1)*b/2 + a - b );
+  size_t i = std::min<size_t>(a,b);
+  size_t j = std::max<size_t>(a,b);
+
+  return begin() + ( i*N - (i-1)*i/2 + j - i );
 }
 
 // =================================================================================================
-// initialize
+// iterators : rowBegin() and rowEnd()
 // =================================================================================================
 
 template<typename X>
 inline
-void matrix<X>::setRandom(X lower, X upper)
+auto matrix<X>::rowBegin(size_t a)
 {
-  // type of random number distribution
-  std::uniform_real_distribution<X> dist(lower, upper);
+  assert( a < N );
 
-  // Mersenne Twister: Good quality random number generator
-  std::mt19937 rng;
+  return begin() + ( a*N - (a-1)*a/2 );
+}
 
-  // Initialize with non-deterministic seeds
-  rng.seed(std::random_device{}());
+// -------------------------------------------------------------------------------------------------
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] = dist(rng);
+template<typename X>
+inline
+auto matrix<X>::rowBegin(size_t a) const
+{
+  assert( a < N );
+
+  return begin() + ( a*N - (a-1)*a/2 );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+auto matrix<X>::rowEnd(size_t a)
+{
+  assert( a < N );
+
+  return begin() + ( (a+1)*N - a*(a+1)/2 );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+auto matrix<X>::rowEnd(size_t a) const
+{
+  assert( a < N );
+
+  return begin() + ( (a+1)*N - a*(a+1)/2 );
+}
+
+// =================================================================================================
+// initialize
+// =================================================================================================
+
+template<typename X>
+inline
+void matrix<X>::setRandom(X lower, X upper)
+{
+  // library-wide counter-based generator (reproducible, see "cppmat::random::seed")
+  cppmat::random::uniform(data(), mSize, lower, upper, cppmat::random::generator());
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -1769,6 +1826,470 @@ matrix<X> operator- (const X &A, const matrix<X> &B)
   return C;
 }
 
+// =================================================================================================
+// arithmetic operators: external, re-using the storage of a temporary (rvalue) operand
+// =================================================================================================
+
+template<typename X>
+inline
+matrix<X> operator* (matrix<X> &&A, const matrix<X> &B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] * B[i];
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator* (const matrix<X> &A, matrix<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  for ( size_t i = 0 ; i < B.size() ; ++i )
+    B[i] = A[i] * B[i];
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator* (matrix<X> &&A, matrix<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] * B[i];
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator/ (matrix<X> &&A, const matrix<X> &B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] / B[i];
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator/ (const matrix<X> &A, matrix<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  for ( size_t i = 0 ; i < B.size() ; ++i )
+    B[i] = A[i] / B[i];
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator/ (matrix<X> &&A, matrix<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] / B[i];
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator+ (matrix<X> &&A, const matrix<X> &B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] + B[i];
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator+ (const matrix<X> &A, matrix<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  for ( size_t i = 0 ; i < B.size() ; ++i )
+    B[i] = A[i] + B[i];
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator+ (matrix<X> &&A, matrix<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] + B[i];
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator- (matrix<X> &&A, const matrix<X> &B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] - B[i];
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator- (const matrix<X> &A, matrix<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  for ( size_t i = 0 ; i < B.size() ; ++i )
+    B[i] = A[i] - B[i];
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator- (matrix<X> &&A, matrix<X> &&B)
+{
+  assert( A.shape() == B.shape() );
+  assert( A.rank () == B.rank () );
+  assert( A.size () == B.size () );
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] - B[i];
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator* (matrix<X> &&A, const X &B)
+{
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] * B;
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator/ (matrix<X> &&A, const X &B)
+{
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] / B;
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator+ (matrix<X> &&A, const X &B)
+{
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] + B;
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator- (matrix<X> &&A, const X &B)
+{
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    A[i] = A[i] - B;
+
+  return std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator* (const X &A, matrix<X> &&B)
+{
+  for ( size_t i = 0 ; i < B.size() ; ++i )
+    B[i] = A * B[i];
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator/ (const X &A, matrix<X> &&B)
+{
+  for ( size_t i = 0 ; i < B.size() ; ++i )
+    B[i] = A / B[i];
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator+ (const X &A, matrix<X> &&B)
+{
+  for ( size_t i = 0 ; i < B.size() ; ++i )
+    B[i] = A + B[i];
+
+  return std::move(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> operator- (const X &A, matrix<X> &&B)
+{
+  for ( size_t i = 0 ; i < B.size() ; ++i )
+    B[i] = A - B[i];
+
+  return std::move(B);
+}
+
+// =================================================================================================
+// packed-storage kernels
+// =================================================================================================
+
+// The kernels below walk the upper triangle row-by-row: row "i" is stored contiguously and
+// contains the "N-i" entries (i,i), (i,i+1), ..., (i,N-1). Each off-diagonal entry is used twice.
+
+template<typename X>
+inline
+cppmat::vector<X> dot(const matrix<X> &A, const cppmat::vector<X> &B)
+{
+  assert( A.shape(1) == B.size() );
+
+  size_t N = A.shape(0);
+
+  cppmat::vector<X> C = cppmat::vector<X>::Zero(N);
+
+  const X *a = A.data();
+  const X *b = B.data();
+  X       *c = C.data();
+
+  for ( size_t i = 0 ; i < N ; ++i )
+  {
+    X ci = a[0] * b[i];
+
+    for ( size_t j = i+1 ; j < N ; ++j )
+    {
+      ci   += a[j-i] * b[j];
+      c[j] += a[j-i] * b[i];
+    }
+
+    c[i] += ci;
+    a    += N-i;
+  }
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> dot(const matrix<X> &A, const cppmat::matrix<X> &B)
+{
+  assert( A.shape(1) == B.shape(0) );
+
+  size_t N = A.shape(0);
+  size_t K = B.shape(1);
+
+  cppmat::matrix<X> C = cppmat::matrix<X>::Zero(N, K);
+
+  const X *a = A.data();
+
+  for ( size_t i = 0 ; i < N ; ++i )
+  {
+    const X *bi = B.data() + i*K;
+    X       *ci = C.data() + i*K;
+
+    for ( size_t k = 0 ; k < K ; ++k )
+      ci[k] += a[0] * bi[k];
+
+    for ( size_t j = i+1 ; j < N ; ++j )
+    {
+      const X *bj  = B.data() + j*K;
+      X       *cj  = C.data() + j*K;
+      X        aij = a[j-i];
+
+      for ( size_t k = 0 ; k < K ; ++k )
+      {
+        ci[k] += aij * bj[k];
+        cj[k] += aij * bi[k];
+      }
+    }
+
+    a += N-i;
+  }
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> dot(const cppmat::matrix<X> &A, const matrix<X> &B)
+{
+  assert( A.shape(1) == B.shape(0) );
+
+  size_t M = A.shape(0);
+  size_t N = B.shape(0);
+
+  cppmat::matrix<X> C = cppmat::matrix<X>::Zero(M, N);
+
+  // each row of "C" is the product of "B" with the corresponding row of "A"
+  for ( size_t m = 0 ; m < M ; ++m )
+  {
+    const X *a = A.data() + m*N;
+    const X *b = B.data();
+    X       *c = C.data() + m*N;
+
+    for ( size_t i = 0 ; i < N ; ++i )
+    {
+      X ci = b[0] * a[i];
+
+      for ( size_t j = i+1 ; j < N ; ++j )
+      {
+        ci   += b[j-i] * a[j];
+        c[j] += b[j-i] * a[i];
+      }
+
+      c[i] += ci;
+      b    += N-i;
+    }
+  }
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void syr(matrix<X> &A, const cppmat::vector<X> &x, X alpha)
+{
+  assert( A.shape(0) == x.size() );
+
+  size_t N = A.shape(0);
+
+  X       *a = A.data();
+  const X *b = x.data();
+
+  for ( size_t i = 0 ; i < N ; ++i )
+  {
+    X bi = alpha * b[i];
+
+    for ( size_t j = i ; j < N ; ++j )
+      a[j-i] += bi * b[j];
+
+    a += N-i;
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void syrk(matrix<X> &A, const cppmat::matrix<X> &B, X alpha)
+{
+  assert( A.shape(0) == B.shape(0) );
+
+  size_t N = A.shape(0);
+  size_t K = B.shape(1);
+
+  X *a = A.data();
+
+  for ( size_t i = 0 ; i < N ; ++i )
+  {
+    const X *bi = B.data() + i*K;
+
+    for ( size_t j = i ; j < N ; ++j )
+    {
+      const X *bj  = B.data() + j*K;
+      X        aij = static_cast<X>(0);
+
+      for ( size_t k = 0 ; k < K ; ++k )
+        aij += bi[k] * bj[k];
+
+      a[j-i] += alpha * aij;
+    }
+
+    a += N-i;
+  }
+}
+
 // =================================================================================================
 
 }} // namespace ...